@@ -0,0 +1,129 @@
+'use strict'
+
+const { PerformanceObserver } = require('perf_hooks')
+
+/* 压测使用的合约, 模拟前置机对订阅的合约轮流推送行情 */
+const INSTRUMENTS = ['rb1805', 'cu1803', 'SR805', 'IF1801', 'au1806', 'm1805']
+
+/* 模拟前置机不校验地址 */
+const MOCK_FRONT = 'tcp://127.0.0.1:0'
+
+/**
+ * 单调时钟, 单位为纳秒
+ */
+function now () {
+  const [sec, nsec] = process.hrtime()
+  return sec * 1e9 + nsec
+}
+
+function sleep (ms) {
+  return new Promise((resolve) => setTimeout(resolve, ms))
+}
+
+function round (value, digits = 3) {
+  const scale = Math.pow(10, digits)
+  return Math.round(value * scale) / scale
+}
+
+/**
+ * C++层直方图(纳秒)->微秒
+ */
+function histogramToUs (histogram) {
+  if (!histogram) {
+    return null
+  }
+  let result = { count: histogram.count }
+  for (let key of ['mean', 'p50', 'p90', 'p99', 'p999', 'max']) {
+    result[key] = round(histogram[key] / 1e3)
+  }
+  return result
+}
+
+/**
+ * 样本数组(纳秒)->微秒分位数
+ */
+function samplesToUs (samples) {
+  const sorted = Float64Array.from(samples).sort()
+  const count = sorted.length
+  const at = (q) => count ? sorted[Math.min(count - 1, Math.ceil(q * count) - 1)] : 0
+  const sum = sorted.reduce((a, b) => a + b, 0)
+  return {
+    count,
+    mean: round((count ? sum / count : 0) / 1e3),
+    p50: round(at(0.5) / 1e3),
+    p90: round(at(0.9) / 1e3),
+    p99: round(at(0.99) / 1e3),
+    p999: round(at(0.999) / 1e3),
+    max: round((count ? sorted[count - 1] : 0) / 1e3)
+  }
+}
+
+/**
+ * 统计测量期间的GC停顿与常驻内存增长
+ */
+class ResourceMonitor {
+  start () {
+    this._gc = { count: 0, totalMs: 0, maxMs: 0 }
+    this._observer = new PerformanceObserver((list) => {
+      for (let entry of list.getEntries()) {
+        this._gc.count++
+        this._gc.totalMs += entry.duration
+        this._gc.maxMs = Math.max(this._gc.maxMs, entry.duration)
+      }
+    })
+    this._observer.observe({ entryTypes: ['gc'] })
+
+    this._rssStart = process.memoryUsage().rss
+    this._rssPeak = this._rssStart
+    this._timer = setInterval(() => {
+      this._rssPeak = Math.max(this._rssPeak, process.memoryUsage().rss)
+    }, 100)
+  }
+
+  stop () {
+    clearInterval(this._timer)
+    this._observer.disconnect()
+
+    const rssEnd = process.memoryUsage().rss
+    const mb = (bytes) => round(bytes / 1048576)
+    return {
+      gc: {
+        count: this._gc.count,
+        totalMs: round(this._gc.totalMs),
+        maxMs: round(this._gc.maxMs)
+      },
+      rss: {
+        startMB: mb(this._rssStart),
+        endMB: mb(rssEnd),
+        peakMB: mb(Math.max(this._rssPeak, rssEnd)),
+        growthMB: mb(rssEnd - this._rssStart)
+      }
+    }
+  }
+}
+
+/**
+ * 子进程入口, 运行压测场景并将结果发送给父进程
+ */
+function runScenario (scenarios) {
+  const name = process.argv[2]
+  const options = JSON.parse(process.argv[3] || '{}')
+
+  scenarios[name](options).then((result) => {
+    process.send({ result }, () => process.exit(0))
+  }, (err) => {
+    process.send({ error: err.stack || String(err) }, () => process.exit(1))
+  })
+}
+
+module.exports = {
+  INSTRUMENTS,
+  MOCK_FRONT,
+  now,
+  sleep,
+  round,
+  histogramToUs,
+  samplesToUs,
+  ResourceMonitor,
+  runScenario
+}
@@ -0,0 +1,179 @@
+'use strict'
+
+/**
+ * 压测入口, 需要先执行npm run build:mock链接模拟前置机
+ *
+ * 用法: node bench/index.js [--duration ms] [--output file] [--filter name] [--no-check]
+ *   --duration 行情场景的测量时长, 默认5000毫秒
+ *   --output   结果输出文件, 默认bench/result.json
+ *   --filter   只运行名称包含该字符串的场景
+ *   --no-check 不与package.json中的benchmark目标比较
+ *
+ * 每个场景在独立的子进程中运行, 模拟前置机通过环境变量配置.
+ * 结果中的延迟单位为微秒, 内存单位为MB. 吞吐与p99延迟目标按预期值留有约
+ * 一倍余量, 未达到时返回非0; 内存, GC与p999等波动较大的目标标记为advisory,
+ * 未达到时只输出警告, 不影响返回值
+ */
+
+const fs = require('fs')
+const os = require('os')
+const path = require('path')
+const { fork } = require('child_process')
+const pkg = require('../package.json')
+
+function parseArgs (argv) {
+  let args = {
+    duration: 5000,
+    output: path.join(__dirname, 'result.json'),
+    filter: '',
+    check: true
+  }
+  for (let i = 0; i < argv.length; ++i) {
+    switch (argv[i]) {
+      case '--duration':
+        args.duration = Number(argv[++i])
+        break
+      case '--output':
+        args.output = path.resolve(argv[++i])
+        break
+      case '--filter':
+        args.filter = argv[++i]
+        break
+      case '--no-check':
+        args.check = false
+        break
+      default:
+        throw new Error(`Unknown argument ${argv[i]}`)
+    }
+  }
+  return args
+}
+
+function scenarios (args) {
+  const md = path.join(__dirname, 'md.bench.js')
+  const td = path.join(__dirname, 'td.bench.js')
+  const warmup = 500
+
+  return [{
+    /* 不限速推送, 测量可持续的行情吞吐 */
+    name: 'md-throughput',
+    file: md,
+    scenario: 'depthMarketData',
+    env: { CTP_MOCK_TICK_RATE: '0' },
+    options: { duration: args.duration, warmup }
+  }, {
+    name: 'md-throughput-batch',
+    file: md,
+    scenario: 'depthMarketData',
+    env: { CTP_MOCK_TICK_RATE: '0' },
+    options: { duration: args.duration, warmup, batch: true }
+  }, {
+    /* 固定速率推送, 测量未饱和时的行情延迟 */
+    name: 'md-latency',
+    file: md,
+    scenario: 'depthMarketData',
+    env: { CTP_MOCK_TICK_RATE: '20000' },
+    options: { duration: args.duration, warmup }
+  }, {
+    name: 'td-order-insert',
+    file: td,
+    scenario: 'orderInsert',
+    env: { CTP_MOCK_FILL: '1' },
+    options: { orders: 5000, warmup: 500 }
+  }, {
+    name: 'td-order-insert-sync',
+    file: td,
+    scenario: 'orderInsert',
+    env: { CTP_MOCK_FILL: '1' },
+    options: { orders: 5000, warmup: 500, syncRequest: true }
+  }].filter((item) => item.name.indexOf(args.filter) >= 0)
+}
+
+function run (item) {
+  return new Promise((resolve, reject) => {
+    const child = fork(item.file, [item.scenario, JSON.stringify(item.options)], {
+      env: Object.assign({}, process.env, { CTP_MOCK_SEED: '1' }, item.env)
+    })
+    let message = null
+    child.on('message', (msg) => {
+      message = msg
+    })
+    child.on('exit', (code) => {
+      if (message && message.result) {
+        resolve(message.result)
+      } else {
+        reject(new Error(`${item.name}: ${message ? message.error : `exited with code ${code}`}`))
+      }
+    })
+  })
+}
+
+/**
+ * 与package.json中的benchmark目标比较
+ * @remark 目标的键为"场景名.指标路径", 值为{min}或{max}, 可附加advisory
+ * @return 未达到的目标
+ */
+function check (results, targets) {
+  let failures = []
+  for (let key of Object.keys(targets)) {
+    const [name, ...fields] = key.split('.')
+    if (!results[name]) {
+      continue
+    }
+
+    let value = results[name]
+    for (let field of fields) {
+      value = value == null ? undefined : value[field]
+    }
+
+    const target = targets[key]
+    if (typeof value !== 'number' ||
+        (target.min !== undefined && value < target.min) ||
+        (target.max !== undefined && value > target.max)) {
+      failures.push({ key, value, target })
+    }
+  }
+  return failures
+}
+
+async function main () {
+  const args = parseArgs(process.argv.slice(2))
+  let results = {}
+
+  for (let item of scenarios(args)) {
+    console.log(`running ${item.name} ...`)
+    results[item.name] = await run(item)
+    console.log(JSON.stringify(results[item.name]))
+  }
+
+  const failures = args.check ? check(results, pkg.benchmark || {}) : []
+  const regressions = failures.filter((item) => !item.target.advisory)
+  const warnings = failures.filter((item) => item.target.advisory)
+  const report = {
+    version: pkg.version,
+    node: process.version,
+    platform: `${os.platform()}-${os.arch()}`,
+    cpus: os.cpus().length,
+    date: new Date().toISOString(),
+    results,
+    regressions,
+    warnings
+  }
+  fs.writeFileSync(args.output, JSON.stringify(report, null, 2) + '\n')
+  console.log(`results written to ${args.output}`)
+
+  for (let item of warnings) {
+    console.warn(`warning: ${item.key} = ${item.value}, advisory target ${JSON.stringify(item.target)}`)
+  }
+  for (let item of regressions) {
+    console.error(`regression: ${item.key} = ${item.value}, target ${JSON.stringify(item.target)}`)
+  }
+  process.exitCode = regressions.length ? 1 : 0
+}
+
+if (require.main === module) {
+  main().catch((err) => {
+    console.error(err.message)
+    process.exitCode = 1
+  })
+}
@@ -0,0 +1,108 @@
+'use strict'
+
+const ctp = require('../lib/index')
+const {
+  INSTRUMENTS,
+  MOCK_FRONT,
+  sleep,
+  round,
+  histogramToUs,
+  ResourceMonitor,
+  runScenario
+} = require('./common')
+
+class BenchMd extends ctp.CtpMd {
+  constructor (options) {
+    super(false, options)
+    this.ticks = 0
+    this._ready = new Promise((resolve) => {
+      this._resolveReady = resolve
+    })
+  }
+
+  async onFrontConnected () {
+    await this.reqUserLogin({}, 1)
+  }
+
+  async onRspUserLogin () {
+    await this.subscribeMarketData(INSTRUMENTS)
+  }
+
+  onRtnDepthMarketData (data) {
+    if (this.ticks++ === 0) {
+      this._resolveReady()
+    }
+  }
+}
+
+/**
+ * 行情推送压测
+ * @param options.duration 测量时长(毫秒)
+ * @param options.warmup 预热时长(毫秒)
+ * @param options.batch 是否开启批量事件模式
+ * @param options.transport 行情传输方式{udp, multicast}
+ */
+async function depthMarketData (options) {
+  const md = new BenchMd({ queueCapacity: options.queueCapacity })
+  if (options.batch) {
+    md.enableBatch()
+  }
+
+  await md.createFtdcMdApi('/tmp/node_ctp_bench_md@', options.transport)
+  if (await md.getApiVersion() !== 'mock') {
+    throw new Error('请先执行npm run build:mock链接模拟前置机')
+  }
+  await md.registerFront(MOCK_FRONT)
+  await md.init()
+
+  await md._ready
+  await sleep(options.warmup)
+
+  const monitor = new ResourceMonitor()
+  md.getStats({ reset: true })
+  md.ticks = 0
+  monitor.start()
+  const begin = process.hrtime()
+
+  await sleep(options.duration)
+
+  const [sec, nsec] = process.hrtime(begin)
+  const elapsed = sec + nsec / 1e9
+  const ticks = md.ticks
+  /* 行情延迟按传输方式分别统计, 压测只使用一种传输方式 */
+  const transports = md.getStats().RtnDepthMarketData || {}
+  const transport = Object.keys(transports)[0]
+  const stats = transports[transport] || {}
+  const resources = monitor.stop()
+  const queue = md.getQueueStats()
+  const intern = ctp.getInternStats()
+
+  await md.exit()
+
+  return Object.assign({
+    duration: round(elapsed),
+    ticks,
+    ticksPerSecond: Math.round(ticks / elapsed),
+    transport,
+    /* SPI线程收到行情->onRtnDepthMarketData执行完毕 */
+    tickLatency: histogramToUs(stats.total),
+    /* SPI线程收到行情->主线程开始处理 */
+    queueLatency: histogramToUs(stats.queue),
+    convert: histogramToUs(stats.convert),
+    handler: histogramToUs(stats.handler),
+    queue: {
+      highWater: queue.highWater,
+      dropped: queue.dropped,
+      blocked: queue.blocked
+    },
+    intern: {
+      size: intern.size,
+      hits: intern.hits,
+      misses: intern.misses
+    }
+  }, resources)
+}
+
+if (require.main === module) {
+  runScenario({ depthMarketData })
+}
@@ -0,0 +1,131 @@
+'use strict'
+
+const ctp = require('../lib/index')
+const {
+  INSTRUMENTS,
+  MOCK_FRONT,
+  now,
+  round,
+  samplesToUs,
+  ResourceMonitor,
+  runScenario
+} = require('./common')
+
+const DEFINE = ctp.DEFINE_MAP
+
+class BenchTd extends ctp.CtpTd {
+  constructor (options) {
+    super(false, options)
+    this._pending = null
+    this._ready = new Promise((resolve) => {
+      this._resolveReady = resolve
+    })
+  }
+
+  async onFrontConnected () {
+    await this.reqUserLogin({ BrokerID: '9999', UserID: 'bench' }, 1)
+  }
+
+  onRspUserLogin () {
+    this._resolveReady()
+  }
+
+  onRtnOrder (data) {
+    const pending = this._pending
+    if (pending && !pending.order && data.OrderRef === pending.ref) {
+      pending.order = now()
+    }
+  }
+
+  onRtnTrade (data) {
+    const pending = this._pending
+    if (pending && data.OrderRef === pending.ref) {
+      pending.trade = now()
+      this._pending = null
+      pending.resolve()
+    }
+  }
+
+  /**
+   * 报单并等待成交回报
+   * @return 报单时间与收到回报的时间(纳秒)
+   */
+  insertOrder (ref, requestId) {
+    return new Promise((resolve, reject) => {
+      const pending = { ref, begin: now(), order: 0, trade: 0 }
+      pending.resolve = () => resolve(pending)
+      this._pending = pending
+      this.reqOrderInsert({
+        BrokerID: '9999',
+        InvestorID: 'bench',
+        InstrumentID: INSTRUMENTS[requestId % INSTRUMENTS.length],
+        OrderRef: ref,
+        OrderPriceType: DEFINE.THOST_FTDC_OPT_LimitPrice,
+        Direction: DEFINE.THOST_FTDC_D_Buy,
+        CombOffsetFlag: DEFINE.THOST_FTDC_OF_Open,
+        CombHedgeFlag: DEFINE.THOST_FTDC_HF_Speculation,
+        LimitPrice: 3900,
+        VolumeTotalOriginal: 1,
+        TimeCondition: DEFINE.THOST_FTDC_TC_GFD,
+        VolumeCondition: DEFINE.THOST_FTDC_VC_AV,
+        MinVolume: 1,
+        ContingentCondition: DEFINE.THOST_FTDC_CC_Immediately,
+        ForceCloseReason: DEFINE.THOST_FTDC_FCC_NotForceClose
+      }, requestId).catch(reject)
+    })
+  }
+}
+
+/**
+ * 报单往返延迟压测, 逐笔报单, 收到成交回报后再发出下一笔
+ * @param options.orders 报单笔数
+ * @param options.warmup 预热报单笔数
+ * @param options.syncRequest 是否同步提交请求
+ */
+async function orderInsert (options) {
+  const td = new BenchTd({ syncRequest: options.syncRequest })
+  await td.createFtdcTraderApi('/tmp/node_ctp_bench_td@')
+  if (await td.getApiVersion() !== 'mock') {
+    throw new Error('请先执行npm run build:mock链接模拟前置机')
+  }
+  await td.registerFront(MOCK_FRONT)
+  await td.init()
+  await td._ready
+
+  let ref = 0
+  for (let i = 0; i < options.warmup; ++i) {
+    await td.insertOrder(String(++ref), ref)
+  }
+
+  const rtnOrder = []
+  const rtnTrade = []
+  const monitor = new ResourceMonitor()
+  monitor.start()
+  const begin = process.hrtime()
+
+  for (let i = 0; i < options.orders; ++i) {
+    const sample = await td.insertOrder(String(++ref), ref)
+    rtnOrder.push(sample.order - sample.begin)
+    rtnTrade.push(sample.trade - sample.begin)
+  }
+
+  const [sec, nsec] = process.hrtime(begin)
+  const elapsed = sec + nsec / 1e9
+  const resources = monitor.stop()
+
+  await td.exit()
+
+  return Object.assign({
+    duration: round(elapsed),
+    orders: options.orders,
+    ordersPerSecond: Math.round(options.orders / elapsed),
+    /* reqOrderInsert->首个onRtnOrder */
+    rtnOrder: samplesToUs(rtnOrder),
+    /* reqOrderInsert->onRtnTrade */
+    rtnTrade: samplesToUs(rtnTrade)
+  }, resources)
+}
+
+if (require.main === module) {
+  runScenario({ orderInsert })
+}
@@ -1,4 +1,8 @@
 {
+    'variables': {
+        # 为1时链接misc/mock_front下的离线模拟前置机, 替代CTP动态库
+        'ctp_mock%': 0,
+    },
     'targets': [{
         'target_name':
         'node_ctp',
@@ -6,12 +10,26 @@
             'src/addon.cc',
             'src/ctp_md.cc',
             'src/ctp_td.cc',
+            'src/gbk_table.cc',
+            'src/struct_convert.cc',
         ],
         'include_dirs': [
             '<(module_root_dir)/ctp_api/include',
         ],
         'conditions': [[
-            'OS=="linux"', {
+            'ctp_mock==1', {
+                'sources': [
+                    'misc/mock_front/mock_md_api.cc',
+                    'misc/mock_front/mock_trader_api.cc',
+                ],
+            }
+        ], [
+            'OS=="linux" and ctp_mock==1', {
+                'cflags': ['-std=c++11', '-pthread'],
+                'ldflags': ['-pthread'],
+            }
+        ], [
+            'OS=="linux" and ctp_mock==0', {
                 'cflags': ['-std=c++11'],
                 'libraries': [
                     '<(module_root_dir)/ctp_api/lib/libthostmduserapi.so',
@@ -1,7 +1,21 @@
 'use strict'
 
+const nodeCtp = require('../build/Release/node_ctp.node')
+
 module.exports = {
   CtpMd: require('./md').CtpMd,
   CtpTd: require('./td').CtpTd,
-  DEFINE_MAP: require('./define')
+  TickRing: require('./tick').TickRing,
+  DEFINE_MAP: require('./define'),
+  /**
+   * 设置常用字段(合约代码, 交易所代码, 日期等)的字符串驻留表容量, 默认8192
+   * @remark 已驻留的字符串被清空, 表满后新出现的取值不再驻留.
+   * 驻留表按线程保存, 只影响调用所在的主线程或worker线程
+   */
+  setInternCapacity: nodeCtp.setInternCapacity,
+  /**
+   * 读取字符串驻留表统计计数
+   * @return {capacity, size, hits, misses, overflow}
+   */
+  getInternStats: nodeCtp.getInternStats
 }
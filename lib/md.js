@@ -1,8 +1,7 @@
 'use strict'
 
 const nodeCtp = require('../build/Release/node_ctp.node')
-const iconv = require('iconv-lite')
-iconv.skipDecodeWarning = true
+const { TickRing } = require('./tick')
 
 /**
  * 封装C++层CtpMd类, 实现:
@@ -16,10 +15,33 @@ class CtpMd extends nodeCtp.CtpMd {
   /**
    * CtpMd构造函数
    * @param {bool} enableLog 是否输出SPI函数日志
+   * @param {Object} options 可选参数
+   * @param {number} options.queueCapacity SPI事件队列容量, 向上取整为2的幂, 默认65536
+   * @param {string} options.queueOverflow 队列满时的处理策略, 默认'block'
+   *   'block': SPI线程等待主线程消费, 不丢弃事件
+   *   'dropOldest': 丢弃队列中最早的事件
+   *   'dropNewest': 丢弃新到达的事件
+   * @param {bool} options.syncRequest 是否在主线程中同步提交req*请求, 默认false.
+   *   开启后请求不经过libuv线程池, 按调用顺序提交, 返回的Promise立即以CTP返回值完成
+   * @param {number} options.poolCapacity SPI响应对象池每个尺寸等级保留的空闲对象数, 默认4096
+   * @param {bool} options.timestamp 是否为深度行情附加Timestamp字段, 默认false.
+   *   值为行情时间的UTC毫秒时间戳, 已处理夜盘ActionDay, 零拷贝行情记录中始终包含该字段
+   * @param {string} options.invalidPrice 深度行情中无效价格(DBL_MAX)的处理方式, 默认'keep'
+   *   'keep': 保留DBL_MAX
+   *   'nan': 转换为NaN
+   *   'skip': 不设置该属性, 零拷贝行情记录中与'nan'相同
+   *   零拷贝行情记录中始终以Valid有效位标记各价格字段是否有效
+   * @param {bool} options.deltas 是否为逐条推送的深度行情附加LastVolume/LastTurnover/OIChange字段, 默认false.
+   *   值为相对同一合约上一条推送行情的成交量/成交金额/持仓量增量, 由C++层按合约维护基准,
+   *   零拷贝行情记录中同样填写这些字段
+   * @param {number} options.deltaCapacity 计算增量时可容纳的合约数, 默认4096
+   * @param {number} options.subscribeChunk setSubscriptions每次发送的订阅请求最多包含的合约数, 默认100
+   * @param {number} options.subscribeInterval setSubscriptions分块发送订阅请求的间隔(毫秒), 默认10
    */
-  constructor (enableLog = false) {
-    super()
+  constructor (enableLog = false, options = {}) {
+    super(options)
 
+    this._events = new Map()
     this._initEvent()
     this._enableLog = enableLog
   }
@@ -32,11 +54,16 @@ class CtpMd extends nodeCtp.CtpMd {
   /**
    * 创建MdApi
    * @param flowPath 存贮订阅信息文件的目录, 默认为当前目录
+   * @param options 传输方式
+   * @param options.udp 是否使用UDP行情
+   * @param options.multicast 是否使用组播行情, 组播基于UDP
    * @return 创建出的UserApi
+   * @remark 传输方式需与期货公司提供的行情前置一致, 行情延迟按送达的传输方式
+   * 分别统计, 见getStats().RtnDepthMarketData.{tcp, udp, multicast, replay}
    */
-  async createFtdcMdApi (flowPath) {
+  async createFtdcMdApi (flowPath, options = {}) {
     return new Promise((resolve, reject) => {
-      super.createFtdcMdApi(flowPath, (err) => {
+      super.createFtdcMdApi(flowPath, options, (err) => {
         err ? reject(err) : resolve()
       })
     })
@@ -184,9 +211,12 @@ class CtpMd extends nodeCtp.CtpMd {
    */
   async reqUserLogin (reqUserLoginField, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqUserLogin(reqUserLoginField, requestID, (err, data) => {
+      const ret = super.reqUserLogin(reqUserLoginField, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -195,59 +225,252 @@ class CtpMd extends nodeCtp.CtpMd {
    */
   async reqUserLogout (userLogout, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqUserLogout(userLogout, requestID, (err, data) => {
+      const ret = super.reqUserLogout(userLogout, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
+  /**
+   * 开启零拷贝行情模式
+   * @param capacity 环形缓冲区可容纳的行情记录条数, 向上取整为2的幂
+   * @return TickRing实例
+   * @remark 开启后深度行情不再回调onRtnDepthMarketData,
+   * 而是由SPI线程直接写入环形缓冲区, 每次唤醒时回调onRtnDepthMarketDataRing
+   */
+  enableTickRing (capacity = 16384) {
+    let begin = 0
+    const ring = new TickRing(super.enableTickRing(capacity, (end) => {
+      this.onRtnDepthMarketDataRing(ring, begin, end)
+      begin = end
+    }))
+    return ring
+  }
+
+  /**
+   * 开启最新行情快照表, 开启后可通过getSnapshot/getSnapshots读取合约的最新行情
+   * @param capacity 可容纳的合约数
+   * @param conflate 是否开启合并推送模式
+   * @remark 合并推送模式下深度行情不再回调onRtnDepthMarketData,
+   * 每次唤醒时以发生变更的合约代码回调onRtnDepthMarketDataChanged
+   */
+  enableSnapshot (capacity = 4096, conflate = false) {
+    if (conflate) {
+      super.enableSnapshot(capacity, (instrumentIds) => {
+        this.onRtnDepthMarketDataChanged(instrumentIds)
+      })
+    } else {
+      super.enableSnapshot(capacity)
+    }
+  }
+
+  /**
+   * 开启C++层K线聚合, 由SPI线程直接将深度行情聚合为K线, 每次唤醒时以K线数组回调onRtnBar
+   * @param intervals 默认周期(秒)数组, 0表示整个交易日, 最多4个, 如[1, 60, 0]
+   * @param options 可选参数
+   * @param {number} options.capacity 可容纳的合约数, 默认4096
+   * @param {bool} options.updates 是否同时推送正在聚合的K线(Closed为false), 默认false
+   * @param {bool} options.ticks 是否继续回调onRtnDepthMarketData, 默认false
+   * @remark 成交量/成交金额由累计值相减得到, 开启后每个合约的第一条行情只作为基准.
+   *   K线在该合约下一个周期的首条行情到达时完成
+   */
+  enableBars (intervals = [60], options = {}) {
+    super.enableBars(intervals, options, (bars) => {
+      this.onRtnBar(bars)
+    })
+  }
+
+  /**
+   * 设置K线周期
+   * @param intervals 周期(秒)数组, 0表示整个交易日
+   * @param instrumentIds 可选, 合约代码数组, 省略时设置默认周期
+   */
+  setBarIntervals (intervals, instrumentIds) {
+    super.setBarIntervals(intervals, instrumentIds)
+  }
+
+  /**
+   * 开启批量事件模式, 每次唤醒主线程时事件以数组形式一次性传入Node层,
+   * 再依次分发到对应的on*函数
+   * @param maxBatch 单批最大事件数
+   * @param maxLatency 单次唤醒处理事件的时间预算(微秒), 超出后让出事件循环
+   */
+  enableBatch (maxBatch = 256, maxLatency = 1000) {
+    super.enableBatch(maxBatch, maxLatency, (events) => {
+      for (let event of events) {
+        this._events.get(event[0])(event[1], event[2], event[3], event[4])
+      }
+    })
+  }
+
+  /**
+   * 设置事件的字段投影, 之后该事件的回调数据只包含选中的字段
+   * @param event 事件名, 支持RtnDepthMarketData
+   * @param fields 字段名数组, 为空数组时恢复转换全部字段
+   * @remark 字段名不存在时抛出TypeError. 例如:
+   *   this.setFields('RtnDepthMarketData', ['InstrumentID', 'LastPrice', 'Volume'])
+   */
+  setFields (event, fields = []) {
+    super.setFields(event, fields)
+  }
+
+  /**
+   * 添加SPI事件监听函数, 与on*函数互不影响
+   * @param event 事件名, 如'RtnDepthMarketData'
+   * @param callback 监听函数, 参数与对应的on*函数相同
+   * @param instrumentIds 可选, 合约代码数组, 只接收这些合约的事件
+   * @return 监听函数ID, 用于removeListener
+   * @remark 同一事件的全部监听函数共享一次转换出的数据对象, 不要在监听函数中修改.
+   *   合约过滤在C++层转换之前进行
+   */
+  addListener (event, callback, instrumentIds) {
+    return super.addListener(event, callback, instrumentIds)
+  }
+
+  /**
+   * 移除SPI事件监听函数
+   * @param id addListener返回的监听函数ID
+   * @return 监听函数不存在时返回false
+   */
+  removeListener (id) {
+    return super.removeListener(id)
+  }
+
+  /**
+   * 开启深度行情按合约路由, 开启后深度行情只传递给addListener指定了该合约的监听函数,
+   * 不再回调onRtnDepthMarketData. 没有监听函数的合约行情不会转换为JS对象
+   * @param enabled 为false时关闭
+   */
+  enableRouting (enabled = true) {
+    super.enableRouting(enabled)
+  }
+
+  /**
+   * 设置行情订阅集合, 由C++层与当前集合比较后只订阅新增合约并退订移出的合约,
+   * 请求按options.subscribeChunk分块发送. 断线重连并登录成功后自动重新订阅整个集合
+   * @param instrumentIds 合约代码数组
+   * @return {added, removed}
+   * @remark 与subscribeMarketData互相独立, 重连后的首条行情延迟见getSubscriptions
+   */
+  setSubscriptions (instrumentIds = []) {
+    return super.setSubscriptions(instrumentIds)
+  }
+
+  /**
+   * 加入行情订阅集合
+   * @param instrumentIds 合约代码数组
+   * @return 新加入集合的合约个数
+   */
+  addSubscriptions (instrumentIds = []) {
+    return super.addSubscriptions(instrumentIds)
+  }
+
+  /**
+   * 移出行情订阅集合
+   * @param instrumentIds 合约代码数组
+   * @return 移出集合的合约个数
+   */
+  removeSubscriptions (instrumentIds = []) {
+    return super.removeSubscriptions(instrumentIds)
+  }
+
+  /**
+   * 读取行情订阅集合状态
+   * @param reset 是否在读取后清空首条行情延迟统计
+   * @return {loggedIn, pending, latency, instruments}, instruments为{合约代码: {state, latency}},
+   *   latency为连接建立(或加入集合)到收到首条行情的纳秒数
+   */
+  getSubscriptions (reset = false) {
+    return super.getSubscriptions({ reset })
+  }
+
+  /**
+   * 开始记录SPI事件二进制日志, 由C++层SPI线程将深度行情的原始CTP结构体
+   * 写入内存映射的段文件, 不占用JS主线程
+   * @param path 段文件路径前缀, 段文件名为<path>.<段序号>.jnl, 从第一个不存在的段序号开始
+   * @param segmentSize 段文件长度(字节), 写满后创建下一个段
+   */
+  startJournal (path, segmentSize = 64 * 1024 * 1024) {
+    super.startJournal(path, segmentSize)
+  }
+
+  /**
+   * 停止记录SPI事件二进制日志
+   */
+  stopJournal () {
+    super.stopJournal()
+  }
+
+  /**
+   * 回放startJournal记录的SPI事件日志, 事件按实盘相同的路径分发到on*函数
+   * @param path 段文件路径前缀
+   * @param speed 回放倍速, 1为按记录的事件间隔, 0为尽快回放
+   * @return Promise, 回放结束且事件全部处理后完成, 值为回放的事件数
+   * @remark 回放与实盘API共用事件队列, 回放期间调用create*Api抛出异常, 创建API后不能再回放
+   */
+  replay (path, speed = 0) {
+    return new Promise((resolve, reject) => {
+      super.replay(path, speed, (count) => {
+        resolve(count)
+      })
+    })
+  }
+
+  /**
+   * 停止回放, 尚未处理的事件被丢弃, replay返回的Promise随后完成
+   */
+  stopReplay () {
+    super.stopReplay()
+  }
+
   /* ---------------------------------------------------------------------------
    * SPI函数
    * ---------------------------------------------------------------------------
    */
 
+  _on (event, callback) {
+    this._events.set(event, callback)
+    super.on(event, callback)
+  }
+
   _initEvent () {
-    super.on('FrontConnected', () => {
+    this._on('FrontConnected', () => {
       this.onFrontConnected()
     })
-    super.on('FrontDisconnected', (reason) => {
+    this._on('FrontDisconnected', (reason) => {
       this.onFrontDisconnected(reason)
     })
-    super.on('HeartBeatWarning', (timeLapse) => {
+    this._on('HeartBeatWarning', (timeLapse) => {
       this.onHeartBeatWarning(timeLapse)
     })
-    super.on('RspUserLogin', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUserLogin', (data, info, requestId, isLast) => {
       this.onRspUserLogin(data, info, requestId, isLast)
     })
-    super.on('RspUserLogout', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUserLogout', (data, info, requestId, isLast) => {
       this.onRspUserLogout(data, info, requestId, isLast)
     })
-    super.on('RspError', (info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspError', (info, requestId, isLast) => {
       this.onRspError(info, requestId, isLast)
     })
-    super.on('RspSubMarketData', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspSubMarketData', (data, info, requestId, isLast) => {
       this.onRspSubMarketData(data, info, requestId, isLast)
     })
-    super.on('RspUnSubMarketData', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUnSubMarketData', (data, info, requestId, isLast) => {
       this.onRspUnSubMarketData(data, info, requestId, isLast)
     })
-    super.on('RspSubForQuoteRsp', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspSubForQuoteRsp', (data, info, requestId, isLast) => {
       this.onRspSubForQuoteRsp(data, info, requestId, isLast)
     })
-    super.on('RspUnSubForQuoteRsp', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUnSubForQuoteRsp', (data, info, requestId, isLast) => {
       this.onRspUnSubForQuoteRsp(data, info, requestId, isLast)
     })
-    super.on('RtnDepthMarketData', (data) => {
+    this._on('RtnDepthMarketData', (data) => {
       this.onRtnDepthMarketData(data)
     })
-    super.on('RtnForQuoteRsp', (data) => {
+    this._on('RtnForQuoteRsp', (data) => {
       this.onRtnForQuoteRsp(data)
     })
   }
@@ -342,6 +565,37 @@ class CtpMd extends nodeCtp.CtpMd {
     this._emitLog('OnRtnDepthMarketData', data)
   }
 
+  /**
+   * 零拷贝模式深度行情通知
+   * @param ring TickRing实例
+   * @param begin 本次新增记录的起始序号
+   * @param end 本次新增记录的结束序号(不含), 序号按uint32回绕
+   * @remark 两次通知之间写入的记录超过缓冲区容量时, 较早的记录已被覆盖,
+   * ring.at()对这些记录返回null
+   */
+  onRtnDepthMarketDataRing (ring, begin, end) {
+    this._emitLog('OnRtnDepthMarketDataRing', begin, end)
+  }
+
+  /**
+   * 合并推送模式深度行情通知
+   * @param instrumentIds 上次通知后行情发生变更的合约代码数组,
+   * 最新行情通过getSnapshot读取
+   */
+  onRtnDepthMarketDataChanged (instrumentIds) {
+    this._emitLog('OnRtnDepthMarketDataChanged', instrumentIds)
+  }
+
+  /**
+   * K线通知
+   * @param bars K线数组, 每项为{InstrumentID, TradingDay, Interval, StartTime, EndTime,
+   *   OpenPrice, HighestPrice, LowestPrice, ClosePrice, Volume, Turnover, OpenInterest,
+   *   TickCount, Closed}, 时间为UTC毫秒时间戳
+   */
+  onRtnBar (bars) {
+    this._emitLog('OnRtnBar', bars)
+  }
+
   /**
    * 询价通知
    */
@@ -1,8 +1,6 @@
 'use strict'
 
 const nodeCtp = require('../build/Release/node_ctp.node')
-const iconv = require('iconv-lite')
-iconv.skipDecodeWarning = true
 
 /**
  * 封装C++层CtpTd类, 实现:
@@ -16,10 +14,20 @@ class CtpTd extends nodeCtp.CtpTd {
   /**
    * CtpTd构造函数
    * @param {bool} enableLog 是否输出SPI函数日志
-   */
-  constructor (enableLog = false) {
-    super()
-
+   * @param {Object} options 可选参数
+   * @param {number} options.queueCapacity SPI事件队列容量, 向上取整为2的幂, 默认65536
+   * @param {string} options.queueOverflow 队列满时的处理策略, 默认'block'
+   *   'block': SPI线程等待主线程消费, 不丢弃事件
+   *   'dropOldest': 丢弃队列中最早的事件
+   *   'dropNewest': 丢弃新到达的事件
+   * @param {bool} options.syncRequest 是否在主线程中同步提交req*请求, 默认false.
+   *   开启后请求不经过libuv线程池, 按调用顺序提交, 返回的Promise立即以CTP返回值完成
+   * @param {number} options.poolCapacity SPI响应对象池每个尺寸等级保留的空闲对象数, 默认4096
+   */
+  constructor (enableLog = false, options = {}) {
+    super(options)
+
+    this._events = new Map()
     this._initEvent()
     this._enableLog = enableLog
   }
@@ -168,9 +176,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqAuthenticate (reqAuthenticateField, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqAuthenticate(reqAuthenticateField, requestID, (err, data) => {
+      const ret = super.reqAuthenticate(reqAuthenticateField, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -179,9 +190,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqUserLogin (reqUserLoginField, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqUserLogin(reqUserLoginField, requestID, (err, data) => {
+      const ret = super.reqUserLogin(reqUserLoginField, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -190,9 +204,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqUserLogout (userLogout, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqUserLogout(userLogout, requestID, (err, data) => {
+      const ret = super.reqUserLogout(userLogout, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -201,10 +218,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqUserPasswordUpdate (userPasswordUpdate, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqUserPasswordUpdate(userPasswordUpdate, requestID, (err,
+      const ret = super.reqUserPasswordUpdate(userPasswordUpdate, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -226,9 +246,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqOrderInsert (inputOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqOrderInsert(inputOrder, requestID, (err, data) => {
+      const ret = super.reqOrderInsert(inputOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -237,9 +260,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqParkedOrderInsert (parkedOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqParkedOrderInsert(parkedOrder, requestID, (err, data) => {
+      const ret = super.reqParkedOrderInsert(parkedOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -248,10 +274,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqParkedOrderAction (parkedOrderAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqParkedOrderAction(parkedOrderAction, requestID, (err,
+      const ret = super.reqParkedOrderAction(parkedOrderAction, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -260,9 +289,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqOrderAction (inputOrderAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqOrderAction(inputOrderAction, requestID, (err, data) => {
+      const ret = super.reqOrderAction(inputOrderAction, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -271,10 +303,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQueryMaxOrderVolume (queryMaxOrderVolume, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQueryMaxOrderVolume(queryMaxOrderVolume, requestID, (err,
+      const ret = super.reqQueryMaxOrderVolume(queryMaxOrderVolume, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -283,10 +318,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqSettlementInfoConfirm (settlementInfoConfirm, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqSettlementInfoConfirm(settlementInfoConfirm, requestID,
+      const ret = super.reqSettlementInfoConfirm(settlementInfoConfirm, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -295,10 +333,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqRemoveParkedOrder (removeParkedOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqRemoveParkedOrder(removeParkedOrder, requestID, (err,
+      const ret = super.reqRemoveParkedOrder(removeParkedOrder, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -319,9 +360,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqExecOrderInsert (inputExecOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqExecOrderInsert(inputExecOrder, requestID, (err, data) => {
+      const ret = super.reqExecOrderInsert(inputExecOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -330,10 +374,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqExecOrderAction (inputExecOrderAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqExecOrderAction(inputExecOrderAction, requestID, (err,
+      const ret = super.reqExecOrderAction(inputExecOrderAction, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -342,9 +389,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqForQuoteInsert (inputForQuote, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqForQuoteInsert(inputForQuote, requestID, (err, data) => {
+      const ret = super.reqForQuoteInsert(inputForQuote, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -353,9 +403,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQuoteInsert (inputQuote, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQuoteInsert(inputQuote, requestID, (err, data) => {
+      const ret = super.reqQuoteInsert(inputQuote, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -364,9 +417,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQuoteAction (inputQuoteAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQuoteAction(inputQuoteAction, requestID, (err, data) => {
+      const ret = super.reqQuoteAction(inputQuoteAction, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -375,9 +431,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqLockInsert (inputLock, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqLockInsert(inputLock, requestID, (err, data) => {
+      const ret = super.reqLockInsert(inputLock, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -386,10 +445,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqBatchOrderAction (inputBatchOrderAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqBatchOrderAction(inputBatchOrderAction, requestID, (err,
+      const ret = super.reqBatchOrderAction(inputBatchOrderAction, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -398,9 +460,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqCombActionInsert (inputCombAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqCombActionInsert(inputCombAction, requestID, (err, data) => {
+      const ret = super.reqCombActionInsert(inputCombAction, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -409,9 +474,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryOrder (qryOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryOrder(qryOrder, requestID, (err, data) => {
+      const ret = super.reqQryOrder(qryOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -420,9 +488,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTrade (qryTrade, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTrade(qryTrade, requestID, (err, data) => {
+      const ret = super.reqQryTrade(qryTrade, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -431,10 +502,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryInvestorPosition (qryInvestorPosition, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryInvestorPosition(qryInvestorPosition, requestID, (err,
+      const ret = super.reqQryInvestorPosition(qryInvestorPosition, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -443,10 +517,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTradingAccount (qryTradingAccount, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTradingAccount(qryTradingAccount, requestID, (err,
+      const ret = super.reqQryTradingAccount(qryTradingAccount, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -455,9 +532,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryInvestor (qryInvestor, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryInvestor(qryInvestor, requestID, (err, data) => {
+      const ret = super.reqQryInvestor(qryInvestor, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -466,9 +546,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTradingCode (qryTradingCode, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTradingCode(qryTradingCode, requestID, (err, data) => {
+      const ret = super.reqQryTradingCode(qryTradingCode, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -501,9 +584,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryExchange (qryExchange, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryExchange(qryExchange, requestID, (err, data) => {
+      const ret = super.reqQryExchange(qryExchange, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -512,9 +598,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryProduct (qryProduct, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryProduct(qryProduct, requestID, (err, data) => {
+      const ret = super.reqQryProduct(qryProduct, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -523,9 +612,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryInstrument (qryInstrument, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryInstrument(qryInstrument, requestID, (err, data) => {
+      const ret = super.reqQryInstrument(qryInstrument, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -534,10 +626,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryDepthMarketData (qryDepthMarketData, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryDepthMarketData(qryDepthMarketData, requestID, (err,
+      const ret = super.reqQryDepthMarketData(qryDepthMarketData, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -546,10 +641,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQrySettlementInfo (qrySettlementInfo, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQrySettlementInfo(qrySettlementInfo, requestID, (err,
+      const ret = super.reqQrySettlementInfo(qrySettlementInfo, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -558,9 +656,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTransferBank (qryTransferBank, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTransferBank(qryTransferBank, requestID, (err, data) => {
+      const ret = super.reqQryTransferBank(qryTransferBank, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -581,9 +682,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryNotice (qryNotice, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryNotice(qryNotice, requestID, (err, data) => {
+      const ret = super.reqQryNotice(qryNotice, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -629,10 +733,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryEWarrantOffset (qryEWarrantOffset, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryEWarrantOffset(qryEWarrantOffset, requestID, (err,
+      const ret = super.reqQryEWarrantOffset(qryEWarrantOffset, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -654,10 +761,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryExchangeMarginRate (qryExchangeMarginRate, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryExchangeMarginRate(qryExchangeMarginRate, requestID,
+      const ret = super.reqQryExchangeMarginRate(qryExchangeMarginRate, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -678,9 +788,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryExchangeRate (qryExchangeRate, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryExchangeRate(qryExchangeRate, requestID, (err, data) => {
+      const ret = super.reqQryExchangeRate(qryExchangeRate, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -689,10 +802,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQrySecAgentACIDMap (qrySecAgentACIDMap, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQrySecAgentACIDMap(qrySecAgentACIDMap, requestID, (err,
+      const ret = super.reqQrySecAgentACIDMap(qrySecAgentACIDMap, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -701,10 +817,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryProductExchRate (qryProductExchRate, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryProductExchRate(qryProductExchRate, requestID, (err,
+      const ret = super.reqQryProductExchRate(qryProductExchRate, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -713,9 +832,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryProductGroup (qryProductGroup, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryProductGroup(qryProductGroup, requestID, (err, data) => {
+      const ret = super.reqQryProductGroup(qryProductGroup, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -773,10 +895,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryOptionInstrCommRate (qryOptionInstrCommRate, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryOptionInstrCommRate(qryOptionInstrCommRate, requestID,
+      const ret = super.reqQryOptionInstrCommRate(qryOptionInstrCommRate, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -785,9 +910,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryExecOrder (qryExecOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryExecOrder(qryExecOrder, requestID, (err, data) => {
+      const ret = super.reqQryExecOrder(qryExecOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -796,9 +924,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryForQuote (qryForQuote, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryForQuote(qryForQuote, requestID, (err, data) => {
+      const ret = super.reqQryForQuote(qryForQuote, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -807,9 +938,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryQuote (qryQuote, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryQuote(qryQuote, requestID, (err, data) => {
+      const ret = super.reqQryQuote(qryQuote, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -818,9 +952,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryLock (qryLock, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryLock(qryLock, requestID, (err, data) => {
+      const ret = super.reqQryLock(qryLock, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -829,9 +966,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryLockPosition (qryLockPosition, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryLockPosition(qryLockPosition, requestID, (err, data) => {
+      const ret = super.reqQryLockPosition(qryLockPosition, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -852,9 +992,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryInvestorLevel (qryInvestorLevel, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryInvestorLevel(qryInvestorLevel, requestID, (err, data) => {
+      const ret = super.reqQryInvestorLevel(qryInvestorLevel, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -863,9 +1006,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryExecFreeze (qryExecFreeze, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryExecFreeze(qryExecFreeze, requestID, (err, data) => {
+      const ret = super.reqQryExecFreeze(qryExecFreeze, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -874,10 +1020,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryCombInstrumentGuard (qryCombInstrumentGuard, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryCombInstrumentGuard(qryCombInstrumentGuard, requestID,
+      const ret = super.reqQryCombInstrumentGuard(qryCombInstrumentGuard, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -886,9 +1035,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryCombAction (qryCombAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryCombAction(qryCombAction, requestID, (err, data) => {
+      const ret = super.reqQryCombAction(qryCombAction, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -897,10 +1049,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTransferSerial (qryTransferSerial, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTransferSerial(qryTransferSerial, requestID, (err,
+      const ret = super.reqQryTransferSerial(qryTransferSerial, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -909,10 +1064,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryAccountregister (qryAccountregister, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryAccountregister(qryAccountregister, requestID, (err,
+      const ret = super.reqQryAccountregister(qryAccountregister, requestID, (err,
         data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -921,9 +1079,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryContractBank (qryContractBank, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryContractBank(qryContractBank, requestID, (err, data) => {
+      const ret = super.reqQryContractBank(qryContractBank, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -932,9 +1093,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryParkedOrder (qryParkedOrder, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryParkedOrder(qryParkedOrder, requestID, (err, data) => {
+      const ret = super.reqQryParkedOrder(qryParkedOrder, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -943,10 +1107,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryParkedOrderAction (qryParkedOrderAction, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryParkedOrderAction(qryParkedOrderAction, requestID, (
+      const ret = super.reqQryParkedOrderAction(qryParkedOrderAction, requestID, (
         err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -955,9 +1122,12 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryTradingNotice (qryTradingNotice, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryTradingNotice(qryTradingNotice, requestID, (err, data) => {
+      const ret = super.reqQryTradingNotice(qryTradingNotice, requestID, (err, data) => {
         err ? reject(err) : resolve(data)
       })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -966,10 +1136,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryBrokerTradingParams (qryBrokerTradingParams, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryBrokerTradingParams(qryBrokerTradingParams, requestID,
+      const ret = super.reqQryBrokerTradingParams(qryBrokerTradingParams, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -978,10 +1151,13 @@ class CtpTd extends nodeCtp.CtpTd {
    */
   async reqQryBrokerTradingAlgos (qryBrokerTradingAlgos, requestID) {
     return new Promise((resolve, reject) => {
-      super.reqQryBrokerTradingAlgos(qryBrokerTradingAlgos, requestID,
+      const ret = super.reqQryBrokerTradingAlgos(qryBrokerTradingAlgos, requestID,
         (err, data) => {
           err ? reject(err) : resolve(data)
         })
+      if (ret !== undefined) {
+        resolve(ret)
+      }
     })
   }
 
@@ -1034,462 +1210,461 @@ class CtpTd extends nodeCtp.CtpTd {
     })
   }
 
+  /**
+   * 开启批量事件模式, 每次唤醒主线程时事件以数组形式一次性传入Node层,
+   * 再依次分发到对应的on*函数
+   * @param maxBatch 单批最大事件数
+   * @param maxLatency 单次唤醒处理事件的时间预算(微秒), 超出后让出事件循环
+   */
+  enableBatch (maxBatch = 256, maxLatency = 1000) {
+    super.enableBatch(maxBatch, maxLatency, (events) => {
+      for (let event of events) {
+        this._events.get(event[0])(event[1], event[2], event[3], event[4])
+      }
+    })
+  }
+
+  /**
+   * 设置事件的字段投影, 之后该事件的回调数据只包含选中的字段
+   * @param event 事件名, 支持RtnOrder, RtnTrade
+   * @param fields 字段名数组, 为空数组时恢复转换全部字段
+   * @remark 字段名不存在时抛出TypeError. 例如:
+   *   this.setFields('RtnTrade', ['OrderRef', 'Price', 'Volume'])
+   */
+  setFields (event, fields = []) {
+    super.setFields(event, fields)
+  }
+
+  /**
+   * 添加SPI事件监听函数, 与on*函数互不影响
+   * @param event 事件名, 如'RtnTrade'
+   * @param callback 监听函数, 参数与对应的on*函数相同
+   * @param instrumentIds 可选, 合约代码数组, 只接收这些合约的事件
+   * @return 监听函数ID, 用于removeListener
+   * @remark 同一事件的全部监听函数共享一次转换出的数据对象, 不要在监听函数中修改.
+   *   合约过滤在C++层转换之前进行
+   */
+  addListener (event, callback, instrumentIds) {
+    return super.addListener(event, callback, instrumentIds)
+  }
+
+  /**
+   * 移除SPI事件监听函数
+   * @param id addListener返回的监听函数ID
+   * @return 监听函数不存在时返回false
+   */
+  removeListener (id) {
+    return super.removeListener(id)
+  }
+
+  /**
+   * 开始记录SPI事件二进制日志, 由C++层SPI线程将报单与成交回报的原始CTP结构体
+   * 写入内存映射的段文件, 不占用JS主线程
+   * @param path 段文件路径前缀, 段文件名为<path>.<段序号>.jnl, 从第一个不存在的段序号开始
+   * @param segmentSize 段文件长度(字节), 写满后创建下一个段
+   */
+  startJournal (path, segmentSize = 64 * 1024 * 1024) {
+    super.startJournal(path, segmentSize)
+  }
+
+  /**
+   * 停止记录SPI事件二进制日志
+   */
+  stopJournal () {
+    super.stopJournal()
+  }
+
+  /**
+   * 回放startJournal记录的SPI事件日志, 事件按实盘相同的路径分发到on*函数
+   * @param path 段文件路径前缀
+   * @param speed 回放倍速, 1为按记录的事件间隔, 0为尽快回放
+   * @return Promise, 回放结束且事件全部处理后完成, 值为回放的事件数
+   * @remark 回放与实盘API共用事件队列, 回放期间调用create*Api抛出异常, 创建API后不能再回放
+   */
+  replay (path, speed = 0) {
+    return new Promise((resolve, reject) => {
+      super.replay(path, speed, (count) => {
+        resolve(count)
+      })
+    })
+  }
+
+  /**
+   * 停止回放, 尚未处理的事件被丢弃, replay返回的Promise随后完成
+   */
+  stopReplay () {
+    super.stopReplay()
+  }
+
   /* ---------------------------------------------------------------------------
    * SPI函数
    * ---------------------------------------------------------------------------
    */
 
+  _on (event, callback) {
+    this._events.set(event, callback)
+    super.on(event, callback)
+  }
+
   _initEvent () {
-    super.on('FrontConnected', () => {
+    this._on('FrontConnected', () => {
       this.onFrontConnected()
     })
-    super.on('FrontDisconnected', (reason) => {
+    this._on('FrontDisconnected', (reason) => {
       this.onFrontDisconnected(reason)
     })
-    super.on('HeartBeatWarning', (timeLapse) => {
+    this._on('HeartBeatWarning', (timeLapse) => {
       this.onHeartBeatWarning(timeLapse)
     })
-    super.on('RspAuthenticate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspAuthenticate', (data, info, requestId, isLast) => {
       this.onRspAuthenticate(data, info, requestId, isLast)
     })
-    super.on('RspUserLogin', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUserLogin', (data, info, requestId, isLast) => {
       this.onRspUserLogin(data, info, requestId, isLast)
     })
-    super.on('RspUserLogout', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUserLogout', (data, info, requestId, isLast) => {
       this.onRspUserLogout(data, info, requestId, isLast)
     })
-    super.on('RspUserPasswordUpdate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspUserPasswordUpdate', (data, info, requestId, isLast) => {
       this.onRspUserPasswordUpdate(data, info, requestId, isLast)
     })
-    super.on('RspTradingAccountPasswordUpdate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspTradingAccountPasswordUpdate', (data, info, requestId, isLast) => {
       this.onRspTradingAccountPasswordUpdate(data, info, requestId, isLast)
     })
-    super.on('RspOrderInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspOrderInsert', (data, info, requestId, isLast) => {
       this.onRspOrderInsert(data, info, requestId, isLast)
     })
-    super.on('RspParkedOrderInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspParkedOrderInsert', (data, info, requestId, isLast) => {
       this.onRspParkedOrderInsert(data, info, requestId, isLast)
     })
-    super.on('RspParkedOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspParkedOrderAction', (data, info, requestId, isLast) => {
       this.onRspParkedOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspOrderAction', (data, info, requestId, isLast) => {
       this.onRspOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspQueryMaxOrderVolume', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQueryMaxOrderVolume', (data, info, requestId, isLast) => {
       this.onRspQueryMaxOrderVolume(data, info, requestId, isLast)
     })
-    super.on('RspSettlementInfoConfirm', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspSettlementInfoConfirm', (data, info, requestId, isLast) => {
       this.onRspSettlementInfoConfirm(data, info, requestId, isLast)
     })
-    super.on('RspRemoveParkedOrder', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspRemoveParkedOrder', (data, info, requestId, isLast) => {
       this.onRspRemoveParkedOrder(data, info, requestId, isLast)
     })
-    super.on('RspRemoveParkedOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspRemoveParkedOrderAction', (data, info, requestId, isLast) => {
       this.onRspRemoveParkedOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspExecOrderInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspExecOrderInsert', (data, info, requestId, isLast) => {
       this.onRspExecOrderInsert(data, info, requestId, isLast)
     })
-    super.on('RspExecOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspExecOrderAction', (data, info, requestId, isLast) => {
       this.onRspExecOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspForQuoteInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspForQuoteInsert', (data, info, requestId, isLast) => {
       this.onRspForQuoteInsert(data, info, requestId, isLast)
     })
-    super.on('RspQuoteInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQuoteInsert', (data, info, requestId, isLast) => {
       this.onRspQuoteInsert(data, info, requestId, isLast)
     })
-    super.on('RspQuoteAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQuoteAction', (data, info, requestId, isLast) => {
       this.onRspQuoteAction(data, info, requestId, isLast)
     })
-    super.on('RspLockInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspLockInsert', (data, info, requestId, isLast) => {
       this.onRspLockInsert(data, info, requestId, isLast)
     })
-    super.on('RspBatchOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspBatchOrderAction', (data, info, requestId, isLast) => {
       this.onRspBatchOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspCombActionInsert', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspCombActionInsert', (data, info, requestId, isLast) => {
       this.onRspCombActionInsert(data, info, requestId, isLast)
     })
-    super.on('RspQryOrder', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryOrder', (data, info, requestId, isLast) => {
       this.onRspQryOrder(data, info, requestId, isLast)
     })
-    super.on('RspQryTrade', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTrade', (data, info, requestId, isLast) => {
       this.onRspQryTrade(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestorPosition', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestorPosition', (data, info, requestId, isLast) => {
       this.onRspQryInvestorPosition(data, info, requestId, isLast)
     })
-    super.on('RspQryTradingAccount', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTradingAccount', (data, info, requestId, isLast) => {
       this.onRspQryTradingAccount(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestor', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestor', (data, info, requestId, isLast) => {
       this.onRspQryInvestor(data, info, requestId, isLast)
     })
-    super.on('RspQryTradingCode', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTradingCode', (data, info, requestId, isLast) => {
       this.onRspQryTradingCode(data, info, requestId, isLast)
     })
-    super.on('RspQryInstrumentMarginRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInstrumentMarginRate', (data, info, requestId, isLast) => {
       this.onRspQryInstrumentMarginRate(data, info, requestId, isLast)
     })
-    super.on('RspQryInstrumentCommissionRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInstrumentCommissionRate', (data, info, requestId, isLast) => {
       this.onRspQryInstrumentCommissionRate(data, info, requestId, isLast)
     })
-    super.on('RspQryExchange', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExchange', (data, info, requestId, isLast) => {
       this.onRspQryExchange(data, info, requestId, isLast)
     })
-    super.on('RspQryProduct', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryProduct', (data, info, requestId, isLast) => {
       this.onRspQryProduct(data, info, requestId, isLast)
     })
-    super.on('RspQryInstrument', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
-      data.InstrumentName = iconv.decode(data.InstrumentName, 'gbk')
+    this._on('RspQryInstrument', (data, info, requestId, isLast) => {
       this.onRspQryInstrument(data, info, requestId, isLast)
     })
-    super.on('RspQryDepthMarketData', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryDepthMarketData', (data, info, requestId, isLast) => {
       this.onRspQryDepthMarketData(data, info, requestId, isLast)
     })
-    super.on('RspQrySettlementInfo', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQrySettlementInfo', (data, info, requestId, isLast) => {
       this.onRspQrySettlementInfo(data, info, requestId, isLast)
     })
-    super.on('RspQryTransferBank', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTransferBank', (data, info, requestId, isLast) => {
       this.onRspQryTransferBank(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestorPositionDetail', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestorPositionDetail', (data, info, requestId, isLast) => {
       this.onRspQryInvestorPositionDetail(data, info, requestId, isLast)
     })
-    super.on('RspQryNotice', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryNotice', (data, info, requestId, isLast) => {
       this.onRspQryNotice(data, info, requestId, isLast)
     })
-    super.on('RspQrySettlementInfoConfirm', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQrySettlementInfoConfirm', (data, info, requestId, isLast) => {
       this.onRspQrySettlementInfoConfirm(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestorPositionCombineDetail', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestorPositionCombineDetail', (data, info, requestId, isLast) => {
       this.onRspQryInvestorPositionCombineDetail(data, info, requestId, isLast)
     })
-    super.on('RspQryCFMMCTradingAccountKey', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryCFMMCTradingAccountKey', (data, info, requestId, isLast) => {
       this.onRspQryCFMMCTradingAccountKey(data, info, requestId, isLast)
     })
-    super.on('RspQryEWarrantOffset', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryEWarrantOffset', (data, info, requestId, isLast) => {
       this.onRspQryEWarrantOffset(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestorProductGroupMargin', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestorProductGroupMargin', (data, info, requestId, isLast) => {
       this.onRspQryInvestorProductGroupMargin(data, info, requestId, isLast)
     })
-    super.on('RspQryExchangeMarginRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExchangeMarginRate', (data, info, requestId, isLast) => {
       this.onRspQryExchangeMarginRate(data, info, requestId, isLast)
     })
-    super.on('RspQryExchangeMarginRateAdjust', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExchangeMarginRateAdjust', (data, info, requestId, isLast) => {
       this.onRspQryExchangeMarginRateAdjust(data, info, requestId, isLast)
     })
-    super.on('RspQryExchangeRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExchangeRate', (data, info, requestId, isLast) => {
       this.onRspQryExchangeRate(data, info, requestId, isLast)
     })
-    super.on('RspQrySecAgentACIDMap', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQrySecAgentACIDMap', (data, info, requestId, isLast) => {
       this.onRspQrySecAgentACIDMap(data, info, requestId, isLast)
     })
-    super.on('RspQryProductExchRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryProductExchRate', (data, info, requestId, isLast) => {
       this.onRspQryProductExchRate(data, info, requestId, isLast)
     })
-    super.on('RspQryProductGroup', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryProductGroup', (data, info, requestId, isLast) => {
       this.onRspQryProductGroup(data, info, requestId, isLast)
     })
-    super.on('RspQryMMInstrumentCommissionRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryMMInstrumentCommissionRate', (data, info, requestId, isLast) => {
       this.onRspQryMMInstrumentCommissionRate(data, info, requestId, isLast)
     })
-    super.on('RspQryMMOptionInstrCommRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryMMOptionInstrCommRate', (data, info, requestId, isLast) => {
       this.onRspQryMMOptionInstrCommRate(data, info, requestId, isLast)
     })
-    super.on('RspQryInstrumentOrderCommRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInstrumentOrderCommRate', (data, info, requestId, isLast) => {
       this.onRspQryInstrumentOrderCommRate(data, info, requestId, isLast)
     })
-    super.on('RspQryOptionInstrTradeCost', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryOptionInstrTradeCost', (data, info, requestId, isLast) => {
       this.onRspQryOptionInstrTradeCost(data, info, requestId, isLast)
     })
-    super.on('RspQryOptionInstrCommRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryOptionInstrCommRate', (data, info, requestId, isLast) => {
       this.onRspQryOptionInstrCommRate(data, info, requestId, isLast)
     })
-    super.on('RspQryExecOrder', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExecOrder', (data, info, requestId, isLast) => {
       this.onRspQryExecOrder(data, info, requestId, isLast)
     })
-    super.on('RspQryForQuote', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryForQuote', (data, info, requestId, isLast) => {
       this.onRspQryForQuote(data, info, requestId, isLast)
     })
-    super.on('RspQryQuote', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryQuote', (data, info, requestId, isLast) => {
       this.onRspQryQuote(data, info, requestId, isLast)
     })
-    super.on('RspQryLock', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryLock', (data, info, requestId, isLast) => {
       this.onRspQryLock(data, info, requestId, isLast)
     })
-    super.on('RspQryLockPosition', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryLockPosition', (data, info, requestId, isLast) => {
       this.onRspQryLockPosition(data, info, requestId, isLast)
     })
-    super.on('RspQryETFOptionInstrCommRate', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryETFOptionInstrCommRate', (data, info, requestId, isLast) => {
       this.onRspQryETFOptionInstrCommRate(data, info, requestId, isLast)
     })
-    super.on('RspQryInvestorLevel', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryInvestorLevel', (data, info, requestId, isLast) => {
       this.onRspQryInvestorLevel(data, info, requestId, isLast)
     })
-    super.on('RspQryExecFreeze', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryExecFreeze', (data, info, requestId, isLast) => {
       this.onRspQryExecFreeze(data, info, requestId, isLast)
     })
-    super.on('RspQryCombInstrumentGuard', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryCombInstrumentGuard', (data, info, requestId, isLast) => {
       this.onRspQryCombInstrumentGuard(data, info, requestId, isLast)
     })
-    super.on('RspQryCombAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryCombAction', (data, info, requestId, isLast) => {
       this.onRspQryCombAction(data, info, requestId, isLast)
     })
-    super.on('RspQryTransferSerial', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTransferSerial', (data, info, requestId, isLast) => {
       this.onRspQryTransferSerial(data, info, requestId, isLast)
     })
-    super.on('RspQryAccountregister', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryAccountregister', (data, info, requestId, isLast) => {
       this.onRspQryAccountregister(data, info, requestId, isLast)
     })
-    super.on('RspError', (info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspError', (info, requestId, isLast) => {
       this.onRspError(info, requestId, isLast)
     })
-    super.on('RtnOrder', (data) => {
+    this._on('RtnOrder', (data) => {
       this.onRtnOrder(data)
     })
-    super.on('RtnTrade', (data) => {
+    this._on('RtnTrade', (data) => {
       this.onRtnTrade(data)
     })
-    super.on('ErrRtnOrderInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnOrderInsert', (data, info) => {
       this.onErrRtnOrderInsert(data, info)
     })
-    super.on('ErrRtnOrderAction', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnOrderAction', (data, info) => {
       this.onErrRtnOrderAction(data, info)
     })
-    super.on('RtnInstrumentStatus', (data) => {
+    this._on('RtnInstrumentStatus', (data) => {
       this.onRtnInstrumentStatus(data)
     })
-    super.on('RtnBulletin', (data) => {
+    this._on('RtnBulletin', (data) => {
       this.onRtnBulletin(data)
     })
-    super.on('RtnTradingNotice', (data) => {
+    this._on('RtnTradingNotice', (data) => {
       this.onRtnTradingNotice(data)
     })
-    super.on('RtnErrorConditionalOrder', (data) => {
+    this._on('RtnErrorConditionalOrder', (data) => {
       this.onRtnErrorConditionalOrder(data)
     })
-    super.on('RtnExecOrder', (data) => {
+    this._on('RtnExecOrder', (data) => {
       this.onRtnExecOrder(data)
     })
-    super.on('ErrRtnExecOrderInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnExecOrderInsert', (data, info) => {
       this.onErrRtnExecOrderInsert(data, info)
     })
-    super.on('ErrRtnExecOrderAction', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnExecOrderAction', (data, info) => {
       this.onErrRtnExecOrderAction(data, info)
     })
-    super.on('ErrRtnForQuoteInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnForQuoteInsert', (data, info) => {
       this.onErrRtnForQuoteInsert(data, info)
     })
-    super.on('RtnQuote', (data) => {
+    this._on('RtnQuote', (data) => {
       this.onRtnQuote(data)
     })
-    super.on('ErrRtnQuoteInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnQuoteInsert', (data, info) => {
       this.onErrRtnQuoteInsert(data, info)
     })
-    super.on('ErrRtnQuoteAction', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnQuoteAction', (data, info) => {
       this.onErrRtnQuoteAction(data, info)
     })
-    super.on('RtnForQuoteRsp', (data) => {
+    this._on('RtnForQuoteRsp', (data) => {
       this.onRtnForQuoteRsp(data)
     })
-    super.on('RtnCFMMCTradingAccountToken', (data) => {
+    this._on('RtnCFMMCTradingAccountToken', (data) => {
       this.onRtnCFMMCTradingAccountToken(data)
     })
-    super.on('RtnLock', (data) => {
+    this._on('RtnLock', (data) => {
       this.onRtnLock(data)
     })
-    super.on('ErrRtnLockInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnLockInsert', (data, info) => {
       this.onErrRtnLockInsert(data, info)
     })
-    super.on('ErrRtnBatchOrderAction', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnBatchOrderAction', (data, info) => {
       this.onErrRtnBatchOrderAction(data, info)
     })
-    super.on('RtnCombAction', (data) => {
+    this._on('RtnCombAction', (data) => {
       this.onRtnCombAction(data)
     })
-    super.on('ErrRtnCombActionInsert', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnCombActionInsert', (data, info) => {
       this.onErrRtnCombActionInsert(data, info)
     })
-    super.on('RspQryContractBank', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryContractBank', (data, info, requestId, isLast) => {
       this.onRspQryContractBank(data, info, requestId, isLast)
     })
-    super.on('RspQryParkedOrder', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryParkedOrder', (data, info, requestId, isLast) => {
       this.onRspQryParkedOrder(data, info, requestId, isLast)
     })
-    super.on('RspQryParkedOrderAction', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryParkedOrderAction', (data, info, requestId, isLast) => {
       this.onRspQryParkedOrderAction(data, info, requestId, isLast)
     })
-    super.on('RspQryTradingNotice', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryTradingNotice', (data, info, requestId, isLast) => {
       this.onRspQryTradingNotice(data, info, requestId, isLast)
     })
-    super.on('RspQryBrokerTradingParams', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryBrokerTradingParams', (data, info, requestId, isLast) => {
       this.onRspQryBrokerTradingParams(data, info, requestId, isLast)
     })
-    super.on('RspQryBrokerTradingAlgos', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQryBrokerTradingAlgos', (data, info, requestId, isLast) => {
       this.onRspQryBrokerTradingAlgos(data, info, requestId, isLast)
     })
-    super.on('RspQueryCFMMCTradingAccountToken', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQueryCFMMCTradingAccountToken', (data, info, requestId, isLast) => {
       this.onRspQueryCFMMCTradingAccountToken(data, info, requestId, isLast)
     })
-    super.on('RtnFromBankToFutureByBank', (data) => {
+    this._on('RtnFromBankToFutureByBank', (data) => {
       this.onRtnFromBankToFutureByBank(data)
     })
-    super.on('RtnFromFutureToBankByBank', (data) => {
+    this._on('RtnFromFutureToBankByBank', (data) => {
       this.onRtnFromFutureToBankByBank(data)
     })
-    super.on('RtnRepealFromBankToFutureByBank', (data) => {
+    this._on('RtnRepealFromBankToFutureByBank', (data) => {
       this.onRtnRepealFromBankToFutureByBank(data)
     })
-    super.on('RtnRepealFromFutureToBankByBank', (data) => {
+    this._on('RtnRepealFromFutureToBankByBank', (data) => {
       this.onRtnRepealFromFutureToBankByBank(data)
     })
-    super.on('RtnFromBankToFutureByFuture', (data) => {
+    this._on('RtnFromBankToFutureByFuture', (data) => {
       this.onRtnFromBankToFutureByFuture(data)
     })
-    super.on('RtnFromFutureToBankByFuture', (data) => {
+    this._on('RtnFromFutureToBankByFuture', (data) => {
       this.onRtnFromFutureToBankByFuture(data)
     })
-    super.on('RtnRepealFromBankToFutureByFutureManual', (data) => {
+    this._on('RtnRepealFromBankToFutureByFutureManual', (data) => {
       this.onRtnRepealFromBankToFutureByFutureManual(data)
     })
-    super.on('RtnRepealFromFutureToBankByFutureManual', (data) => {
+    this._on('RtnRepealFromFutureToBankByFutureManual', (data) => {
       this.onRtnRepealFromFutureToBankByFutureManual(data)
     })
-    super.on('RtnQueryBankBalanceByFuture', (data) => {
+    this._on('RtnQueryBankBalanceByFuture', (data) => {
       this.onRtnQueryBankBalanceByFuture(data)
     })
-    super.on('ErrRtnBankToFutureByFuture', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnBankToFutureByFuture', (data, info) => {
       this.onErrRtnBankToFutureByFuture(data, info)
     })
-    super.on('ErrRtnFutureToBankByFuture', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnFutureToBankByFuture', (data, info) => {
       this.onErrRtnFutureToBankByFuture(data, info)
     })
-    super.on('ErrRtnRepealBankToFutureByFutureManual', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnRepealBankToFutureByFutureManual', (data, info) => {
       this.onErrRtnRepealBankToFutureByFutureManual(data, info)
     })
-    super.on('ErrRtnRepealFutureToBankByFutureManual', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnRepealFutureToBankByFutureManual', (data, info) => {
       this.onErrRtnRepealFutureToBankByFutureManual(data, info)
     })
-    super.on('ErrRtnQueryBankBalanceByFuture', (data, info) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('ErrRtnQueryBankBalanceByFuture', (data, info) => {
       this.onErrRtnQueryBankBalanceByFuture(data, info)
     })
-    super.on('RtnRepealFromBankToFutureByFuture', (data) => {
+    this._on('RtnRepealFromBankToFutureByFuture', (data) => {
       this.onRtnRepealFromBankToFutureByFuture(data)
     })
-    super.on('RtnRepealFromFutureToBankByFuture', (data) => {
+    this._on('RtnRepealFromFutureToBankByFuture', (data) => {
       this.onRtnRepealFromFutureToBankByFuture(data)
     })
-    super.on('RspFromBankToFutureByFuture', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspFromBankToFutureByFuture', (data, info, requestId, isLast) => {
       this.onRspFromBankToFutureByFuture(data, info, requestId, isLast)
     })
-    super.on('RspFromFutureToBankByFuture', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspFromFutureToBankByFuture', (data, info, requestId, isLast) => {
       this.onRspFromFutureToBankByFuture(data, info, requestId, isLast)
     })
-    super.on('RspQueryBankAccountMoneyByFuture', (data, info, requestId, isLast) => {
-      if (info.ErrorMsg) info.ErrorMsg = iconv.decode(info.ErrorMsg, 'gbk')
+    this._on('RspQueryBankAccountMoneyByFuture', (data, info, requestId, isLast) => {
       this.onRspQueryBankAccountMoneyByFuture(data, info, requestId, isLast)
     })
-    super.on('RtnOpenAccountByBank', (data) => {
+    this._on('RtnOpenAccountByBank', (data) => {
       this.onRtnOpenAccountByBank(data)
     })
-    super.on('RtnCancelAccountByBank', (data) => {
+    this._on('RtnCancelAccountByBank', (data) => {
       this.onRtnCancelAccountByBank(data)
     })
-    super.on('RtnChangeAccountByBank', (data) => {
+    this._on('RtnChangeAccountByBank', (data) => {
       this.onRtnChangeAccountByBank(data)
     })
   }
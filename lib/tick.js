@@ -0,0 +1,218 @@
+'use strict'
+
+/**
+ * 零拷贝行情记录布局, 需要与src/tick_ring.h中的TickRecord保持一致
+ * [类型, 偏移, 长度]
+ */
+const TICK_LAYOUT = Object.freeze({
+  Valid: ['u32', 4],
+  LastPrice: ['f64', 8],
+  PreSettlementPrice: ['f64', 16],
+  PreClosePrice: ['f64', 24],
+  PreOpenInterest: ['f64', 32],
+  OpenPrice: ['f64', 40],
+  HighestPrice: ['f64', 48],
+  LowestPrice: ['f64', 56],
+  Turnover: ['f64', 64],
+  OpenInterest: ['f64', 72],
+  ClosePrice: ['f64', 80],
+  SettlementPrice: ['f64', 88],
+  UpperLimitPrice: ['f64', 96],
+  LowerLimitPrice: ['f64', 104],
+  PreDelta: ['f64', 112],
+  CurrDelta: ['f64', 120],
+  AveragePrice: ['f64', 128],
+  BidPrice1: ['f64', 136],
+  BidPrice2: ['f64', 144],
+  BidPrice3: ['f64', 152],
+  BidPrice4: ['f64', 160],
+  BidPrice5: ['f64', 168],
+  AskPrice1: ['f64', 176],
+  AskPrice2: ['f64', 184],
+  AskPrice3: ['f64', 192],
+  AskPrice4: ['f64', 200],
+  AskPrice5: ['f64', 208],
+  Volume: ['i32', 216],
+  UpdateMillisec: ['i32', 220],
+  BidVolume1: ['i32', 224],
+  BidVolume2: ['i32', 228],
+  BidVolume3: ['i32', 232],
+  BidVolume4: ['i32', 236],
+  BidVolume5: ['i32', 240],
+  AskVolume1: ['i32', 244],
+  AskVolume2: ['i32', 248],
+  AskVolume3: ['i32', 252],
+  AskVolume4: ['i32', 256],
+  AskVolume5: ['i32', 260],
+  TradingDay: ['str', 264, 12],
+  ActionDay: ['str', 276, 12],
+  UpdateTime: ['str', 288, 12],
+  ExchangeID: ['str', 300, 12],
+  InstrumentID: ['str', 312, 32],
+  ExchangeInstID: ['str', 344, 32],
+  Timestamp: ['f64', 376],
+  LastTurnover: ['f64', 384],
+  OIChange: ['f64', 392],
+  LastVolume: ['i32', 400]
+})
+
+/* 环形缓冲区头部长度, 对应TickRingHeader */
+const HEADER_SIZE = 64
+
+/* 价格字段->Valid中的有效位, 价格字段从LastPrice起连续存放 */
+const PRICE_BITS = Object.freeze(Object.keys(TICK_LAYOUT)
+  .filter((name) => TICK_LAYOUT[name][0] === 'f64' &&
+    TICK_LAYOUT[name][1] < TICK_LAYOUT.Volume[1])
+  .reduce((bits, name) => {
+    bits[name] = 1 << ((TICK_LAYOUT[name][1] - TICK_LAYOUT.LastPrice[1]) / 8)
+    return bits
+  }, {}))
+
+/**
+ * 从缓冲区中读取以'\0'结尾的定长字符串
+ */
+function readString (bytes, offset, length) {
+  let end = bytes.indexOf(0, offset)
+  if (end < 0 || end > offset + length) {
+    end = offset + length
+  }
+  return bytes.toString('latin1', offset, end)
+}
+
+/**
+ * 环形缓冲区中单条记录的轻量视图
+ * @remark SPI线程可能随时覆盖环形缓冲区中的记录, TickRing.at()按序号锁的方式
+ * 将记录复制到视图自带的缓冲区, 复制前后序号均一致时记录才有效,
+ * 字段从复制出的记录中读取, 多个字段之间保持一致
+ *
+ * @class TickView
+ */
+class TickView {
+  constructor (ring) {
+    this._ring = ring
+    this._index = 0
+    this._offset = 0
+    this._bytes = Buffer.alloc(ring.recordSize)
+    this._view = new DataView(this._bytes.buffer, this._bytes.byteOffset,
+      this._bytes.length)
+  }
+
+  /**
+   * 环形缓冲区中的记录是否仍然有效(未被SPI线程覆盖)
+   * @remark 已复制出的字段不受覆盖影响
+   */
+  valid () {
+    return this._ring._seq(this._offset) === ((this._index + 1) >>> 0)
+  }
+
+  /**
+   * 价格字段是否有效, 即CTP未以DBL_MAX填充
+   * @param {string} name 价格字段名
+   */
+  has (name) {
+    return (this.Valid & PRICE_BITS[name]) !== 0
+  }
+
+  /**
+   * 转换为普通对象
+   */
+  toObject () {
+    let obj = {}
+    for (let name of Object.keys(TICK_LAYOUT)) {
+      obj[name] = this[name]
+    }
+    return obj
+  }
+
+  /**
+   * 复制第_index条记录
+   * @return 记录正在写入或复制期间被覆盖时返回false
+   */
+  _load () {
+    const seq = (this._index + 1) >>> 0
+    if (this._ring._seq(this._offset) !== seq) {
+      return false
+    }
+    this._ring._bytes.copy(this._bytes, 0, this._offset,
+      this._offset + this._ring.recordSize)
+    return this._view.getUint32(0, true) === seq &&
+      this._ring._seq(this._offset) === seq
+  }
+}
+
+for (let name of Object.keys(TICK_LAYOUT)) {
+  const [type, offset, length] = TICK_LAYOUT[name]
+
+  let getter
+  if (type === 'f64') {
+    getter = function () {
+      return this._view.getFloat64(offset, true)
+    }
+  } else if (type === 'u32') {
+    getter = function () {
+      return this._view.getUint32(offset, true)
+    }
+  } else if (type === 'i32') {
+    getter = function () {
+      return this._view.getInt32(offset, true)
+    }
+  } else {
+    getter = function () {
+      return readString(this._bytes, offset, length)
+    }
+  }
+
+  Object.defineProperty(TickView.prototype, name, {
+    get: getter,
+    enumerable: true
+  })
+}
+
+/**
+ * 封装C++层零拷贝行情环形缓冲区
+ *
+ * @class TickRing
+ */
+class TickRing {
+  /**
+   * @param {ArrayBuffer} buffer CtpMd.enableTickRing返回的缓冲区
+   */
+  constructor (buffer) {
+    this.buffer = buffer
+    this._header = new Uint32Array(buffer, 0, HEADER_SIZE / 4)
+    this._view = new DataView(buffer)
+    this._bytes = Buffer.from(buffer)
+    this.capacity = this._header[0]
+    this.recordSize = this._header[1]
+    this._mask = this.capacity - 1
+  }
+
+  /**
+   * 当前写游标, 即已写入的记录总数(按uint32回绕)
+   */
+  get cursor () {
+    return this._header[2]
+  }
+
+  /**
+   * 读取第index条记录(从0开始计数)
+   * @param {number} index 记录序号
+   * @param {TickView} view 复用的视图对象, 省略时新建
+   * @return 记录视图, 如果记录已被覆盖或正在写入则返回null
+   */
+  at (index, view = new TickView(this)) {
+    view._index = index >>> 0
+    view._offset = HEADER_SIZE + (view._index & this._mask) * this.recordSize
+    return view._load() ? view : null
+  }
+
+  _seq (offset) {
+    return this._view.getUint32(offset, true)
+  }
+}
+
+module.exports = {
+  TICK_LAYOUT,
+  TickRing,
+  TickView
+}
@@ -14,6 +14,8 @@ const fs = require('fs')
 class CxxNodeTypeMap {
   constructor () {
     this.typeMap = new Map()
+    this.baseTypeMap = new Map()
+    this.sizeMap = new Map()
     this._parse()
   }
 
@@ -28,8 +30,10 @@ class CxxNodeTypeMap {
         let name = RegExp.$2
 
         if (type === 'char') {
-          if (/(\w+)\[\d+\]/.exec(name)) {
-            this.typeMap.set(RegExp.$1, 'String')
+          if (/(\w+)\[(\d+)\]/.exec(name)) {
+            name = RegExp.$1
+            this.typeMap.set(name, 'String')
+            this.sizeMap.set(name, Number(RegExp.$2))
           } else {
             this.typeMap.set(name, 'Char')
           }
@@ -40,6 +44,7 @@ class CxxNodeTypeMap {
         } else {
           assert.ok(false)
         }
+        this.baseTypeMap.set(name, type)
       }
     }
   }
@@ -47,6 +52,20 @@ class CxxNodeTypeMap {
   get (cxxType) {
     return this.typeMap.get(cxxType) || '!!!!!!!!!! Unknown;'
   }
+
+  /**
+   * typedef的基础类型: char/int/short/double
+   */
+  baseType (cxxType) {
+    return this.baseTypeMap.get(cxxType)
+  }
+
+  /**
+   * 字符串类型的数组长度
+   */
+  size (cxxType) {
+    return this.sizeMap.get(cxxType) || 0
+  }
 }
 
 /* 全局表 */
@@ -205,7 +224,7 @@ class APIDefineGenerator {
       let firstType = args[0].split(' ')[0]
       let secondValue = args[1].split(' ')[1]
       if (/CThostFtdc.+/.test(firstType) && /nRequestID/.test(secondValue)) {
-        return `${firstType} *data = static_cast<${firstType} *>(baton->data.get());
+        return `${firstType} *data = baton->Data<${firstType}>();
       baton->ret.n = that->api_->${methodName}(data, baton->request_id);`
       }
     }
@@ -301,7 +320,7 @@ class APIDefineGenerator {
       `
 
   RequestBaton *baton = new RequestBaton(cb, that, ${enumName}, shared_ptr<void>(data), request_id);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync, RequestAsyncAfter);`
+  RequestSubmit(args, baton);`
     return body
   }
 
@@ -496,8 +515,7 @@ class SPIDefineGenerator {
   _formatAsyncAfterCase (methodName, methodArgs) {
     let enumName = EnumGenerator.formatEnum(methodName)
     return `    case ${enumName}: {
-      ${this._formatAsyncAfterCaseBody(methodName, methodArgs)}
-      break;
+      ${this._formatAsyncAfterCaseBody(methodName, methodArgs) || 'return 0;'}
     }`
   }
 
@@ -529,8 +547,7 @@ class SPIDefineGenerator {
 
     let body =
       `  ResponseAsyncSend(
-  new ResponseBaton(${enumName}, shared_ptr<void>(data ? new ${structName}(*data) : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL), request_id, last));`
+  pool_.Acquire(${enumName}, data, error, request_id, last));`
 
     return body
   }
@@ -542,26 +559,14 @@ class SPIDefineGenerator {
     let body =
       `
    ${structName} *data =
-       static_cast<${structName} *>(baton->data.get());
-   CThostFtdcRspInfoField *error =
-       static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-   Local<Object> obj_data = Object::New(isolate);
-   Local<Object> obj_error = Object::New(isolate);
-
-    `
-    body += this._formatObjectDefine(structName, 'obj_data', 'data')
-    body += '\n\n'
-    body += this._formatObjectDefine('CThostFtdcRspInfoField',
-      'obj_error',
-      'error')
-    body +=
-      `
+       baton->Data<${structName}>();
+   CThostFtdcRspInfoField *error = baton->error;
 
-  Local<Value> argv[] = {obj_data, obj_error,
-                             Number::New(isolate, baton->request_id),
-                             Boolean::New(isolate, baton->last)};
-  MakeCallback(isolate, ctx, cb, 4, argv);`
+  argv[0] = NewNodeObject(isolate, data);
+  argv[1] = NewNodeObject(isolate, error);
+  argv[2] = Number::New(isolate, baton->request_id);
+  argv[3] = Boolean::New(isolate, baton->last);
+  return 4;`
 
     return body
   }
@@ -575,8 +580,7 @@ class SPIDefineGenerator {
 
     let body =
       `  ResponseAsyncSend(
-  new ResponseBaton(${enumName},
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL), request_id, last));`
+  pool_.AcquireError(${enumName}, error, request_id, last));`
 
     return body
   }
@@ -589,22 +593,12 @@ class SPIDefineGenerator {
 
     let body =
       `
-   CThostFtdcRspInfoField *error =
-       static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-   Local<Object> obj_error = Object::New(isolate);
-
-    `
-    body += this._formatObjectDefine('CThostFtdcRspInfoField',
-      'obj_error',
-      'error')
-    body +=
-      `
+   CThostFtdcRspInfoField *error = baton->error;
 
-  Local<Value> argv[] = {obj_error,
-                             Number::New(isolate, baton->request_id),
-                             Boolean::New(isolate, baton->last)};
-  MakeCallback(isolate, ctx, cb, 3, argv);`
+  argv[0] = NewNodeObject(isolate, error);
+  argv[1] = Number::New(isolate, baton->request_id);
+  argv[2] = Boolean::New(isolate, baton->last);
+  return 3;`
 
     return body
   }
@@ -617,9 +611,7 @@ class SPIDefineGenerator {
 
     let body =
       `  ResponseAsyncSend(
-  new ResponseBaton(${enumName},
-      shared_ptr<void>(data ? new ${structName}(*data) : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL))); `
+  pool_.Acquire(${enumName}, data, error));`
 
     return body
   }
@@ -631,24 +623,12 @@ class SPIDefineGenerator {
     let body =
       `
    ${structName} *data =
-       static_cast<${structName} *>(baton->data.get());
-   CThostFtdcRspInfoField *error =
-       static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-   Local<Object> obj_data = Object::New(isolate);
-   Local<Object> obj_error = Object::New(isolate);
-
-    `
-    body += this._formatObjectDefine(structName, 'obj_data', 'data')
-    body += '\n\n'
-    body += this._formatObjectDefine('CThostFtdcRspInfoField',
-      'obj_error',
-      'error')
-    body +=
-      `
+       baton->Data<${structName}>();
+   CThostFtdcRspInfoField *error = baton->error;
 
-  Local<Value> argv[] = {obj_data, obj_error};
-  MakeCallback(isolate, ctx, cb, 2, argv);`
+  argv[0] = NewNodeObject(isolate, data);
+  argv[1] = NewNodeObject(isolate, error);
+  return 2;`
 
     return body
   }
@@ -661,8 +641,10 @@ class SPIDefineGenerator {
 
     let body =
       `  ResponseAsyncSend(
-  new ResponseBaton(${enumName},
-      shared_ptr<void>(data ? new ${structName}(*data) : NULL)));`
+  pool_.Acquire(${enumName}, data));`
+    if (JOURNALED_EVENTS.has(methodName)) {
+      body = `  journal_.Append(${enumName}, data);\n` + body
+    }
 
     return body
   }
@@ -671,76 +653,20 @@ class SPIDefineGenerator {
    * OnRtn(data)
    */
   _formatAsyncAfterCaseByStruct1 (methodName, structName) {
+    let convert = PROJECTED_EVENTS.has(methodName)
+      ? `${PROJECTED_EVENTS.get(methodName)}.Convert`
+      : 'NewNodeObject'
     let body =
       `
    ${structName} *data =
-       static_cast<${structName} *>(baton->data.get());
-
-   Local<Object> obj_data = Object::New(isolate);
-
-    `
-    body += this._formatObjectDefine(structName, 'obj_data', 'data')
-    body +=
-      `
+       baton->Data<${structName}>();
 
-  Local<Value> argv[] = {obj_data};
-  MakeCallback(isolate, ctx, cb, 1, argv);`
+  argv[0] = ${convert}(isolate, data);
+  return 1;`
 
     return body
   }
 
-  _formatObjectDefine (structName, objName, dataName) {
-    let body = `if (${dataName}) {`
-
-    const lines = iconvlite.decode(fs.readFileSync(
-      '../../ctp_api/include/ThostFtdcUserApiStruct.h'), 'gbk').split(
-      '\n')
-
-    let structStart = false
-    let commentCache = []
-
-    for (let line of lines) {
-      line = line.trim()
-      if (new RegExp(`struct\\s+${structName}`).test(line)) {
-        structStart = true
-      }
-
-      if (structStart) {
-        if (/^};/.test(line)) {
-          structStart = false
-          break
-        } else if (/(\/\/.*)/.exec(line)) {
-          commentCache.push(RegExp.$1.replace('///', '/* ') + ' */')
-        } else if (/(\S+)\s+(\S+);/.exec(line)) {
-          let [memberType, memberName] = [RegExp.$1, RegExp.$2]
-          let nodeType = CXX_NODE_TYPE_MAP.get(memberType)
-          let comment = commentCache.join('\n')
-
-          body += `\n  ${comment}`
-
-          if (nodeType === 'String') {
-            body +=
-              `\n  ${objName}->Set(String::NewFromUtf8(isolate, "${memberName}"), String::NewFromOneByte(isolate, reinterpret_cast<uint8_t *>(${dataName}->${memberName}), NewStringType::kNormal).ToLocalChecked());`
-          } else if (nodeType === 'Char') {
-            body +=
-              `\n  ${objName}->Set(String::NewFromUtf8(isolate, "${memberName}"), String::NewFromUtf8(isolate, string(1, ${dataName}->${memberName}).c_str()));`
-          } else if (nodeType === 'Int' ||
-            nodeType === 'Double') {
-            body +=
-              `\n  ${objName}->Set(String::NewFromUtf8(isolate, "${memberName}"), Number::New(isolate, ${dataName}->${memberName}));`
-          } else {
-            console.log(nodeType)
-            assert.ok(false)
-          }
-
-          commentCache.length = 0
-        }
-      }
-    }
-    body += '\n}'
-    return body
-  }
-
   toString () {
     let body = this.methods.map((m) =>
       `${m[0]}\n${m[1]}`
@@ -749,7 +675,7 @@ class SPIDefineGenerator {
 
     body += 'switch (baton->ev) {\n'
     body += this.asyncAfterCases.join('\n')
-    body += '\n    default: { break; }'
+    body += '\n    default: { return 0; }'
     body += '\n}'
 
     return body
@@ -774,7 +700,7 @@ class SPINodeCallbackRegisterGenerator {
     let nodeEvent = methodName.replace(/^On/, '')
     let nodeArgs = this._formatArgs(methodArgs)
 
-    return `super.on('${nodeEvent}', (${nodeArgs}) => { ${this._formatIconv(nodeEvent, nodeArgs)} this.${nodeMethodName}(${nodeArgs}); });`
+    return `this._on('${nodeEvent}', (${nodeArgs}) => { this.${nodeMethodName}(${nodeArgs}); });`
   }
 
   _formatArgs (methodArgs) {
@@ -787,21 +713,6 @@ class SPINodeCallbackRegisterGenerator {
     return args
   }
 
-  _formatIconv (nodeEvent, nodeArgs) {
-    let body = ''
-    if (/error/.test(nodeArgs)) {
-      body +=
-        'if (error.ErrorMsg) error.ErrorMsg = iconv.decode(error.ErrorMsg, \'gbk\');'
-    }
-
-    if (nodeEvent === 'RspQryInstrument') {
-      body +=
-        'data.InstrumentName = iconv.decode(data.InstrumentName, \'gbk\');'
-    }
-
-    return body
-  }
-
   toString () {
     return this.methods.join('\n')
   }
@@ -845,6 +756,513 @@ class SPINodeCallbackGenerator {
   }
 }
 
+/* -----------------------------------------------------------------------------
+ * 结构体转换相关生成器
+ * -----------------------------------------------------------------------------
+ */
+
+/**
+ * 按clang-format(Google风格)规则折行函数调用/声明
+ * @param indent 缩进
+ * @param head 左括号之前的部分
+ * @param args 参数列表
+ * @param tail 右括号之后的部分
+ */
+function wrapCall (indent, head, args, tail) {
+  const limit = 80
+  let oneLine = `${indent}${head}(${args.join(', ')})${tail}`
+  if (oneLine.length <= limit) {
+    return oneLine
+  }
+
+  let pack = (first, align) => {
+    let lines = [first]
+    for (let [i, arg] of args.entries()) {
+      let text = arg + (i === args.length - 1 ? `)${tail}` : ',')
+      let last = lines[lines.length - 1]
+      let sep = /[(\s]$/.test(last) ? '' : ' '
+      if (last.length + sep.length + text.length <= limit) {
+        lines[lines.length - 1] = last + sep + text
+      } else {
+        lines.push(align + text)
+      }
+    }
+    return lines
+  }
+
+  /* 优先与左括号对齐, 放不下时在左括号后换行并缩进4格 */
+  let align = ' '.repeat(indent.length + head.length + 1)
+  let lines = pack(`${indent}${head}(`, align)
+  if (lines.every((line) => line.length <= limit)) {
+    return lines.join('\n')
+  }
+  lines = pack(`${indent}    `, indent + '    ')
+  return `${indent}${head}(\n` + lines.join('\n')
+}
+
+/* 支持按字段投影转换的结构体 */
+const PROJECTED_STRUCTS = new Set([
+  'CThostFtdcDepthMarketDataField',
+  'CThostFtdcOrderField',
+  'CThostFtdcTradeField'
+])
+
+/* 写入SPI事件二进制日志的事件, 深度行情由CtpMd单独处理 */
+const JOURNALED_EVENTS = new Set([
+  'OnRtnOrder',
+  'OnRtnTrade'
+])
+
+/* 可由Node层设置字段投影的事件->投影成员, 深度行情由CtpMd单独处理 */
+const PROJECTED_EVENTS = new Map([
+  ['OnRtnOrder', 'order_fields_'],
+  ['OnRtnTrade', 'trade_fields_']
+])
+
+/* 字段类型->字段投影中的FieldType */
+const FIELD_TYPE_MAP = new Map([
+  ['String', 'FIELD_STRING'],
+  ['InternedString', 'FIELD_INTERNED_STRING'],
+  ['Char', 'FIELD_CHAR'],
+  ['Int', 'FIELD_INT'],
+  ['Double', 'FIELD_DOUBLE']
+])
+
+/* 取值有限, 转换时使用字符串驻留表的字段 */
+const INTERNED_MEMBERS = new Set([
+  'InstrumentID',
+  'ExchangeID',
+  'ExchangeInstID',
+  'TradingDay',
+  'ActionDay',
+  'BrokerID',
+  'InvestorID'
+])
+
+/**
+ * CTP结构体->Node层对象转换函数生成器
+ * @remark 所有结构体的字段名去重后生成统一的属性名枚举,
+ * 属性名字符串在模块初始化时创建一次并常驻
+ */
+class StructConvertGenerator {
+  constructor () {
+    this.structs = []
+    this.keys = new Map()
+    this.maxStringSize = 0
+    this._parse()
+  }
+
+  _parse () {
+    const lines = iconvlite.decode(fs.readFileSync(
+      '../../ctp_api/include/ThostFtdcUserApiStruct.h'), 'gbk').split(
+      '\n')
+
+    let struct = null
+    let commentCache = []
+
+    for (let line of lines) {
+      line = line.trim()
+      if (/^struct\s+(\w+)/.exec(line)) {
+        struct = {
+          name: RegExp.$1,
+          comment: commentCache.map((c) => c.replace(/^\/+\s*/, '')),
+          members: []
+        }
+        commentCache.length = 0
+      } else if (/(\/\/.*)/.exec(line)) {
+        commentCache.push(RegExp.$1)
+      } else if (struct && /^};/.test(line)) {
+        this.structs.push(struct)
+        struct = null
+      } else if (struct && /(\S+)\s+(\S+);/.exec(line)) {
+        let [memberType, memberName] = [RegExp.$1, RegExp.$2]
+        let nodeType = CXX_NODE_TYPE_MAP.get(memberType)
+        assert.ok(['String', 'Char', 'Int', 'Double'].includes(nodeType))
+        if (nodeType === 'String' && INTERNED_MEMBERS.has(memberName)) {
+          nodeType = 'InternedString'
+        }
+
+        if (PROJECTED_STRUCTS.has(struct.name)) {
+          /* 字段投影按int读取整数字段 */
+          assert.ok(nodeType !== 'Int' ||
+            CXX_NODE_TYPE_MAP.baseType(memberType) === 'int')
+        }
+        this.maxStringSize = Math.max(this.maxStringSize,
+          CXX_NODE_TYPE_MAP.size(memberType))
+
+        struct.members.push({
+          name: memberName,
+          nodeType: nodeType,
+          key: this._addKey(memberName),
+          comment: commentCache.map((c) => c.replace('///', '/* ') + ' */')
+        })
+        commentCache.length = 0
+      } else {
+        commentCache.length = 0
+      }
+    }
+  }
+
+  _addKey (memberName) {
+    let key = EnumGenerator.formatEnum(memberName).replace(/^EV_/, 'KEY_')
+    if (this.keys.has(key)) {
+      assert.strictEqual(this.keys.get(key), memberName)
+    } else {
+      this.keys.set(key, memberName)
+    }
+    return key
+  }
+
+  _sortedKeys () {
+    return Array.from(this.keys.keys()).sort()
+  }
+
+  _formatSignature (struct, tail) {
+    return wrapCall('', 'Local<Object> NewNodeObject',
+      ['Isolate *isolate', `const ${struct.name} *data`], tail)
+  }
+
+  toHeader () {
+    let body = []
+    body.push(`#ifndef STRUCT_CONVERT_H
+#define STRUCT_CONVERT_H
+
+#include <node.h>
+#include <cstddef>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+#include "intern_table.h"
+
+/* 此文件中代码使用misc/code_creater生成, 不要手动修改 */
+
+namespace node_ctp {
+
+using namespace v8;
+
+/**
+ * Node层对象属性名, 由CTP结构体的全部字段名去重生成
+ */
+enum ObjectKey {`)
+    for (let [i, key] of this._sortedKeys().entries()) {
+      body.push(`  ${key} = ${i},`)
+    }
+    body.push(`  KEY_COUNT = ${this.keys.size},
+};
+
+/**
+ * 创建属性名字符串, 每个线程(Isolate)加载模块时调用一次
+ * @remark 属性名使用内部化字符串并常驻, 转换时不再重复创建.
+ * 属性名及字符串驻留表按线程保存, 主线程与各个worker线程互不影响
+ */
+void InitObjectKeys(Isolate *isolate);
+
+/**
+ * 释放当前线程的属性名字符串及驻留的字符串, 在Isolate销毁前调用
+ */
+void ReleaseObjectKeys();
+
+/**
+ * 读取属性名字符串
+ */
+Local<String> GetObjectKey(Isolate *isolate, ObjectKey key);
+
+/**
+ * 读取属性名
+ */
+const char *GetObjectKeyName(ObjectKey key);
+
+/**
+ * 读取当前线程的字符串驻留表
+ */
+StringInternTable &GetInternTable();
+
+/**
+ * 字段投影中的字段类型
+ */
+enum FieldType {
+  FIELD_STRING = 0,
+  FIELD_INTERNED_STRING = 1,
+  FIELD_CHAR = 2,
+  FIELD_INT = 3,
+  FIELD_DOUBLE = 4,
+};
+
+/**
+ * 无效价格的处理方式, CTP以DBL_MAX填充没有取值的价格字段
+ */
+enum InvalidDoubleMode {
+  /* 保留DBL_MAX */
+  INVALID_DOUBLE_KEEP = 0,
+  /* 转换为NaN */
+  INVALID_DOUBLE_NAN = 1,
+  /* 不设置该属性 */
+  INVALID_DOUBLE_SKIP = 2,
+};
+
+/**
+ * 字段投影中的字段描述
+ */
+struct FieldInfo {
+  ObjectKey key;
+  FieldType type;
+  /* 字段在结构体中的偏移与长度 */
+  uint32_t offset;
+  uint32_t size;
+};
+
+/**
+ * 结构体的全部字段描述, 按结构体中的声明顺序排列
+ */
+struct FieldTable {
+  const FieldInfo *fields;
+  size_t count;
+};
+
+/**
+ * 读取支持按字段投影转换的结构体字段表
+ * @remark 参数仅用于按类型选择重载, 可传NULL
+ */`)
+    for (let struct of this.structs.filter((s) => PROJECTED_STRUCTS.has(s.name))) {
+      body.push(wrapCall('', 'FieldTable GetFieldTable',
+        [`const ${struct.name} *`], ';'))
+    }
+    body.push(`
+/**
+ * 按字段投影转换CTP结构体->Node层对象
+ * @param fields 需要转换的字段, 由GetFieldTable返回的字段描述中选出
+ * @param invalid 值为DBL_MAX的浮点字段的处理方式
+ */
+Local<Object> NewNodeObject(Isolate *isolate, const void *data,
+                            const FieldInfo *fields, size_t count,
+                            InvalidDoubleMode invalid = INVALID_DOUBLE_KEEP);
+
+/**
+ * CTP结构体->Node层对象
+ * @remark data为NULL时返回空对象, 同一结构体转换出的对象属性顺序固定,
+ * 共享相同的隐藏类
+ */`)
+    for (let struct of this.structs) {
+      body.push(this._formatSignature(struct, ';'))
+    }
+    body.push(`
+} /* namespace node_ctp */
+
+#endif /* STRUCT_CONVERT_H */`)
+    return body.join('\n')
+  }
+
+  toSource () {
+    let body = []
+    body.push(`#include "struct_convert.h"
+#include <cfloat>
+#include <limits>
+#include "gbk.h"
+
+/* 此文件中代码使用misc/code_creater生成, 不要手动修改 */
+
+namespace node_ctp {
+
+using namespace v8;
+
+/* 属性名->字符串 */
+static const char *kObjectKeyNames[KEY_COUNT] = {`)
+    for (let key of this._sortedKeys()) {
+      body.push(`    "${this.keys.get(key)}",`)
+    }
+    body.push(`};
+
+/* 常用字段的字符串驻留表, 每个线程一份, 默认可驻留8192个字符串 */
+static thread_local StringInternTable intern_table_(8192);
+
+/* 常驻的属性名字符串, 每个线程(Isolate)一份 */
+static thread_local Persistent<String> object_keys_[KEY_COUNT];
+
+void InitObjectKeys(Isolate *isolate) {
+  for (int i = 0; i < KEY_COUNT; ++i) {
+    object_keys_[i].Reset(
+        isolate, String::NewFromUtf8(isolate, kObjectKeyNames[i],
+                                     NewStringType::kInternalized)
+                     .ToLocalChecked());
+  }
+}
+
+void ReleaseObjectKeys() {
+  for (int i = 0; i < KEY_COUNT; ++i) {
+    object_keys_[i].Reset();
+  }
+  intern_table_.Reset(intern_table_.Stats().capacity);
+}
+
+Local<String> GetObjectKey(Isolate *isolate, ObjectKey key) {
+  return Local<String>::New(isolate, object_keys_[key]);
+}
+
+/* 字符串字段的最大长度 */
+static const size_t kMaxStringSize = ${this.maxStringSize};
+
+
+StringInternTable &GetInternTable() { return intern_table_; }
+
+const char *GetObjectKeyName(ObjectKey key) { return kObjectKeyNames[key]; }
+
+/**
+ * 字符串字段按GBK解码, 只包含ASCII字符时直接创建单字节字符串
+ * @param size 字段长度
+ * @param intern 是否使用驻留表, 只对ASCII字符串生效
+ */
+static inline Local<String> NewNodeString(Isolate *isolate, const char *value,
+                                          size_t size, bool intern) {
+  size_t len = 0;
+  if (!IsAsciiString(value, size, len)) {
+    uint16_t buffer[kMaxStringSize];
+    return String::NewFromTwoByte(isolate, buffer, NewStringType::kNormal,
+                                  DecodeGbk(value, len, buffer))
+        .ToLocalChecked();
+  }
+  if (intern) {
+    return intern_table_.Get(isolate, value, len);
+  }
+  return String::NewFromOneByte(isolate,
+                                reinterpret_cast<const uint8_t *>(value),
+                                NewStringType::kNormal, len)
+      .ToLocalChecked();
+}
+
+template <size_t N>
+static inline void SetNodeObjectString(Isolate *isolate, Local<Object> obj,
+                                       ObjectKey key, const char (&value)[N]) {
+  static_assert(N <= kMaxStringSize, "String field too long");
+  obj->Set(GetObjectKey(isolate, key),
+           NewNodeString(isolate, value, N, false));
+}
+
+/**
+ * 取值有限的字段(合约代码, 交易所代码, 日期等)复用驻留的字符串
+ */
+template <size_t N>
+static inline void SetNodeObjectInternedString(Isolate *isolate,
+                                               Local<Object> obj,
+                                               ObjectKey key,
+                                               const char (&value)[N]) {
+  static_assert(N <= kMaxStringSize, "String field too long");
+  obj->Set(GetObjectKey(isolate, key), NewNodeString(isolate, value, N, true));
+}
+
+static inline void SetNodeObjectChar(Isolate *isolate, Local<Object> obj,
+                                     ObjectKey key, char value) {
+  obj->Set(GetObjectKey(isolate, key),
+           String::NewFromOneByte(isolate,
+                                  reinterpret_cast<const uint8_t *>(&value),
+                                  NewStringType::kNormal, value ? 1 : 0)
+               .ToLocalChecked());
+}
+
+static inline void SetNodeObjectInt(Isolate *isolate, Local<Object> obj,
+                                    ObjectKey key, int value) {
+  obj->Set(GetObjectKey(isolate, key), Integer::New(isolate, value));
+}
+
+static inline void SetNodeObjectDouble(Isolate *isolate, Local<Object> obj,
+                                       ObjectKey key, double value) {
+  obj->Set(GetObjectKey(isolate, key), Number::New(isolate, value));
+}
+
+template <typename T, size_t N>
+static inline size_t ArraySize(const T (&)[N]) {
+  return N;
+}
+
+Local<Object> NewNodeObject(Isolate *isolate, const void *data,
+                            const FieldInfo *fields, size_t count,
+                            InvalidDoubleMode invalid) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  const char *base = static_cast<const char *>(data);
+  for (size_t i = 0; i < count; ++i) {
+    const FieldInfo &field = fields[i];
+    const char *value = base + field.offset;
+    switch (field.type) {
+      case FIELD_STRING:
+      case FIELD_INTERNED_STRING: {
+        obj->Set(GetObjectKey(isolate, field.key),
+                 NewNodeString(isolate, value, field.size,
+                               field.type == FIELD_INTERNED_STRING));
+        break;
+      }
+      case FIELD_CHAR: {
+        SetNodeObjectChar(isolate, obj, field.key, *value);
+        break;
+      }
+      case FIELD_INT: {
+        int number;
+        memcpy(&number, value, sizeof(number));
+        SetNodeObjectInt(isolate, obj, field.key, number);
+        break;
+      }
+      case FIELD_DOUBLE: {
+        double number;
+        memcpy(&number, value, sizeof(number));
+        if (number == DBL_MAX && invalid != INVALID_DOUBLE_KEEP) {
+          if (invalid == INVALID_DOUBLE_SKIP) {
+            break;
+          }
+          number = std::numeric_limits<double>::quiet_NaN();
+        }
+        SetNodeObjectDouble(isolate, obj, field.key, number);
+        break;
+      }
+    }
+  }
+  return obj;
+}`)
+
+    for (let struct of this.structs.filter((s) => PROJECTED_STRUCTS.has(s.name))) {
+      let table = `k${struct.name.replace(/^CThostFtdc(\w+)Field$/, '$1')}Fields`
+      body.push('')
+      body.push(`static const FieldInfo ${table}[] = {`)
+      for (let member of struct.members) {
+        body.push(`    {${member.key}, ${FIELD_TYPE_MAP.get(member.nodeType)},`)
+        body.push(`     offsetof(${struct.name}, ${member.name}),`)
+        body.push(`     sizeof(${struct.name}::${member.name})},`)
+      }
+      body.push(`};
+
+${wrapCall('', 'FieldTable GetFieldTable', [`const ${struct.name} *`], ' {')}
+  return {${table}, ArraySize(${table})};
+}`)
+    }
+
+    for (let struct of this.structs) {
+      let comment = struct.comment.length ? struct.comment : [struct.name]
+      body.push('')
+      body.push(`/**\n${comment.map((c) => ` * ${c}`).join('\n')}\n */`)
+      body.push(this._formatSignature(struct, ' {'))
+      body.push(`  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+`)
+      for (let member of struct.members) {
+        for (let c of member.comment) {
+          body.push(`  ${c}`)
+        }
+        body.push(wrapCall('  ', `SetNodeObject${member.nodeType}`,
+          ['isolate', 'obj', member.key, `data->${member.name}`], ';'))
+      }
+      body.push(`
+  return obj;
+}`)
+    }
+
+    body.push(`
+} /* namespace node_ctp */`)
+    return body.join('\n')
+  }
+}
+
 /* -----------------------------------------------------------------------------
  * 主处理函数
  * -----------------------------------------------------------------------------
@@ -973,6 +1391,14 @@ function generateTdSpi () {
     'CThostFtdcTraderSpi')
 }
 
+function generateStructConvertHeader () {
+  console.log(new StructConvertGenerator().toHeader())
+}
+
+function generateStructConvertSource () {
+  console.log(new StructConvertGenerator().toSource())
+}
+
 function generateDataType () {
   const lines = iconvlite.decode(fs.readFileSync(
     '../../ctp_api/include/ThostFtdcUserApiDataType.h'), 'gbk').split(
@@ -1042,10 +1468,43 @@ THOST_TERT_QUICK: 2,
   `)
 }
 
+/**
+ * GBK双字节编码->UTF-16码表
+ * @remark 首字节0x81~0xFE, 尾字节0x40~0xFE, 无对应字符的位置为0xFFFD
+ */
+function generateGbkTable () {
+  const [leadMin, leadMax, trailMin, trailMax] = [0x81, 0xFE, 0x40, 0xFE]
+  let codes = []
+  for (let lead = leadMin; lead <= leadMax; ++lead) {
+    for (let trail = trailMin; trail <= trailMax; ++trail) {
+      let str = iconvlite.decode(Buffer.from([lead, trail]), 'gbk')
+      let code = str.length === 1 ? str.charCodeAt(0) : 0xFFFD
+      codes.push(`0x${code.toString(16).toUpperCase().padStart(4, '0')}`)
+    }
+  }
+
+  let lines = []
+  for (let i = 0; i < codes.length; i += 8) {
+    lines.push(`    ${codes.slice(i, i + 8).join(', ')},`)
+  }
+
+  console.log(`#include "gbk.h"
+
+/* 此文件中代码使用misc/code_creater生成, 不要手动修改 */
+
+namespace node_ctp {
+
+const uint16_t kGbkTable[kGbkTableSize] = {
+${lines.join('\n')}
+};
+
+} /* namespace node_ctp */`)
+}
+
 if (require.main === module) {
   let usage = () => {
     console.log(
-      `usage: node ${argv[0]} md-api | md-spi | td-api | td-spi | data-type)`
+      `usage: node ${argv[0]} md-api | md-spi | td-api | td-spi | data-type | struct-convert-h | struct-convert-cc | gbk-table)`
     )
     process.exit()
   }
@@ -1071,6 +1530,15 @@ if (require.main === module) {
     case 'data-type':
       generateDataType()
       break
+    case 'struct-convert-h':
+      generateStructConvertHeader()
+      break
+    case 'struct-convert-cc':
+      generateStructConvertSource()
+      break
+    case 'gbk-table':
+      generateGbkTable()
+      break
     default:
       usage()
       break
@@ -0,0 +1,212 @@
+#ifndef MOCK_FRONT_H
+#define MOCK_FRONT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ThostFtdcUserApiStruct.h"
+
+/**
+ * 此文件中定义离线模拟前置机的公共部分
+ * @remark 模拟前置机替换libthostmduserapi.so/libthosttraderapi.so链接进插件,
+ * 按可配置的速率回放脚本行情或生成确定性的模拟行情与委托回报,
+ * 用于在没有SimNow的环境下压测整个绑定层. 行为通过以下环境变量配置:
+ *   CTP_MOCK_TICK_RATE     每秒推送的行情数, 0表示不限速, 默认1000
+ *   CTP_MOCK_TICK_COUNT    推送的行情总数, 0表示不限, 默认0
+ *   CTP_MOCK_SEED          模拟行情的随机数种子, 默认1
+ *   CTP_MOCK_MD_REPLAY     行情回放CSV文件, 首行为字段名, 设置后不再生成模拟行情
+ *   CTP_MOCK_TRADING_DAY   交易日, 默认20180102
+ *   CTP_MOCK_INSTRUMENTS   查询合约返回的合约列表, 逗号分隔
+ *   CTP_MOCK_FILL          报单是否立即全部成交, 默认1
+ *   CTP_MOCK_DISCONNECT    行情推送该数量后模拟一次断线重连, 0表示不断线, 默认0
+ */
+
+namespace node_ctp {
+namespace mock {
+
+using std::string;
+using std::vector;
+
+/**
+ * 模拟前置机配置
+ */
+struct MockConfig {
+  double tick_rate;
+  uint64_t tick_count;
+  uint32_t seed;
+  string md_replay;
+  string trading_day;
+  vector<string> instruments;
+  bool fill;
+  uint64_t disconnect;
+
+  static const MockConfig &Get() {
+    static const MockConfig config;
+    return config;
+  }
+
+ private:
+  MockConfig()
+      : tick_rate(Env("CTP_MOCK_TICK_RATE", 1000.0)),
+        tick_count(static_cast<uint64_t>(Env("CTP_MOCK_TICK_COUNT", 0.0))),
+        seed(static_cast<uint32_t>(Env("CTP_MOCK_SEED", 1.0))),
+        md_replay(Env("CTP_MOCK_MD_REPLAY", "")),
+        trading_day(Env("CTP_MOCK_TRADING_DAY", "20180102")),
+        fill(Env("CTP_MOCK_FILL", 1.0) != 0),
+        disconnect(
+            static_cast<uint64_t>(Env("CTP_MOCK_DISCONNECT", 0.0))) {
+    string list = Env("CTP_MOCK_INSTRUMENTS", "rb1805,cu1803,SR805,IF1801");
+    size_t begin = 0;
+    while (begin <= list.size()) {
+      size_t end = list.find(',', begin);
+      if (end == string::npos) {
+        end = list.size();
+      }
+      if (end > begin) {
+        instruments.push_back(list.substr(begin, end - begin));
+      }
+      begin = end + 1;
+    }
+  }
+
+  static double Env(const char *name, double value) {
+    const char *env = getenv(name);
+    return env && *env ? atof(env) : value;
+  }
+
+  static string Env(const char *name, const char *value) {
+    const char *env = getenv(name);
+    return env ? env : value;
+  }
+};
+
+/**
+ * 复制字符串到CTP定长字符数组
+ */
+template <size_t N>
+inline void CopyString(char (&dst)[N], const string &src) {
+  strncpy(dst, src.c_str(), N - 1);
+  dst[N - 1] = '\0';
+}
+
+/**
+ * 当前时间, 格式为HH:MM:SS
+ */
+inline string NowTime() {
+  time_t now = time(NULL);
+  struct tm tm;
+  localtime_r(&now, &tm);
+  char buf[16];
+  strftime(buf, sizeof(buf), "%H:%M:%S", &tm);
+  return buf;
+}
+
+/**
+ * 模拟前置机的回调线程
+ * @remark 与真实的API一样, 所有SPI回调都在该线程中执行. 请求被投递为任务
+ * 按顺序执行; 任务队列为空时调用空闲函数(用于推送行情), 空闲函数返回下次
+ * 调用前需要等待的纳秒数, 返回负数表示等待新的任务
+ */
+class MockWorker {
+ public:
+  typedef std::function<void()> Task;
+  typedef std::function<int64_t()> Idle;
+
+  MockWorker() : started_(false), stop_(false) {}
+
+  ~MockWorker() { Stop(); }
+
+  MockWorker(const MockWorker &) = delete;
+  MockWorker &operator=(const MockWorker &) = delete;
+
+  void SetIdle(const Idle &idle) { idle_ = idle; }
+
+  void Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!started_) {
+      started_ = true;
+      thread_ = std::thread(&MockWorker::Run, this);
+    }
+  }
+
+  /**
+   * 停止回调线程, 不可在回调线程中调用
+   */
+  void Stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    cond_.notify_all();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  /**
+   * 等待回调线程退出
+   */
+  void Join() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return stop_; });
+  }
+
+  void Post(const Task &task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(task);
+    }
+    cond_.notify_all();
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+      if (!tasks_.empty()) {
+        Task task = tasks_.front();
+        tasks_.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+        continue;
+      }
+
+      lock.unlock();
+      int64_t wait = idle_ ? idle_() : -1;
+      lock.lock();
+
+      if (stop_ || !tasks_.empty()) {
+        continue;
+      }
+      if (wait < 0) {
+        cond_.wait(lock);
+      } else if (wait > 0) {
+        cond_.wait_for(lock, std::chrono::nanoseconds(wait));
+      }
+    }
+  }
+
+ private:
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable cond_;
+  std::deque<Task> tasks_;
+  Idle idle_;
+  bool started_;
+  bool stop_;
+};
+
+} /* namespace mock */
+} /* namespace node_ctp */
+
+#endif /* MOCK_FRONT_H */
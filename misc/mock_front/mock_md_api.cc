@@ -0,0 +1,534 @@
+#include <atomic>
+#include <cfloat>
+#include <cstddef>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include "ThostFtdcMdApi.h"
+#include "mock_front.h"
+
+/**
+ * 此文件中实现离线模拟行情前置机
+ */
+
+namespace node_ctp {
+namespace mock {
+
+using std::atomic;
+using std::unordered_map;
+
+/**
+ * 回放文件中可以使用的行情字段
+ */
+struct TickField {
+  const char *name;
+  size_t offset;
+  /* 's'字符串, 'd'浮点数, 'i'整数 */
+  char type;
+  size_t size;
+};
+
+#define MOCK_TICK_FIELD(type, name)                        \
+  {                                                        \
+    #name, offsetof(CThostFtdcDepthMarketDataField, name), \
+        type, sizeof(CThostFtdcDepthMarketDataField::name) \
+  }
+
+static const TickField kTickFields[] = {
+    MOCK_TICK_FIELD('s', TradingDay),
+    MOCK_TICK_FIELD('s', InstrumentID),
+    MOCK_TICK_FIELD('s', ExchangeID),
+    MOCK_TICK_FIELD('s', ExchangeInstID),
+    MOCK_TICK_FIELD('d', LastPrice),
+    MOCK_TICK_FIELD('d', PreSettlementPrice),
+    MOCK_TICK_FIELD('d', PreClosePrice),
+    MOCK_TICK_FIELD('d', PreOpenInterest),
+    MOCK_TICK_FIELD('d', OpenPrice),
+    MOCK_TICK_FIELD('d', HighestPrice),
+    MOCK_TICK_FIELD('d', LowestPrice),
+    MOCK_TICK_FIELD('i', Volume),
+    MOCK_TICK_FIELD('d', Turnover),
+    MOCK_TICK_FIELD('d', OpenInterest),
+    MOCK_TICK_FIELD('d', ClosePrice),
+    MOCK_TICK_FIELD('d', SettlementPrice),
+    MOCK_TICK_FIELD('d', UpperLimitPrice),
+    MOCK_TICK_FIELD('d', LowerLimitPrice),
+    MOCK_TICK_FIELD('d', PreDelta),
+    MOCK_TICK_FIELD('d', CurrDelta),
+    MOCK_TICK_FIELD('s', UpdateTime),
+    MOCK_TICK_FIELD('i', UpdateMillisec),
+    MOCK_TICK_FIELD('d', BidPrice1),
+    MOCK_TICK_FIELD('i', BidVolume1),
+    MOCK_TICK_FIELD('d', AskPrice1),
+    MOCK_TICK_FIELD('i', AskVolume1),
+    MOCK_TICK_FIELD('d', BidPrice2),
+    MOCK_TICK_FIELD('i', BidVolume2),
+    MOCK_TICK_FIELD('d', AskPrice2),
+    MOCK_TICK_FIELD('i', AskVolume2),
+    MOCK_TICK_FIELD('d', BidPrice3),
+    MOCK_TICK_FIELD('i', BidVolume3),
+    MOCK_TICK_FIELD('d', AskPrice3),
+    MOCK_TICK_FIELD('i', AskVolume3),
+    MOCK_TICK_FIELD('d', BidPrice4),
+    MOCK_TICK_FIELD('i', BidVolume4),
+    MOCK_TICK_FIELD('d', AskPrice4),
+    MOCK_TICK_FIELD('i', AskVolume4),
+    MOCK_TICK_FIELD('d', BidPrice5),
+    MOCK_TICK_FIELD('i', BidVolume5),
+    MOCK_TICK_FIELD('d', AskPrice5),
+    MOCK_TICK_FIELD('i', AskVolume5),
+    MOCK_TICK_FIELD('d', AveragePrice),
+    MOCK_TICK_FIELD('s', ActionDay),
+};
+
+#undef MOCK_TICK_FIELD
+
+/**
+ * 模拟行情API
+ */
+class MockMdApi final : public CThostFtdcMdApi {
+ public:
+  MockMdApi()
+      : spi_(NULL),
+        rng_(MockConfig::Get().seed),
+        cursor_(0),
+        sent_(0),
+        start_time_(0),
+        start_sent_(0),
+        replay_loaded_(false),
+        replay_cursor_(0),
+        disconnected_(false) {
+    worker_.SetIdle([this] { return Publish(); });
+  }
+
+  virtual void Release() {
+    worker_.Stop();
+    delete this;
+  }
+
+  virtual void Init() {
+    worker_.Start();
+    worker_.Post([this] {
+      CThostFtdcMdSpi *spi = spi_.load();
+      if (spi) {
+        spi->OnFrontConnected();
+      }
+    });
+  }
+
+  virtual int Join() {
+    worker_.Join();
+    return 0;
+  }
+
+  virtual const char *GetTradingDay() {
+    return MockConfig::Get().trading_day.c_str();
+  }
+
+  virtual void RegisterFront(char *pszFrontAddress) {}
+
+  virtual void RegisterNameServer(char *pszNsAddress) {}
+
+  virtual void RegisterFensUserInfo(
+      CThostFtdcFensUserInfoField *pFensUserInfo) {}
+
+  virtual void RegisterSpi(CThostFtdcMdSpi *pSpi) { spi_.store(pSpi); }
+
+  virtual int SubscribeMarketData(char *ppInstrumentID[], int nCount) {
+    vector<string> ids(ppInstrumentID, ppInstrumentID + nCount);
+    worker_.Post([this, ids] {
+      for (size_t i = 0; i < ids.size(); ++i) {
+        AddQuote(ids[i]);
+        RspSpecificInstrument(ids[i], i + 1 == ids.size(), true);
+      }
+      /* 重新计算速率基准, 避免订阅前的空闲时间被当作欠发的行情 */
+      start_time_ = 0;
+    });
+    return 0;
+  }
+
+  virtual int UnSubscribeMarketData(char *ppInstrumentID[], int nCount) {
+    vector<string> ids(ppInstrumentID, ppInstrumentID + nCount);
+    worker_.Post([this, ids] {
+      for (size_t i = 0; i < ids.size(); ++i) {
+        RemoveQuote(ids[i]);
+        RspSpecificInstrument(ids[i], i + 1 == ids.size(), false);
+      }
+    });
+    return 0;
+  }
+
+  virtual int SubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+    vector<string> ids(ppInstrumentID, ppInstrumentID + nCount);
+    worker_.Post([this, ids] {
+      CThostFtdcMdSpi *spi = spi_.load();
+      for (size_t i = 0; spi && i < ids.size(); ++i) {
+        CThostFtdcSpecificInstrumentField data = {};
+        CopyString(data.InstrumentID, ids[i]);
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspSubForQuoteRsp(&data, &info, 0, i + 1 == ids.size());
+      }
+    });
+    return 0;
+  }
+
+  virtual int UnSubscribeForQuoteRsp(char *ppInstrumentID[], int nCount) {
+    vector<string> ids(ppInstrumentID, ppInstrumentID + nCount);
+    worker_.Post([this, ids] {
+      CThostFtdcMdSpi *spi = spi_.load();
+      for (size_t i = 0; spi && i < ids.size(); ++i) {
+        CThostFtdcSpecificInstrumentField data = {};
+        CopyString(data.InstrumentID, ids[i]);
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspUnSubForQuoteRsp(&data, &info, 0, i + 1 == ids.size());
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField,
+                           int nRequestID) {
+    CThostFtdcReqUserLoginField req = *pReqUserLoginField;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcMdSpi *spi = spi_.load();
+      if (!spi) {
+        return;
+      }
+      CThostFtdcRspUserLoginField data = {};
+      CopyString(data.TradingDay, MockConfig::Get().trading_day);
+      CopyString(data.LoginTime, NowTime());
+      CopyString(data.BrokerID, req.BrokerID);
+      CopyString(data.UserID, req.UserID);
+      CopyString(data.SystemName, "MockFront");
+      CThostFtdcRspInfoField info = {};
+      spi->OnRspUserLogin(&data, &info, nRequestID, true);
+    });
+    return 0;
+  }
+
+  virtual int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout,
+                            int nRequestID) {
+    CThostFtdcUserLogoutField req = *pUserLogout;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcMdSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcUserLogoutField data = req;
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspUserLogout(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+ private:
+  /* 单次空闲调用最多推送的行情数, 避免长时间阻塞请求任务 */
+  static const int kBurst = 1024;
+
+  /* 每条模拟行情推进的交易时间(毫秒) */
+  static const int kTickInterval = 500;
+
+  void RspSpecificInstrument(const string &id, bool last, bool subscribe) {
+    CThostFtdcMdSpi *spi = spi_.load();
+    if (!spi) {
+      return;
+    }
+    CThostFtdcSpecificInstrumentField data = {};
+    CopyString(data.InstrumentID, id);
+    CThostFtdcRspInfoField info = {};
+    if (subscribe) {
+      spi->OnRspSubMarketData(&data, &info, 0, last);
+    } else {
+      spi->OnRspUnSubMarketData(&data, &info, 0, last);
+    }
+  }
+
+  /**
+   * 订阅合约并初始化模拟行情
+   */
+  void AddQuote(const string &id) {
+    if (index_.count(id)) {
+      return;
+    }
+    index_[id] = quotes_.size();
+
+    const MockConfig &config = MockConfig::Get();
+    CThostFtdcDepthMarketDataField quote = {};
+    CopyString(quote.TradingDay, config.trading_day);
+    CopyString(quote.ActionDay, config.trading_day);
+    CopyString(quote.InstrumentID, id);
+
+    double price = 1000 + static_cast<double>(rng_() % 4000);
+    quote.PreSettlementPrice = price;
+    quote.PreClosePrice = price;
+    quote.PreOpenInterest = 100000 + rng_() % 100000;
+    quote.OpenPrice = price;
+    quote.HighestPrice = price;
+    quote.LowestPrice = price;
+    quote.LastPrice = price;
+    quote.OpenInterest = quote.PreOpenInterest;
+    quote.UpperLimitPrice = price * 1.05;
+    quote.LowerLimitPrice = price * 0.95;
+    /* 与真实行情一致, 无效的价格为DBL_MAX */
+    quote.ClosePrice = DBL_MAX;
+    quote.SettlementPrice = DBL_MAX;
+    quote.PreDelta = DBL_MAX;
+    quote.CurrDelta = DBL_MAX;
+    quote.BidPrice2 = quote.BidPrice3 = quote.BidPrice4 = DBL_MAX;
+    quote.BidPrice5 = DBL_MAX;
+    quote.AskPrice2 = quote.AskPrice3 = quote.AskPrice4 = DBL_MAX;
+    quote.AskPrice5 = DBL_MAX;
+
+    quotes_.push_back(quote);
+    millis_.push_back(9 * 3600 * 1000);
+  }
+
+  void RemoveQuote(const string &id) {
+    auto it = index_.find(id);
+    if (it == index_.end()) {
+      return;
+    }
+    size_t index = it->second;
+    size_t last = quotes_.size() - 1;
+    if (index != last) {
+      quotes_[index] = quotes_[last];
+      millis_[index] = millis_[last];
+      index_[quotes_[index].InstrumentID] = index;
+    }
+    quotes_.pop_back();
+    millis_.pop_back();
+    index_.erase(it);
+  }
+
+  /**
+   * 空闲时按配置的速率推送行情
+   * @return 下次推送前需要等待的纳秒数, 负数表示暂停推送
+   */
+  int64_t Publish() {
+    const MockConfig &config = MockConfig::Get();
+    if (quotes_.empty() || !spi_.load() ||
+        (config.tick_count && sent_ >= config.tick_count)) {
+      return -1;
+    }
+
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count();
+    int64_t burst = kBurst;
+
+    if (config.tick_rate > 0) {
+      if (start_time_ == 0) {
+        start_time_ = now;
+        start_sent_ = sent_;
+      }
+      int64_t due = static_cast<int64_t>((now - start_time_) *
+                                         config.tick_rate / 1e9) +
+                    1 - static_cast<int64_t>(sent_ - start_sent_);
+      burst = due < burst ? due : burst;
+    }
+
+    for (int64_t i = 0; i < burst; ++i) {
+      if (config.tick_count && sent_ >= config.tick_count) {
+        return -1;
+      }
+      if (!PublishOne()) {
+        return -1;
+      }
+      if (config.disconnect && sent_ == config.disconnect && !disconnected_) {
+        Reconnect();
+        return -1;
+      }
+    }
+
+    if (config.tick_rate <= 0) {
+      return 0;
+    }
+    int64_t next = start_time_ + static_cast<int64_t>(
+                                     (sent_ - start_sent_) * 1e9 /
+                                     config.tick_rate);
+    return next > now ? next - now : 0;
+  }
+
+  /**
+   * 模拟断线重连, 与真实前置机一样断线后不保留订阅
+   */
+  void Reconnect() {
+    disconnected_ = true;
+    quotes_.clear();
+    millis_.clear();
+    index_.clear();
+    CThostFtdcMdSpi *spi = spi_.load();
+    if (spi) {
+      /* 0x1001 网络读失败 */
+      spi->OnFrontDisconnected(0x1001);
+      spi->OnFrontConnected();
+    }
+  }
+
+  /**
+   * 推送一条行情
+   * @return 回放文件已结束时返回false
+   */
+  bool PublishOne() {
+    CThostFtdcMdSpi *spi = spi_.load();
+    if (!spi) {
+      return false;
+    }
+
+    if (!MockConfig::Get().md_replay.empty()) {
+      LoadReplay();
+      /* 只回放已订阅合约的行情 */
+      while (replay_cursor_ < replay_.size()) {
+        CThostFtdcDepthMarketDataField &data = replay_[replay_cursor_++];
+        if (index_.count(data.InstrumentID)) {
+          ++sent_;
+          spi->OnRtnDepthMarketData(&data);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    size_t index = cursor_++ % quotes_.size();
+    CThostFtdcDepthMarketDataField &quote = quotes_[index];
+    Step(quote, millis_[index]);
+
+    CThostFtdcDepthMarketDataField data = quote;
+    ++sent_;
+    spi->OnRtnDepthMarketData(&data);
+    return true;
+  }
+
+  /**
+   * 格式化为HH:MM:SS, 各部分取值范围由调用者保证
+   */
+  static void FormatTime(TThostFtdcTimeType &time, int hour, int minute,
+                         int second) {
+    static_assert(sizeof(TThostFtdcTimeType) == 9, "TThostFtdcTimeType size");
+    int parts[] = {hour, minute, second};
+    for (int i = 0; i < 3; ++i) {
+      time[i * 3] = static_cast<char>('0' + parts[i] / 10 % 10);
+      time[i * 3 + 1] = static_cast<char>('0' + parts[i] % 10);
+      time[i * 3 + 2] = i < 2 ? ':' : '\0';
+    }
+  }
+
+  /**
+   * 随机游走生成下一条模拟行情
+   */
+  void Step(CThostFtdcDepthMarketDataField &quote, int &millis) {
+    int move = static_cast<int>(rng_() % 3) - 1;
+    int volume = 1 + static_cast<int>(rng_() % 10);
+    int position = static_cast<int>(rng_() % 11) - 5;
+
+    double price = quote.LastPrice + move;
+    if (price > quote.UpperLimitPrice) {
+      price = quote.UpperLimitPrice;
+    } else if (price < quote.LowerLimitPrice) {
+      price = quote.LowerLimitPrice;
+    }
+
+    quote.LastPrice = price;
+    if (price > quote.HighestPrice) {
+      quote.HighestPrice = price;
+    }
+    if (price < quote.LowestPrice) {
+      quote.LowestPrice = price;
+    }
+    quote.Volume += volume;
+    quote.Turnover += price * volume * 10;
+    quote.OpenInterest += position;
+    quote.AveragePrice = quote.Turnover / quote.Volume;
+    quote.BidPrice1 = price - 1;
+    quote.AskPrice1 = price + 1;
+    quote.BidVolume1 = 1 + static_cast<int>(rng_() % 100);
+    quote.AskVolume1 = 1 + static_cast<int>(rng_() % 100);
+
+    millis = (millis + kTickInterval) % (24 * 3600 * 1000);
+    int seconds = millis / 1000;
+    FormatTime(quote.UpdateTime, seconds / 3600, seconds / 60 % 60,
+               seconds % 60);
+    quote.UpdateMillisec = millis % 1000;
+  }
+
+  /**
+   * 读取回放文件, 首行为字段名, 未出现的字段为0
+   */
+  void LoadReplay() {
+    if (replay_loaded_) {
+      return;
+    }
+    replay_loaded_ = true;
+
+    std::ifstream file(MockConfig::Get().md_replay.c_str());
+    string line;
+    vector<const TickField *> columns;
+
+    if (std::getline(file, line)) {
+      std::istringstream header(line);
+      string name;
+      while (std::getline(header, name, ',')) {
+        const TickField *column = NULL;
+        for (const TickField &field : kTickFields) {
+          if (name == field.name) {
+            column = &field;
+            break;
+          }
+        }
+        columns.push_back(column);
+      }
+    }
+
+    while (std::getline(file, line)) {
+      CThostFtdcDepthMarketDataField data = {};
+      std::istringstream row(line);
+      string value;
+      for (size_t i = 0; i < columns.size() && std::getline(row, value, ',');
+           ++i) {
+        const TickField *column = columns[i];
+        if (!column) {
+          continue;
+        }
+        char *ptr = reinterpret_cast<char *>(&data) + column->offset;
+        if (column->type == 's') {
+          strncpy(ptr, value.c_str(), column->size - 1);
+        } else if (column->type == 'd') {
+          *reinterpret_cast<double *>(ptr) =
+              value.empty() ? DBL_MAX : atof(value.c_str());
+        } else {
+          *reinterpret_cast<int *>(ptr) = atoi(value.c_str());
+        }
+      }
+      replay_.push_back(data);
+    }
+  }
+
+ private:
+  MockWorker worker_;
+  atomic<CThostFtdcMdSpi *> spi_;
+  std::mt19937 rng_;
+
+  /* 以下成员只在回调线程中访问 */
+  vector<CThostFtdcDepthMarketDataField> quotes_;
+  vector<int> millis_;
+  unordered_map<string, size_t> index_;
+  size_t cursor_;
+  uint64_t sent_;
+  int64_t start_time_;
+  uint64_t start_sent_;
+  bool replay_loaded_;
+  vector<CThostFtdcDepthMarketDataField> replay_;
+  size_t replay_cursor_;
+  bool disconnected_;
+};
+
+} /* namespace mock */
+} /* namespace node_ctp */
+
+CThostFtdcMdApi *CThostFtdcMdApi::CreateFtdcMdApi(const char *pszFlowPath,
+                                                  const bool bIsUsingUdp,
+                                                  const bool bIsMulticast) {
+  return new node_ctp::mock::MockMdApi();
+}
+
+const char *CThostFtdcMdApi::GetApiVersion() { return "mock"; }
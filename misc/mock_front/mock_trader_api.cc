@@ -0,0 +1,512 @@
+#include <atomic>
+#include <cfloat>
+#include <cstdio>
+#include <unordered_map>
+#include "ThostFtdcTraderApi.h"
+#include "mock_front.h"
+
+/**
+ * 此文件中实现离线模拟交易前置机
+ */
+
+namespace node_ctp {
+namespace mock {
+
+using std::atomic;
+using std::unordered_map;
+
+/* 模拟前置机的前置编号与会话编号 */
+static const int kFrontID = 1;
+static const int kSessionID = 1;
+
+/**
+ * 模拟交易API
+ * @remark 报单立即被接受, CTP_MOCK_FILL开启时随即按委托价全部成交,
+ * 否则保持排队直到被撤单. 未单独模拟的请求返回无数据的成功响应
+ */
+class MockTraderApi final : public CThostFtdcTraderApi {
+ public:
+  MockTraderApi() : spi_(NULL), order_sys_id_(0), trade_id_(0) {}
+
+  virtual void Release() {
+    worker_.Stop();
+    delete this;
+  }
+
+  virtual void Init() {
+    worker_.Start();
+    worker_.Post([this] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        spi->OnFrontConnected();
+      }
+    });
+  }
+
+  virtual int Join() {
+    worker_.Join();
+    return 0;
+  }
+
+  virtual const char *GetTradingDay() {
+    return MockConfig::Get().trading_day.c_str();
+  }
+
+  virtual void RegisterFront(char *pszFrontAddress) {}
+
+  virtual void RegisterNameServer(char *pszNsAddress) {}
+
+  virtual void RegisterFensUserInfo(
+      CThostFtdcFensUserInfoField *pFensUserInfo) {}
+
+  virtual void RegisterSpi(CThostFtdcTraderSpi *pSpi) { spi_.store(pSpi); }
+
+  virtual void SubscribePrivateTopic(THOST_TE_RESUME_TYPE nResumeType) {}
+
+  virtual void SubscribePublicTopic(THOST_TE_RESUME_TYPE nResumeType) {}
+
+  virtual int ReqAuthenticate(CThostFtdcReqAuthenticateField *pField,
+                              int nRequestID) {
+    CThostFtdcReqAuthenticateField req = *pField;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcRspAuthenticateField data = {};
+        CopyString(data.BrokerID, req.BrokerID);
+        CopyString(data.UserID, req.UserID);
+        CopyString(data.UserProductInfo, req.UserProductInfo);
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspAuthenticate(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqUserLogin(CThostFtdcReqUserLoginField *pReqUserLoginField,
+                           int nRequestID) {
+    CThostFtdcReqUserLoginField req = *pReqUserLoginField;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcRspUserLoginField data = {};
+        CopyString(data.TradingDay, MockConfig::Get().trading_day);
+        CopyString(data.LoginTime, NowTime());
+        CopyString(data.BrokerID, req.BrokerID);
+        CopyString(data.UserID, req.UserID);
+        CopyString(data.SystemName, "MockFront");
+        CopyString(data.MaxOrderRef, "1");
+        data.FrontID = kFrontID;
+        data.SessionID = kSessionID;
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspUserLogin(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqUserLogout(CThostFtdcUserLogoutField *pUserLogout,
+                            int nRequestID) {
+    CThostFtdcUserLogoutField req = *pUserLogout;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcUserLogoutField data = req;
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspUserLogout(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqSettlementInfoConfirm(
+      CThostFtdcSettlementInfoConfirmField *pSettlementInfoConfirm,
+      int nRequestID) {
+    CThostFtdcSettlementInfoConfirmField req = *pSettlementInfoConfirm;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcSettlementInfoConfirmField data = req;
+        CopyString(data.ConfirmDate, MockConfig::Get().trading_day);
+        CopyString(data.ConfirmTime, NowTime());
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspSettlementInfoConfirm(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqQryInstrument(CThostFtdcQryInstrumentField *pQryInstrument,
+                               int nRequestID) {
+    CThostFtdcQryInstrumentField req = *pQryInstrument;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (!spi) {
+        return;
+      }
+
+      static const char *kDigits = "0123456789";
+      vector<CThostFtdcInstrumentField> list;
+      for (const string &id : MockConfig::Get().instruments) {
+        if (req.InstrumentID[0] && id != req.InstrumentID) {
+          continue;
+        }
+        CThostFtdcInstrumentField data = {};
+        CopyString(data.InstrumentID, id);
+        CopyString(data.ExchangeID, "MOCK");
+        CopyString(data.InstrumentName, id);
+        CopyString(data.ExchangeInstID, id);
+        CopyString(data.ProductID, id.substr(0, id.find_first_of(kDigits)));
+        data.ProductClass = THOST_FTDC_PC_Futures;
+        data.VolumeMultiple = 10;
+        data.PriceTick = 1;
+        data.IsTrading = 1;
+        list.push_back(data);
+      }
+
+      CThostFtdcRspInfoField info = {};
+      if (list.empty()) {
+        spi->OnRspQryInstrument(NULL, &info, nRequestID, true);
+      }
+      for (size_t i = 0; i < list.size(); ++i) {
+        spi->OnRspQryInstrument(&list[i], &info, nRequestID,
+                                i + 1 == list.size());
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqQryTradingAccount(
+      CThostFtdcQryTradingAccountField *pQryTradingAccount, int nRequestID) {
+    CThostFtdcQryTradingAccountField req = *pQryTradingAccount;
+    worker_.Post([this, req, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      if (spi) {
+        CThostFtdcTradingAccountField data = {};
+        CopyString(data.BrokerID, req.BrokerID);
+        CopyString(data.AccountID, req.InvestorID);
+        CopyString(data.TradingDay, MockConfig::Get().trading_day);
+        CopyString(data.CurrencyID, "CNY");
+        data.PreBalance = 1000000;
+        data.Balance = 1000000;
+        data.Available = 1000000;
+        CThostFtdcRspInfoField info = {};
+        spi->OnRspQryTradingAccount(&data, &info, nRequestID, true);
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqOrderInsert(CThostFtdcInputOrderField *pInputOrder,
+                             int nRequestID) {
+    CThostFtdcInputOrderField req = *pInputOrder;
+    worker_.Post([this, req, nRequestID] { OrderInsert(req, nRequestID); });
+    return 0;
+  }
+
+  virtual int ReqOrderAction(CThostFtdcInputOrderActionField *pInputOrderAction,
+                             int nRequestID) {
+    CThostFtdcInputOrderActionField req = *pInputOrderAction;
+    worker_.Post([this, req, nRequestID] { OrderAction(req, nRequestID); });
+    return 0;
+  }
+
+  virtual int ReqQryOrder(CThostFtdcQryOrderField *pQryOrder, int nRequestID) {
+    worker_.Post([this, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      CThostFtdcRspInfoField info = {};
+      if (spi && orders_.empty()) {
+        spi->OnRspQryOrder(NULL, &info, nRequestID, true);
+      }
+      for (size_t i = 0; spi && i < orders_.size(); ++i) {
+        CThostFtdcOrderField data = orders_[i];
+        spi->OnRspQryOrder(&data, &info, nRequestID, i + 1 == orders_.size());
+      }
+    });
+    return 0;
+  }
+
+  virtual int ReqQryTrade(CThostFtdcQryTradeField *pQryTrade, int nRequestID) {
+    worker_.Post([this, nRequestID] {
+      CThostFtdcTraderSpi *spi = spi_.load();
+      CThostFtdcRspInfoField info = {};
+      if (spi && trades_.empty()) {
+        spi->OnRspQryTrade(NULL, &info, nRequestID, true);
+      }
+      for (size_t i = 0; spi && i < trades_.size(); ++i) {
+        CThostFtdcTradeField data = trades_[i];
+        spi->OnRspQryTrade(&data, &info, nRequestID, i + 1 == trades_.size());
+      }
+    });
+    return 0;
+  }
+
+/**
+ * 未单独模拟的请求, 返回无数据的成功响应
+ */
+#define MOCK_EMPTY_RSP(name, type)                       \
+  virtual int Req##name(type *pField, int nRequestID) {  \
+    worker_.Post([this, nRequestID] {                    \
+      CThostFtdcTraderSpi *spi = spi_.load();            \
+      if (spi) {                                         \
+        CThostFtdcRspInfoField info = {};                \
+        spi->OnRsp##name(NULL, &info, nRequestID, true); \
+      }                                                  \
+    });                                                  \
+    return 0;                                            \
+  }
+
+  MOCK_EMPTY_RSP(UserPasswordUpdate, CThostFtdcUserPasswordUpdateField)
+  MOCK_EMPTY_RSP(TradingAccountPasswordUpdate,
+                 CThostFtdcTradingAccountPasswordUpdateField)
+  MOCK_EMPTY_RSP(ParkedOrderInsert, CThostFtdcParkedOrderField)
+  MOCK_EMPTY_RSP(ParkedOrderAction, CThostFtdcParkedOrderActionField)
+  MOCK_EMPTY_RSP(QueryMaxOrderVolume, CThostFtdcQueryMaxOrderVolumeField)
+  MOCK_EMPTY_RSP(RemoveParkedOrder, CThostFtdcRemoveParkedOrderField)
+  MOCK_EMPTY_RSP(RemoveParkedOrderAction,
+                 CThostFtdcRemoveParkedOrderActionField)
+  MOCK_EMPTY_RSP(ExecOrderInsert, CThostFtdcInputExecOrderField)
+  MOCK_EMPTY_RSP(ExecOrderAction, CThostFtdcInputExecOrderActionField)
+  MOCK_EMPTY_RSP(ForQuoteInsert, CThostFtdcInputForQuoteField)
+  MOCK_EMPTY_RSP(QuoteInsert, CThostFtdcInputQuoteField)
+  MOCK_EMPTY_RSP(QuoteAction, CThostFtdcInputQuoteActionField)
+  MOCK_EMPTY_RSP(LockInsert, CThostFtdcInputLockField)
+  MOCK_EMPTY_RSP(BatchOrderAction, CThostFtdcInputBatchOrderActionField)
+  MOCK_EMPTY_RSP(CombActionInsert, CThostFtdcInputCombActionField)
+  MOCK_EMPTY_RSP(QryInvestorPosition, CThostFtdcQryInvestorPositionField)
+  MOCK_EMPTY_RSP(QryInvestor, CThostFtdcQryInvestorField)
+  MOCK_EMPTY_RSP(QryTradingCode, CThostFtdcQryTradingCodeField)
+  MOCK_EMPTY_RSP(QryInstrumentMarginRate,
+                 CThostFtdcQryInstrumentMarginRateField)
+  MOCK_EMPTY_RSP(QryInstrumentCommissionRate,
+                 CThostFtdcQryInstrumentCommissionRateField)
+  MOCK_EMPTY_RSP(QryExchange, CThostFtdcQryExchangeField)
+  MOCK_EMPTY_RSP(QryProduct, CThostFtdcQryProductField)
+  MOCK_EMPTY_RSP(QryDepthMarketData, CThostFtdcQryDepthMarketDataField)
+  MOCK_EMPTY_RSP(QrySettlementInfo, CThostFtdcQrySettlementInfoField)
+  MOCK_EMPTY_RSP(QryTransferBank, CThostFtdcQryTransferBankField)
+  MOCK_EMPTY_RSP(QryInvestorPositionDetail,
+                 CThostFtdcQryInvestorPositionDetailField)
+  MOCK_EMPTY_RSP(QryNotice, CThostFtdcQryNoticeField)
+  MOCK_EMPTY_RSP(QrySettlementInfoConfirm,
+                 CThostFtdcQrySettlementInfoConfirmField)
+  MOCK_EMPTY_RSP(QryInvestorPositionCombineDetail,
+                 CThostFtdcQryInvestorPositionCombineDetailField)
+  MOCK_EMPTY_RSP(QryCFMMCTradingAccountKey,
+                 CThostFtdcQryCFMMCTradingAccountKeyField)
+  MOCK_EMPTY_RSP(QryEWarrantOffset, CThostFtdcQryEWarrantOffsetField)
+  MOCK_EMPTY_RSP(QryInvestorProductGroupMargin,
+                 CThostFtdcQryInvestorProductGroupMarginField)
+  MOCK_EMPTY_RSP(QryExchangeMarginRate, CThostFtdcQryExchangeMarginRateField)
+  MOCK_EMPTY_RSP(QryExchangeMarginRateAdjust,
+                 CThostFtdcQryExchangeMarginRateAdjustField)
+  MOCK_EMPTY_RSP(QryExchangeRate, CThostFtdcQryExchangeRateField)
+  MOCK_EMPTY_RSP(QrySecAgentACIDMap, CThostFtdcQrySecAgentACIDMapField)
+  MOCK_EMPTY_RSP(QryProductExchRate, CThostFtdcQryProductExchRateField)
+  MOCK_EMPTY_RSP(QryProductGroup, CThostFtdcQryProductGroupField)
+  MOCK_EMPTY_RSP(QryMMInstrumentCommissionRate,
+                 CThostFtdcQryMMInstrumentCommissionRateField)
+  MOCK_EMPTY_RSP(QryMMOptionInstrCommRate,
+                 CThostFtdcQryMMOptionInstrCommRateField)
+  MOCK_EMPTY_RSP(QryInstrumentOrderCommRate,
+                 CThostFtdcQryInstrumentOrderCommRateField)
+  MOCK_EMPTY_RSP(QryOptionInstrTradeCost,
+                 CThostFtdcQryOptionInstrTradeCostField)
+  MOCK_EMPTY_RSP(QryOptionInstrCommRate, CThostFtdcQryOptionInstrCommRateField)
+  MOCK_EMPTY_RSP(QryExecOrder, CThostFtdcQryExecOrderField)
+  MOCK_EMPTY_RSP(QryForQuote, CThostFtdcQryForQuoteField)
+  MOCK_EMPTY_RSP(QryQuote, CThostFtdcQryQuoteField)
+  MOCK_EMPTY_RSP(QryLock, CThostFtdcQryLockField)
+  MOCK_EMPTY_RSP(QryLockPosition, CThostFtdcQryLockPositionField)
+  MOCK_EMPTY_RSP(QryETFOptionInstrCommRate,
+                 CThostFtdcQryETFOptionInstrCommRateField)
+  MOCK_EMPTY_RSP(QryInvestorLevel, CThostFtdcQryInvestorLevelField)
+  MOCK_EMPTY_RSP(QryExecFreeze, CThostFtdcQryExecFreezeField)
+  MOCK_EMPTY_RSP(QryCombInstrumentGuard, CThostFtdcQryCombInstrumentGuardField)
+  MOCK_EMPTY_RSP(QryCombAction, CThostFtdcQryCombActionField)
+  MOCK_EMPTY_RSP(QryTransferSerial, CThostFtdcQryTransferSerialField)
+  MOCK_EMPTY_RSP(QryAccountregister, CThostFtdcQryAccountregisterField)
+  MOCK_EMPTY_RSP(QryContractBank, CThostFtdcQryContractBankField)
+  MOCK_EMPTY_RSP(QryParkedOrder, CThostFtdcQryParkedOrderField)
+  MOCK_EMPTY_RSP(QryParkedOrderAction, CThostFtdcQryParkedOrderActionField)
+  MOCK_EMPTY_RSP(QryTradingNotice, CThostFtdcQryTradingNoticeField)
+  MOCK_EMPTY_RSP(QryBrokerTradingParams, CThostFtdcQryBrokerTradingParamsField)
+  MOCK_EMPTY_RSP(QryBrokerTradingAlgos, CThostFtdcQryBrokerTradingAlgosField)
+  MOCK_EMPTY_RSP(QueryCFMMCTradingAccountToken,
+                 CThostFtdcQueryCFMMCTradingAccountTokenField)
+  MOCK_EMPTY_RSP(FromBankToFutureByFuture, CThostFtdcReqTransferField)
+  MOCK_EMPTY_RSP(FromFutureToBankByFuture, CThostFtdcReqTransferField)
+  MOCK_EMPTY_RSP(QueryBankAccountMoneyByFuture, CThostFtdcReqQueryAccountField)
+#undef MOCK_EMPTY_RSP
+
+ private:
+  /**
+   * 报单录入, 在回调线程中执行
+   */
+  void OrderInsert(const CThostFtdcInputOrderField &req, int request_id) {
+    CThostFtdcTraderSpi *spi = spi_.load();
+    if (!spi) {
+      return;
+    }
+
+    CThostFtdcOrderField order = {};
+    CopyString(order.BrokerID, req.BrokerID);
+    CopyString(order.InvestorID, req.InvestorID);
+    CopyString(order.InstrumentID, req.InstrumentID);
+    CopyString(order.OrderRef, req.OrderRef);
+    CopyString(order.UserID, req.UserID);
+    order.OrderPriceType = req.OrderPriceType;
+    order.Direction = req.Direction;
+    CopyString(order.CombOffsetFlag, req.CombOffsetFlag);
+    CopyString(order.CombHedgeFlag, req.CombHedgeFlag);
+    order.LimitPrice = req.LimitPrice;
+    order.VolumeTotalOriginal = req.VolumeTotalOriginal;
+    order.TimeCondition = req.TimeCondition;
+    order.VolumeCondition = req.VolumeCondition;
+    order.MinVolume = req.MinVolume;
+    order.ContingentCondition = req.ContingentCondition;
+    order.StopPrice = req.StopPrice;
+    order.ForceCloseReason = req.ForceCloseReason;
+    order.IsAutoSuspend = req.IsAutoSuspend;
+    order.RequestID = request_id;
+    CopyString(order.ExchangeID, "MOCK");
+    CopyString(order.TradingDay, MockConfig::Get().trading_day);
+    CopyString(order.InsertDate, MockConfig::Get().trading_day);
+    CopyString(order.InsertTime, NowTime());
+    order.FrontID = kFrontID;
+    order.SessionID = kSessionID;
+
+    char sys_id[16];
+    snprintf(sys_id, sizeof(sys_id), "%12d", ++order_sys_id_);
+    CopyString(order.OrderSysID, sys_id);
+    CopyString(order.OrderLocalID, sys_id);
+    order.BrokerOrderSeq = order_sys_id_;
+    order.SequenceNo = order_sys_id_;
+
+    order.OrderSubmitStatus = THOST_FTDC_OSS_Accepted;
+    order.OrderStatus = THOST_FTDC_OST_NoTradeQueueing;
+    order.VolumeTotal = order.VolumeTotalOriginal;
+    CopyString(order.StatusMsg, "No trade queueing");
+
+    size_t index = orders_.size();
+    orders_.push_back(order);
+    order_refs_[order.OrderRef] = index;
+    order_sys_ids_[order.OrderSysID] = index;
+    Publish(spi, orders_[index]);
+
+    if (!MockConfig::Get().fill) {
+      return;
+    }
+
+    CThostFtdcTradeField trade = {};
+    CopyString(trade.BrokerID, order.BrokerID);
+    CopyString(trade.InvestorID, order.InvestorID);
+    CopyString(trade.InstrumentID, order.InstrumentID);
+    CopyString(trade.OrderRef, order.OrderRef);
+    CopyString(trade.UserID, order.UserID);
+    CopyString(trade.ExchangeID, order.ExchangeID);
+    char trade_id[24];
+    snprintf(trade_id, sizeof(trade_id), "%12d", ++trade_id_);
+    CopyString(trade.TradeID, trade_id);
+    trade.Direction = order.Direction;
+    CopyString(trade.OrderSysID, order.OrderSysID);
+    trade.OffsetFlag = order.CombOffsetFlag[0];
+    trade.HedgeFlag = order.CombHedgeFlag[0];
+    trade.Price = order.LimitPrice;
+    trade.Volume = order.VolumeTotalOriginal;
+    CopyString(trade.TradeDate, order.TradingDay);
+    CopyString(trade.TradeTime, NowTime());
+    trade.TradeType = THOST_FTDC_TRDT_Common;
+    CopyString(trade.OrderLocalID, order.OrderLocalID);
+    trade.SequenceNo = trade_id_;
+    CopyString(trade.TradingDay, order.TradingDay);
+    trade.BrokerOrderSeq = order.BrokerOrderSeq;
+    trade.TradeSource = THOST_FTDC_TSRC_NORMAL;
+    trades_.push_back(trade);
+
+    CThostFtdcOrderField &filled = orders_[index];
+    filled.OrderStatus = THOST_FTDC_OST_AllTraded;
+    filled.VolumeTraded = filled.VolumeTotalOriginal;
+    filled.VolumeTotal = 0;
+    CopyString(filled.UpdateTime, trade.TradeTime);
+    CopyString(filled.StatusMsg, "All traded");
+
+    CThostFtdcTradeField data = trade;
+    spi->OnRtnTrade(&data);
+    Publish(spi, filled);
+  }
+
+  /**
+   * 撤单, 在回调线程中执行
+   */
+  void OrderAction(const CThostFtdcInputOrderActionField &req,
+                   int request_id) {
+    CThostFtdcTraderSpi *spi = spi_.load();
+    if (!spi) {
+      return;
+    }
+
+    unordered_map<string, size_t>::const_iterator it;
+    if (req.OrderSysID[0]) {
+      it = order_sys_ids_.find(req.OrderSysID);
+      if (it == order_sys_ids_.end()) {
+        return RejectAction(spi, req, request_id, 25, "order not found");
+      }
+    } else {
+      it = order_refs_.find(req.OrderRef);
+      if (it == order_refs_.end()) {
+        return RejectAction(spi, req, request_id, 25, "order not found");
+      }
+    }
+
+    CThostFtdcOrderField &order = orders_[it->second];
+    if (order.OrderStatus == THOST_FTDC_OST_AllTraded ||
+        order.OrderStatus == THOST_FTDC_OST_Canceled) {
+      return RejectAction(spi, req, request_id, 26,
+                          "order already traded or canceled");
+    }
+
+    order.OrderStatus = THOST_FTDC_OST_Canceled;
+    CopyString(order.CancelTime, NowTime());
+    CopyString(order.UpdateTime, order.CancelTime);
+    CopyString(order.StatusMsg, "Canceled");
+    Publish(spi, order);
+  }
+
+  void RejectAction(CThostFtdcTraderSpi *spi,
+                    const CThostFtdcInputOrderActionField &req,
+                    int request_id, int error_id, const char *error_msg) {
+    CThostFtdcInputOrderActionField data = req;
+    CThostFtdcRspInfoField info = {};
+    info.ErrorID = error_id;
+    CopyString(info.ErrorMsg, error_msg);
+    spi->OnRspOrderAction(&data, &info, request_id, true);
+  }
+
+  static void Publish(CThostFtdcTraderSpi *spi,
+                      const CThostFtdcOrderField &order) {
+    CThostFtdcOrderField data = order;
+    spi->OnRtnOrder(&data);
+  }
+
+ private:
+  MockWorker worker_;
+  atomic<CThostFtdcTraderSpi *> spi_;
+
+  /* 以下成员只在回调线程中访问 */
+  vector<CThostFtdcOrderField> orders_;
+  vector<CThostFtdcTradeField> trades_;
+  unordered_map<string, size_t> order_refs_;
+  unordered_map<string, size_t> order_sys_ids_;
+  int order_sys_id_;
+  int trade_id_;
+};
+
+} /* namespace mock */
+} /* namespace node_ctp */
+
+CThostFtdcTraderApi *CThostFtdcTraderApi::CreateFtdcTraderApi(
+    const char *pszFlowPath) {
+  return new node_ctp::mock::MockTraderApi();
+}
+
+const char *CThostFtdcTraderApi::GetApiVersion() { return "mock"; }
@@ -1,16 +1,80 @@
 #include <node.h>
 #include "ctp_md.h"
 #include "ctp_td.h"
+#include "struct_convert.h"
 
 namespace node_ctp {
 
 using namespace v8;
 
+/**
+ * 设置当前线程的字符串驻留表容量, 已驻留的字符串被清空
+ * @param capacity 可驻留的字符串数
+ */
+static void SetInternCapacity(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  if (!args[0]->IsUint32() || args[0]->Uint32Value() == 0) {
+    isolate->ThrowException(Exception::TypeError(
+        String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+  GetInternTable().Reset(args[0]->Uint32Value());
+}
+
+/**
+ * 读取当前线程的字符串驻留表统计计数
+ * @return {capacity, size, hits, misses, overflow}
+ */
+static void GetInternStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  InternStats stats = GetInternTable().Stats();
+
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "capacity"),
+           Number::New(isolate, stats.capacity));
+  obj->Set(String::NewFromUtf8(isolate, "size"),
+           Number::New(isolate, stats.size));
+  obj->Set(String::NewFromUtf8(isolate, "hits"),
+           Number::New(isolate, stats.hits));
+  obj->Set(String::NewFromUtf8(isolate, "misses"),
+           Number::New(isolate, stats.misses));
+  obj->Set(String::NewFromUtf8(isolate, "overflow"),
+           Number::New(isolate, stats.overflow));
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 释放当前线程的V8持久对象, 在Node环境(主线程或worker线程)退出时调用
+ */
+static void ReleaseModule(void *arg) {
+  CtpMd::ReleaseNodeClass();
+  CtpTd::ReleaseNodeClass();
+  ReleaseObjectKeys();
+}
+
+/**
+ * 初始化模块
+ * @remark 每个加载模块的线程(主线程及各个worker线程)调用一次, 构造函数/属性名
+ * 等V8持久对象按线程保存, 实例使用创建时所在线程的事件循环
+ */
 void InitModule(Local<Object> exports) {
+  InitObjectKeys(exports->GetIsolate());
   CtpMd::InitNodeClass(exports);
   CtpTd::InitNodeClass(exports);
+  NODE_SET_METHOD(exports, "setInternCapacity", SetInternCapacity);
+  NODE_SET_METHOD(exports, "getInternStats", GetInternStats);
 }
 
-NODE_MODULE(node_ctp, InitModule)
+} /* namespace node_ctp */
 
-} /* namespace node_ctp */
\ No newline at end of file
+#ifdef NODE_MODULE_INIT
+/* 支持在worker_threads中加载 */
+NODE_MODULE_INIT() {
+  node::AddEnvironmentCleanupHook(context->GetIsolate(),
+                                  node_ctp::ReleaseModule, NULL);
+  node_ctp::InitModule(exports);
+}
+#else
+NODE_MODULE(node_ctp, node_ctp::InitModule)
+#endif
@@ -0,0 +1,478 @@
+#ifndef BAR_BUILDER_H
+#define BAR_BUILDER_H
+
+#include <atomic>
+#include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "ThostFtdcUserApiStruct.h"
+#include "queue.h"
+#include "tick_time.h"
+
+/**
+ * 此文件中定义由深度行情聚合K线的C++层引擎
+ */
+
+namespace node_ctp {
+
+using std::atomic;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+/* 每个合约最多同时聚合的K线周期数 */
+const int kMaxBarIntervals = 4;
+
+/**
+ * K线
+ */
+struct Bar {
+  TThostFtdcInstrumentIDType InstrumentID;
+  TThostFtdcDateType TradingDay;
+
+  /* 周期(秒), 为0时表示整个交易日 */
+  uint32_t Interval;
+
+  /* 行情条数 */
+  uint32_t TickCount;
+
+  /* 起始时间及最后一条行情的时间(UTC毫秒) */
+  double StartTime;
+  double EndTime;
+
+  double OpenPrice;
+  double HighestPrice;
+  double LowestPrice;
+  double ClosePrice;
+
+  /* 周期内的成交量及成交金额, 由累计值相减得到 */
+  int64_t Volume;
+  double Turnover;
+
+  /* 最后一条行情的持仓量 */
+  double OpenInterest;
+};
+
+/**
+ * K线聚合引擎
+ * @remark SPI线程是唯一的写入者, 按合约代码在开放寻址的连续数组中维护各周期
+ * 正在聚合的K线, 主线程只接收完成的K线(以及可选的正在聚合的K线), 不再逐条
+ * 接收行情. 行情时间使用TickTimestamp换算, 已处理夜盘跨越0点及ActionDay的
+ * 差异; 周期按北京时间对齐. 成交量/成交金额为累计值, 按相邻行情的差值累加,
+ * 交易日切换时累计值从0开始; 开启后每个合约的第一条行情只作为差值的基准.
+ * 某个周期的K线在该合约下一个周期的首条行情到达时完成
+ */
+class BarBuilder {
+ public:
+  /**
+   * @param capacity 可容纳的合约数
+   * @param updates 是否通知正在聚合的K线的变更
+   * @param forward_ticks 是否继续逐条推送深度行情
+   */
+  BarBuilder(uint32_t capacity, bool updates, bool forward_ticks)
+      : updates_(updates),
+        forward_ticks_(forward_ticks),
+        size_(0),
+        overflow_(0),
+        version_(0),
+        closed_written_(0) {
+    /* 保持装载率不超过50%, 缩短探测距离 */
+    uint32_t n = 2;
+    while (n < capacity * 2 && n < (1u << 30)) {
+      n <<= 1;
+    }
+    capacity_ = capacity;
+    mask_ = n - 1;
+    slots_ = new Slot[n];
+    changed_ = new SpscQueue<uint32_t>(n, OVERFLOW_BLOCK);
+
+    /* 队列中最多有n条未取出的K线, 环形缓冲区取2n, 写入者覆盖的记录
+     * 一定已被读取者取出并读取完毕 */
+    closed_ = new SpscQueue<uint32_t>(n, OVERFLOW_BLOCK);
+    closed_mask_ = n * 2 - 1;
+    closed_ring_ = new Bar[n * 2];
+  }
+
+  ~BarBuilder() {
+    delete[] closed_ring_;
+    delete closed_;
+    delete changed_;
+    delete[] slots_;
+  }
+
+  BarBuilder(const BarBuilder &) = delete;
+  BarBuilder &operator=(const BarBuilder &) = delete;
+
+  /**
+   * 设置K线周期, 仅可在主线程中调用
+   * @param intervals 周期(秒)数组, 为0时表示整个交易日
+   * @param instruments 合约代码, 为空时设置默认周期
+   * @remark SPI线程在合约的下一条行情到达时应用新的周期, 已有周期的K线继续
+   * 聚合, 被移除周期正在聚合的K线被丢弃
+   */
+  void SetIntervals(const vector<uint32_t> &intervals,
+                    const vector<string> &instruments) {
+    std::lock_guard<std::mutex> lock(config_mutex_);
+    if (instruments.empty()) {
+      default_intervals_ = intervals;
+    } else {
+      for (size_t i = 0; i < instruments.size(); ++i) {
+        instrument_intervals_[instruments[i]] = intervals;
+      }
+    }
+    version_.fetch_add(1, std::memory_order_release);
+  }
+
+  /**
+   * 聚合一条深度行情, 仅可在SPI线程中调用
+   * @return 需要唤醒主线程处理K线时返回true
+   */
+  bool Update(const CThostFtdcDepthMarketDataField *data) {
+    double timestamp = TickTimestamp(data);
+    if (timestamp == 0) {
+      return false;
+    }
+
+    int64_t index = Find(data->InstrumentID, true);
+    if (index < 0) {
+      overflow_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    Slot &slot = slots_[index];
+    bool inserted = !slot.used.load(std::memory_order_relaxed);
+    Bar closed[kMaxBarIntervals];
+    int closed_count = 0;
+
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint32_t version = version_.load(std::memory_order_acquire);
+    if (inserted || slot.version != version) {
+      ApplyIntervals(slot, version);
+    }
+
+    /* 累计成交量/成交金额->本条行情的增量 */
+    int64_t volume = 0;
+    double turnover = 0;
+    bool same_day = strcmp(slot.trading_day, data->TradingDay) == 0;
+    if (slot.has_base && same_day) {
+      volume = static_cast<int64_t>(data->Volume) - slot.volume;
+      turnover = data->Turnover - slot.turnover;
+      /* 累计值回退时只更新基准 */
+      if (volume < 0 || turnover < 0) {
+        volume = 0;
+        turnover = 0;
+      }
+    } else if (slot.has_base) {
+      volume = data->Volume;
+      turnover = data->Turnover;
+    }
+    slot.has_base = true;
+    slot.volume = data->Volume;
+    slot.turnover = data->Turnover;
+    if (!same_day) {
+      memcpy(slot.trading_day, data->TradingDay, sizeof(slot.trading_day));
+    }
+
+    double price = data->LastPrice;
+    bool valid_price = price != DBL_MAX && price == price;
+    for (uint32_t i = 0; i < slot.count; ++i) {
+      Bar &bar = slot.bars[i];
+      bool open = bar.TickCount > 0;
+      if (open && !SameBar(bar, data, timestamp)) {
+        /* 乱序到达的行情不计入K线 */
+        if (timestamp < bar.StartTime) {
+          continue;
+        }
+        memcpy(&closed[closed_count++], &bar, sizeof(bar));
+        open = false;
+        bar.TickCount = 0;
+      }
+
+      if (!open) {
+        if (!valid_price) {
+          continue;
+        }
+        memcpy(bar.InstrumentID, slot.key, sizeof(bar.InstrumentID));
+        memcpy(bar.TradingDay, data->TradingDay, sizeof(bar.TradingDay));
+        bar.StartTime = BarStart(bar.Interval, timestamp);
+        bar.OpenPrice = price;
+        bar.HighestPrice = price;
+        bar.LowestPrice = price;
+        bar.Volume = 0;
+        bar.Turnover = 0;
+      }
+
+      if (valid_price) {
+        if (price > bar.HighestPrice) {
+          bar.HighestPrice = price;
+        }
+        if (price < bar.LowestPrice) {
+          bar.LowestPrice = price;
+        }
+        bar.ClosePrice = price;
+      }
+      ++bar.TickCount;
+      bar.EndTime = timestamp;
+      bar.Volume += volume;
+      bar.Turnover += turnover;
+      bar.OpenInterest = data->OpenInterest;
+    }
+
+    slot.seq.store(seq + 2, std::memory_order_release);
+
+    /* 完成的K线在序号锁外入队, 队列满时等待主线程取出, 不阻塞读取快照 */
+    for (int i = 0; i < closed_count; ++i) {
+      PushClosed(closed[i]);
+    }
+
+    if (inserted) {
+      /* 合约代码写入完成后才对读取者可见 */
+      slot.used.store(1, std::memory_order_release);
+      size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (updates_ && slot.count > 0 &&
+        !slot.pending.exchange(1, std::memory_order_acq_rel)) {
+      uint32_t dropped;
+      changed_->Push(static_cast<uint32_t>(index), dropped);
+      return true;
+    }
+    return closed_count > 0;
+  }
+
+  /**
+   * 取出一根完成的K线, 仅可在主线程中调用
+   */
+  bool PopClosed(Bar &out) {
+    uint32_t pos;
+    if (!closed_->TryPop(pos)) {
+      return false;
+    }
+    memcpy(&out, &closed_ring_[pos], sizeof(out));
+    return true;
+  }
+
+  /**
+   * 取出一个正在聚合的K线发生变更的合约, 仅可在主线程中调用
+   * @param bars 输出该合约各周期正在聚合的K线, 长度至少为kMaxBarIntervals
+   * @return 输出的K线根数, 没有变更时返回-1
+   */
+  int PopChanged(Bar *bars) {
+    uint32_t index;
+    if (!changed_->TryPop(index)) {
+      return -1;
+    }
+    Slot &slot = slots_[index];
+    slot.pending.store(0, std::memory_order_release);
+
+    for (;;) {
+      uint32_t begin = slot.seq.load(std::memory_order_acquire);
+      if (begin & 1) {
+        std::this_thread::yield();
+        continue;
+      }
+      uint32_t count = slot.count;
+      int n = 0;
+      for (uint32_t i = 0; i < count && i < kMaxBarIntervals; ++i) {
+        if (slot.bars[i].TickCount > 0) {
+          memcpy(&bars[n++], &slot.bars[i], sizeof(Bar));
+        }
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == begin) {
+        return n;
+      }
+    }
+  }
+
+  bool ForwardTicks() const { return forward_ticks_; }
+
+  uint32_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  uint32_t Capacity() const { return capacity_; }
+
+  /**
+   * 表满而未能聚合的行情数
+   */
+  uint64_t Overflow() const {
+    return overflow_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    Slot()
+        : used(0),
+          seq(0),
+          pending(0),
+          version(0),
+          count(0),
+          has_base(false),
+          volume(0),
+          turnover(0) {
+      memset(key, 0x0, sizeof(key));
+      memset(trading_day, 0x0, sizeof(trading_day));
+      memset(bars, 0x0, sizeof(bars));
+    }
+
+    /* 槽位已写入合约, 写入后不再改变 */
+    atomic<uint32_t> used;
+
+    /* 序号锁, 奇数表示正在写入 */
+    atomic<uint32_t> seq;
+
+    /* 变更已记录且尚未被主线程取走 */
+    atomic<uint32_t> pending;
+
+    TThostFtdcInstrumentIDType key;
+
+    /* 已应用的周期配置版本及各周期正在聚合的K线, TickCount为0时未开始 */
+    uint32_t version;
+    uint32_t count;
+    Bar bars[kMaxBarIntervals];
+
+    /* 上一条行情的累计成交量/成交金额, 仅SPI线程访问 */
+    TThostFtdcDateType trading_day;
+    bool has_base;
+    int64_t volume;
+    double turnover;
+  };
+
+  /**
+   * K线的起始时间, 按北京时间对齐
+   */
+  static double BarStart(uint32_t interval, double timestamp) {
+    if (interval == 0) {
+      return timestamp;
+    }
+    int64_t length = static_cast<int64_t>(interval) * 1000;
+    int64_t local = static_cast<int64_t>(timestamp) + kChinaTimeOffsetMs;
+    return static_cast<double>(local / length * length - kChinaTimeOffsetMs);
+  }
+
+  /**
+   * 行情是否属于K线当前的周期
+   */
+  static bool SameBar(const Bar &bar,
+                      const CThostFtdcDepthMarketDataField *data,
+                      double timestamp) {
+    if (bar.Interval == 0) {
+      return strcmp(bar.TradingDay, data->TradingDay) == 0;
+    }
+    return BarStart(bar.Interval, timestamp) == bar.StartTime;
+  }
+
+  /**
+   * 按配置更新合约的周期, 在序号锁内调用
+   */
+  void ApplyIntervals(Slot &slot, uint32_t version) {
+    vector<uint32_t> intervals;
+    {
+      std::lock_guard<std::mutex> lock(config_mutex_);
+      unordered_map<string, vector<uint32_t>>::const_iterator it =
+          instrument_intervals_.find(slot.key);
+      intervals =
+          it != instrument_intervals_.end() ? it->second : default_intervals_;
+    }
+
+    Bar bars[kMaxBarIntervals];
+    uint32_t count = 0;
+    for (size_t i = 0; i < intervals.size() && count < kMaxBarIntervals; ++i) {
+      memset(&bars[count], 0x0, sizeof(Bar));
+      bars[count].Interval = intervals[i];
+      /* 保留已有周期正在聚合的K线 */
+      for (uint32_t j = 0; j < slot.count; ++j) {
+        if (slot.bars[j].Interval == intervals[i]) {
+          memcpy(&bars[count], &slot.bars[j], sizeof(Bar));
+          break;
+        }
+      }
+      ++count;
+    }
+
+    memcpy(slot.bars, bars, sizeof(bars));
+    slot.count = count;
+    slot.version = version;
+  }
+
+  void PushClosed(const Bar &bar) {
+    uint32_t pos = static_cast<uint32_t>(closed_written_++ & closed_mask_);
+    memcpy(&closed_ring_[pos], &bar, sizeof(bar));
+    uint32_t dropped;
+    closed_->Push(pos, dropped);
+  }
+
+  static uint32_t Hash(const char *key) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (; *key; ++key) {
+      hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+  }
+
+  /**
+   * 查找合约所在槽位, 仅可在SPI线程中调用
+   * @param insert 未找到时是否占用空槽位
+   * @return 槽位号, 未找到或表满时返回-1
+   */
+  int64_t Find(const char *instrument_id, bool insert) {
+    TThostFtdcInstrumentIDType key;
+    strncpy(key, instrument_id, sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+
+    uint32_t index = Hash(key) & mask_;
+    for (uint32_t i = 0; i <= mask_; ++i, index = (index + 1) & mask_) {
+      Slot &slot = slots_[index];
+      if (slot.used.load(std::memory_order_acquire)) {
+        if (strcmp(slot.key, key) == 0) {
+          return index;
+        }
+        continue;
+      }
+
+      if (!insert || size_.load(std::memory_order_relaxed) >= capacity_) {
+        return -1;
+      }
+
+      memcpy(slot.key, key, sizeof(key));
+      return index;
+    }
+    return -1;
+  }
+
+ private:
+  Slot *slots_;
+  uint32_t capacity_;
+  uint32_t mask_;
+  bool updates_;
+  bool forward_ticks_;
+  atomic<uint32_t> size_;
+  atomic<uint64_t> overflow_;
+
+  /* 周期配置, 主线程写入, SPI线程按版本号检测变更后读取 */
+  std::mutex config_mutex_;
+  vector<uint32_t> default_intervals_;
+  unordered_map<string, vector<uint32_t>> instrument_intervals_;
+  atomic<uint32_t> version_;
+
+  /* 正在聚合的K线发生变更的槽位号, SPI线程写入, 主线程读取 */
+  SpscQueue<uint32_t> *changed_;
+
+  /* 完成的K线: 记录写入环形缓冲区, 位置经队列传递给主线程 */
+  SpscQueue<uint32_t> *closed_;
+  Bar *closed_ring_;
+  uint64_t closed_mask_;
+  uint64_t closed_written_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* BAR_BUILDER_H */
@@ -2,6 +2,7 @@
 #define BATON_H
 
 #include <node.h>
+#include "ThostFtdcUserApiStruct.h"
 
 /**
  * 此文件中定义MD和TD中通用的Baton数据结构
@@ -14,6 +15,21 @@ using namespace v8;
 using std::string;
 using std::shared_ptr;
 
+/**
+ * 关闭libuv句柄, 句柄内存在关闭回调中释放
+ * @remark libuv在关闭回调执行前仍会访问句柄, 句柄不能随所属对象一同释放
+ */
+template <typename T>
+inline void CloseHandle(T *&handle) {
+  if (!handle) {
+    return;
+  }
+  uv_close(reinterpret_cast<uv_handle_t *>(handle), [](uv_handle_t *closed) {
+    delete reinterpret_cast<T *>(closed);
+  });
+  handle = NULL;
+}
+
 /**
  * API请求Baton
  */
@@ -38,6 +54,14 @@ class RequestBaton {
     callback.Reset();
   }
 
+  /**
+   * 按事件类型读取事件数据
+   */
+  template <typename T>
+  T *Data() const {
+    return static_cast<T *>(data.get());
+  }
+
  public:
   /* libuv相关数据 */
   uv_work_t work;
@@ -69,39 +93,43 @@ class RequestBaton {
 
 /**
  * SPI响应Baton
+ * @remark 由ResponseBatonPool分配, 事件数据与错误信息内联存放在对象之后,
+ * 不可直接new/delete
  */
 class ResponseBaton {
  public:
-  ResponseBaton(int ev) : ResponseBaton(ev, nullptr, nullptr, -1, true) {}
-
-  ResponseBaton(int ev, shared_ptr<void> data)
-      : ResponseBaton(ev, data, nullptr, -1, true) {}
-
-  ResponseBaton(int ev, shared_ptr<void> data, shared_ptr<void> error)
-      : ResponseBaton(ev, data, error, -1, true) {}
-
-  ResponseBaton(int ev, shared_ptr<void> error, int rquest_id, bool last)
-      : ResponseBaton(ev, nullptr, error, request_id, last) {}
-
-  ResponseBaton(int ev, shared_ptr<void> data, shared_ptr<void> error,
-                int request_id, bool last)
-      : ev(ev), data(data), error(error), request_id(request_id), last(last) {}
+  /**
+   * 按事件类型读取事件数据
+   */
+  template <typename T>
+  T *Data() const {
+    return static_cast<T *>(data);
+  }
 
  public:
   /* 事件类型 */
   int ev;
 
-  /* 事件数据 */
-  shared_ptr<void> data;
+  /* 事件数据, 指向内联存储, 无数据时为NULL */
+  void *data;
 
-  /* 事件错误信息 */
-  shared_ptr<void> error;
+  /* 事件错误信息, 指向内联存储, 无错误信息时为NULL */
+  CThostFtdcRspInfoField *error;
 
   /* 事件请求ID */
   int request_id;
 
   /* 事件结束标志 */
   bool last;
+
+  /* 所属尺寸等级, 由对象池使用 */
+  int size_class;
+
+  /* SPI线程收到事件时的单调时钟(纳秒) */
+  uint64_t recv_time;
+
+  /* 事件来源, CtpMd中为送达行情的传输方式(MdTransport) */
+  int source;
 };
 
 } /* namespace node_ctp */
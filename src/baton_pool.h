@@ -0,0 +1,277 @@
+#ifndef BATON_POOL_H
+#define BATON_POOL_H
+
+#include <uv.h>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+#include "ThostFtdcUserApiStruct.h"
+#include "baton.h"
+#include "queue.h"
+
+/**
+ * 此文件中定义SPI响应Baton的对象池
+ */
+
+namespace node_ctp {
+
+using std::atomic;
+using std::vector;
+
+/**
+ * 单个尺寸等级的统计计数
+ */
+struct BatonPoolStats {
+  /* 可内联存放的数据长度 */
+  uint64_t size;
+  /* 已分配的Baton总数, 包括使用中和空闲的 */
+  uint64_t allocated;
+  /* 使用中的Baton数 */
+  uint64_t in_use;
+  /* 使用中Baton数的最大值 */
+  uint64_t high_water;
+  /* 从池中取得的次数 */
+  uint64_t hits;
+  /* 池中无空闲而调用malloc的次数 */
+  uint64_t misses;
+};
+
+/**
+ * SPI响应Baton对象池
+ * @remark Baton与事件数据分配在同一块内存中, 按数据长度分为若干尺寸等级.
+ * SPI线程是唯一的分配者, 主线程将用完的Baton放回各等级的无锁归还队列,
+ * SPI线程分配时从归还队列中取回, 稳态下不再调用malloc. 归还队列已满时
+ * 直接释放内存, 因此每个等级保留的空闲Baton数不超过capacity
+ */
+class ResponseBatonPool {
+ public:
+  explicit ResponseBatonPool(uint32_t capacity) {
+    for (int i = 0; i < kClasses; ++i) {
+      classes_[i].returned =
+          new SpscQueue<ResponseBaton *>(capacity, OVERFLOW_DROP_NEWEST);
+      classes_[i].local.reserve(kLocalCapacity);
+    }
+  }
+
+  ~ResponseBatonPool() {
+    for (int i = 0; i < kClasses; ++i) {
+      SizeClass &size_class = classes_[i];
+      ResponseBaton *baton = NULL;
+      while (size_class.returned->TryPop(baton)) {
+        Free(baton);
+      }
+      for (size_t j = 0; j < size_class.local.size(); ++j) {
+        Free(size_class.local[j]);
+      }
+      delete size_class.returned;
+    }
+  }
+
+  ResponseBatonPool(const ResponseBatonPool &) = delete;
+  ResponseBatonPool &operator=(const ResponseBatonPool &) = delete;
+
+  /**
+   * 分配无数据的Baton, 仅可在SPI线程中调用
+   */
+  ResponseBaton *Acquire(int ev) {
+    return Acquire(ev, 0, NULL, NULL, -1, true);
+  }
+
+  /**
+   * 分配Baton并复制事件数据, 仅可在SPI线程中调用
+   */
+  template <typename T>
+  ResponseBaton *Acquire(int ev, const T *data,
+                         const CThostFtdcRspInfoField *error = NULL,
+                         int request_id = -1, bool last = true) {
+    return Acquire(ev, sizeof(T), data, error, request_id, last);
+  }
+
+  /**
+   * 分配只有错误信息的Baton, 仅可在SPI线程中调用
+   */
+  ResponseBaton *AcquireError(int ev, const CThostFtdcRspInfoField *error,
+                              int request_id, bool last) {
+    return Acquire(ev, 0, NULL, error, request_id, last);
+  }
+
+  /**
+   * 归还Baton, 仅可在主线程中调用
+   */
+  void Release(ResponseBaton *baton) {
+    if (baton->size_class < 0) {
+      Free(baton);
+      return;
+    }
+
+    SizeClass &size_class = classes_[baton->size_class];
+    size_class.released.fetch_add(1, std::memory_order_relaxed);
+
+    ResponseBaton *dropped = NULL;
+    if (!size_class.returned->Push(baton, dropped)) {
+      Free(dropped);
+    }
+  }
+
+  /**
+   * 在SPI线程中归还Baton, 用于事件队列溢出时被丢弃的事件
+   */
+  void ReleaseLocal(ResponseBaton *baton) {
+    if (baton->size_class < 0) {
+      Free(baton);
+      return;
+    }
+
+    SizeClass &size_class = classes_[baton->size_class];
+    size_class.released.fetch_add(1, std::memory_order_relaxed);
+
+    if (size_class.local.size() < kLocalCapacity) {
+      size_class.local.push_back(baton);
+    } else {
+      Free(baton);
+    }
+  }
+
+  /**
+   * 读取各尺寸等级的统计计数, 可在任意线程中调用
+   */
+  vector<BatonPoolStats> Stats() const {
+    vector<BatonPoolStats> stats;
+    for (int i = 0; i < kClasses; ++i) {
+      const SizeClass &size_class = classes_[i];
+      BatonPoolStats item;
+      uint64_t acquired = size_class.acquired.load(std::memory_order_relaxed);
+      uint64_t released = size_class.released.load(std::memory_order_relaxed);
+      item.size = ClassSize(i);
+      item.allocated = size_class.allocated.load(std::memory_order_relaxed);
+      item.in_use = acquired > released ? acquired - released : 0;
+      item.high_water = size_class.high_water.load(std::memory_order_relaxed);
+      item.misses = size_class.misses.load(std::memory_order_relaxed);
+      item.hits = acquired - item.misses;
+      stats.push_back(item);
+    }
+    return stats;
+  }
+
+ private:
+  /* 尺寸等级数, 内联数据长度依次为128, 256, 512, 1024字节 */
+  static const int kClasses = 4;
+  static const size_t kMinClassSize = 128;
+
+  /* SPI线程本地空闲链表的长度上限 */
+  static const size_t kLocalCapacity = 256;
+
+  struct SizeClass {
+    SizeClass()
+        : returned(NULL),
+          allocated(0),
+          acquired(0),
+          released(0),
+          misses(0),
+          high_water(0) {}
+
+    /* 主线程归还的Baton, 主线程写入, SPI线程读取 */
+    SpscQueue<ResponseBaton *> *returned;
+
+    /* SPI线程本地的空闲Baton */
+    vector<ResponseBaton *> local;
+
+    atomic<uint64_t> allocated;
+    atomic<uint64_t> acquired;
+    atomic<uint64_t> released;
+    atomic<uint64_t> misses;
+    atomic<uint64_t> high_water;
+  };
+
+  static size_t ClassSize(int index) { return kMinClassSize << index; }
+
+  /* 内联数据按8字节对齐 */
+  static size_t Align(size_t size) { return (size + 7) & ~size_t(7); }
+
+  ResponseBaton *Acquire(int ev, size_t size, const void *data,
+                         const CThostFtdcRspInfoField *error, int request_id,
+                         bool last) {
+    size_t data_size = data ? Align(size) : 0;
+    size_t payload = data_size + (error ? sizeof(CThostFtdcRspInfoField) : 0);
+
+    int index = 0;
+    while (index < kClasses && ClassSize(index) < payload) {
+      ++index;
+    }
+
+    ResponseBaton *baton = NULL;
+    if (index < kClasses) {
+      baton = Pop(index);
+    } else {
+      /* 超出最大尺寸等级的事件不进入对象池 */
+      baton = Allocate(payload);
+      baton->size_class = -1;
+    }
+
+    char *storage = reinterpret_cast<char *>(baton + 1);
+    baton->ev = ev;
+    baton->data = data ? storage : NULL;
+    baton->error = error ? reinterpret_cast<CThostFtdcRspInfoField *>(
+                               storage + data_size)
+                         : NULL;
+    baton->request_id = request_id;
+    baton->last = last;
+    baton->recv_time = uv_hrtime();
+    baton->source = 0;
+
+    if (data) {
+      memcpy(baton->data, data, size);
+    }
+    if (error) {
+      memcpy(baton->error, error, sizeof(*error));
+    }
+    return baton;
+  }
+
+  ResponseBaton *Pop(int index) {
+    SizeClass &size_class = classes_[index];
+    ResponseBaton *baton = NULL;
+
+    if (!size_class.local.empty()) {
+      baton = size_class.local.back();
+      size_class.local.pop_back();
+    } else if (!size_class.returned->TryPop(baton)) {
+      baton = Allocate(ClassSize(index));
+      baton->size_class = index;
+      size_class.allocated.fetch_add(1, std::memory_order_relaxed);
+      size_class.misses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t acquired =
+        size_class.acquired.fetch_add(1, std::memory_order_relaxed) + 1;
+    uint64_t in_use =
+        acquired - size_class.released.load(std::memory_order_relaxed);
+    if (in_use > size_class.high_water.load(std::memory_order_relaxed)) {
+      size_class.high_water.store(in_use, std::memory_order_relaxed);
+    }
+    return baton;
+  }
+
+  static ResponseBaton *Allocate(size_t payload) {
+    void *memory = ::operator new(sizeof(ResponseBaton) + payload);
+    return new (memory) ResponseBaton();
+  }
+
+  void Free(ResponseBaton *baton) {
+    if (baton->size_class >= 0) {
+      classes_[baton->size_class].allocated.fetch_sub(
+          1, std::memory_order_relaxed);
+    }
+    baton->~ResponseBaton();
+    ::operator delete(baton);
+  }
+
+ private:
+  SizeClass classes_[kClasses];
+};
+
+} /* namespace node_ctp */
+
+#endif /* BATON_POOL_H */
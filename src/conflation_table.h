@@ -0,0 +1,239 @@
+#ifndef CONFLATION_TABLE_H
+#define CONFLATION_TABLE_H
+
+#include <cstdint>
+#include <cstring>
+#include "ThostFtdcUserApiStruct.h"
+
+/**
+ * 此文件中定义深度行情合并策略的按合约计数表
+ */
+
+namespace node_ctp {
+
+/**
+ * 深度行情合并计数表
+ * @remark 按合约保存保留条数, 本轮合并中已保留的条数及累计丢弃的条数.
+ * 使用开放寻址的连续数组, 合约只增不删, 装载率超过50%时扩容一倍, 只在出现
+ * 新合约时分配内存. 每轮合并通过轮次号使计数失效, 不需要清空整个表.
+ * 非线程安全, 只能由一个线程使用
+ */
+class ConflationTable {
+ public:
+  ConflationTable()
+      : slots_(new Slot[kInitialSlots]),
+        mask_(kInitialSlots - 1),
+        size_(0),
+        depth_(0),
+        overrides_(0),
+        round_(0) {}
+
+  ~ConflationTable() { delete[] slots_; }
+
+  ConflationTable(const ConflationTable &) = delete;
+  ConflationTable &operator=(const ConflationTable &) = delete;
+
+  /**
+   * 设置默认保留条数, 0表示不合并
+   */
+  void SetDepth(uint32_t depth) { depth_ = depth; }
+
+  /**
+   * 设置合约的保留条数, 覆盖默认值
+   */
+  void SetDepth(const char *instrument_id, uint32_t depth) {
+    TThostFtdcInstrumentIDType key;
+    CopyKey(key, instrument_id);
+    Slot &slot = slots_[Insert(key)];
+    if (!slot.has_depth) {
+      slot.has_depth = true;
+      ++overrides_;
+    }
+    slot.depth = depth;
+  }
+
+  /**
+   * 是否需要对积压的行情执行合并
+   */
+  bool Enabled() const { return depth_ > 0 || overrides_ > 0; }
+
+  /**
+   * 开始新一轮合并, 之前的保留计数全部失效
+   */
+  void BeginRound() { ++round_; }
+
+  /**
+   * 按从新到旧的顺序计入一条行情
+   * @return 本轮中该合约已保留足够条数, 应丢弃此条时返回true
+   */
+  bool Drop(const char *instrument_id) {
+    TThostFtdcInstrumentIDType key;
+    CopyKey(key, instrument_id);
+    int64_t index = Find(key);
+    if (index < 0) {
+      /* 没有单独设置的合约按默认值合并, 不合并时不需要计数 */
+      if (depth_ == 0) {
+        return false;
+      }
+      index = Insert(key);
+    }
+
+    Slot &slot = slots_[index];
+    uint32_t depth = slot.has_depth ? slot.depth : depth_;
+    if (depth == 0) {
+      return false;
+    }
+    if (slot.round != round_) {
+      slot.round = round_;
+      slot.count = 0;
+    }
+    if (++slot.count <= depth) {
+      return false;
+    }
+    ++slot.dropped;
+    return true;
+  }
+
+  /**
+   * 槽位总数, 用于遍历全部合约
+   */
+  uint32_t Slots() const { return mask_ + 1; }
+
+  /**
+   * 槽位中的合约代码, 槽位未使用时返回NULL
+   */
+  const char *Key(uint32_t index) const {
+    const Slot &slot = slots_[index & mask_];
+    return slot.used ? slot.key : NULL;
+  }
+
+  /**
+   * 槽位中的合约被合并丢弃的行情条数
+   */
+  uint64_t Dropped(uint32_t index) const {
+    return slots_[index & mask_].dropped;
+  }
+
+ private:
+  static const uint32_t kInitialSlots = 64;
+
+  struct Slot {
+    Slot()
+        : used(false),
+          has_depth(false),
+          depth(0),
+          count(0),
+          round(0),
+          dropped(0) {
+      memset(key, 0x0, sizeof(key));
+    }
+
+    bool used;
+
+    /* 是否单独设置了保留条数 */
+    bool has_depth;
+
+    TThostFtdcInstrumentIDType key;
+    uint32_t depth;
+
+    /* 轮次号为round时本轮已保留的条数 */
+    uint32_t count;
+    uint64_t round;
+
+    uint64_t dropped;
+  };
+
+  static uint32_t Hash(const char *key) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (; *key; ++key) {
+      hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+  }
+
+  static void CopyKey(TThostFtdcInstrumentIDType key,
+                      const char *instrument_id) {
+    strncpy(key, instrument_id, sizeof(TThostFtdcInstrumentIDType) - 1);
+    key[sizeof(TThostFtdcInstrumentIDType) - 1] = '\0';
+  }
+
+  /**
+   * 查找合约所在槽位, 表中总有空槽位, 查找必然结束
+   * @return 槽位号, 未找到时返回-1
+   */
+  int64_t Find(const char *key) const {
+    uint32_t index = Hash(key) & mask_;
+    for (;; index = (index + 1) & mask_) {
+      const Slot &slot = slots_[index];
+      if (!slot.used) {
+        return -1;
+      }
+      if (strcmp(slot.key, key) == 0) {
+        return index;
+      }
+    }
+  }
+
+  /**
+   * 查找合约所在槽位, 未找到时占用空槽位
+   * @return 槽位号
+   */
+  uint32_t Insert(const char *key) {
+    int64_t found = Find(key);
+    if (found >= 0) {
+      return static_cast<uint32_t>(found);
+    }
+
+    /* 保持装载率不超过50%, 缩短探测距离并保证总有空槽位 */
+    if ((size_ + 1) * 2 > mask_ + 1) {
+      Grow();
+    }
+
+    uint32_t index = Hash(key) & mask_;
+    while (slots_[index].used) {
+      index = (index + 1) & mask_;
+    }
+    Slot &slot = slots_[index];
+    slot.used = true;
+    memcpy(slot.key, key, sizeof(slot.key));
+    ++size_;
+    return index;
+  }
+
+  void Grow() {
+    Slot *old = slots_;
+    uint32_t count = mask_ + 1;
+
+    slots_ = new Slot[count * 2];
+    mask_ = count * 2 - 1;
+    for (uint32_t i = 0; i < count; ++i) {
+      if (!old[i].used) {
+        continue;
+      }
+      uint32_t index = Hash(old[i].key) & mask_;
+      while (slots_[index].used) {
+        index = (index + 1) & mask_;
+      }
+      slots_[index] = old[i];
+    }
+    delete[] old;
+  }
+
+ private:
+  Slot *slots_;
+  uint32_t mask_;
+  uint32_t size_;
+
+  /* 默认保留条数 */
+  uint32_t depth_;
+
+  /* 单独设置了保留条数的合约数 */
+  uint32_t overrides_;
+
+  uint64_t round_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* CONFLATION_TABLE_H */
@@ -2,6 +2,8 @@
 #define CONVERT_H
 
 #include <cstring>
+#include <string>
+#include "histogram.h"
 
 namespace node_ctp {
 
@@ -59,6 +61,79 @@ inline void GetNodeObjectString(Isolate *isolate, Local<Object> obj,
   }
 }
 
+inline void GetNodeObjectBool(Isolate *isolate, Local<Object> obj,
+                              const char *key, bool &out) {
+  Local<String> key_ = String::NewFromUtf8(isolate, key);
+  if (obj->Has(key_)) {
+    Local<Value> value =
+        obj->Get(isolate->GetCurrentContext(), key_).ToLocalChecked();
+    if (value->IsBoolean()) {
+      out = value->BooleanValue();
+    }
+  }
+}
+
+inline void GetNodeObjectUint32(Isolate *isolate, Local<Object> obj,
+                                const char *key, uint32_t &out) {
+  Local<String> key_ = String::NewFromUtf8(isolate, key);
+  if (obj->Has(key_)) {
+    Local<Value> value =
+        obj->Get(isolate->GetCurrentContext(), key_).ToLocalChecked();
+    if (value->IsUint32()) {
+      out = value->Uint32Value();
+    }
+  }
+}
+
+inline void GetNodeObjectString(Isolate *isolate, Local<Object> obj,
+                                const char *key, string &out) {
+  Local<String> key_ = String::NewFromUtf8(isolate, key);
+  if (obj->Has(key_)) {
+    Local<Value> value =
+        obj->Get(isolate->GetCurrentContext(), key_).ToLocalChecked();
+    if (value->IsString()) {
+      String::Utf8Value str(value);
+      out.assign(*str, str.length());
+    }
+  }
+}
+
+inline Local<Object> NewNodeHistogram(Isolate *isolate,
+                                      const Histogram &histogram) {
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "count"),
+           Number::New(isolate, histogram.Count()));
+  obj->Set(String::NewFromUtf8(isolate, "min"),
+           Number::New(isolate, histogram.Min()));
+  obj->Set(String::NewFromUtf8(isolate, "max"),
+           Number::New(isolate, histogram.Max()));
+  obj->Set(String::NewFromUtf8(isolate, "mean"),
+           Number::New(isolate, histogram.Mean()));
+  obj->Set(String::NewFromUtf8(isolate, "p50"),
+           Number::New(isolate, histogram.Percentile(0.5)));
+  obj->Set(String::NewFromUtf8(isolate, "p90"),
+           Number::New(isolate, histogram.Percentile(0.9)));
+  obj->Set(String::NewFromUtf8(isolate, "p99"),
+           Number::New(isolate, histogram.Percentile(0.99)));
+  obj->Set(String::NewFromUtf8(isolate, "p999"),
+           Number::New(isolate, histogram.Percentile(0.999)));
+  return obj;
+}
+
+inline Local<Object> NewNodeEventStats(Isolate *isolate,
+                                       const EventStats &stats) {
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "queue"),
+           NewNodeHistogram(isolate, stats.queue));
+  obj->Set(String::NewFromUtf8(isolate, "convert"),
+           NewNodeHistogram(isolate, stats.convert));
+  obj->Set(String::NewFromUtf8(isolate, "handler"),
+           NewNodeHistogram(isolate, stats.handler));
+  obj->Set(String::NewFromUtf8(isolate, "total"),
+           NewNodeHistogram(isolate, stats.total));
+  return obj;
+}
+
 } /* node_ctp */
 
 #endif /* CONVERT_H */
\ No newline at end of file
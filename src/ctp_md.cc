@@ -1,6 +1,7 @@
 #include "ctp_md.h"
 #include "baton.h"
 #include "convert.h"
+#include "struct_convert.h"
 
 namespace node_ctp {
 
@@ -59,12 +60,34 @@ enum ResponseEvent {
   EV_ON_RTN_FOR_QUOTE_RSP = 11,
 };
 
+/* SPI事件Node层回调函数参数个数上限 */
+static const int kMaxResponseArgs = 4;
+
+/* 批量模式下按批统计回调函数执行时间时使用的事件类型 */
+static const int kBatchStats = -1;
+
+/* 深度行情按传输方式分别统计, 统计键为kTransportStats - 传输方式 */
+static const int kTransportStats = -16;
+
+/**
+ * 事件所属的延迟统计键
+ */
+static int StatsKey(const ResponseBaton *baton) {
+  return baton->ev == EV_ON_RTN_DEPTH_MARKET_DATA
+             ? kTransportStats - baton->source
+             : baton->ev;
+}
+
+/* 逐条模式下单次唤醒最多处理的事件数及时间预算(微秒) */
+static const uint32_t kDrainCount = 1024;
+static const uint64_t kDrainLatency = 1000;
+
 /* -----------------------------------------------------------------------------
  * 静态成员初始化
  * -----------------------------------------------------------------------------
  */
 
-Persistent<Function> CtpMd::constructor_;
+thread_local Persistent<Function> CtpMd::constructor_;
 
 /* 定义Node层事件字符串->C++层枚举的映射 */
 unordered_map<string, int> CtpMd::event_map_ = {
@@ -87,11 +110,95 @@ unordered_map<string, int> CtpMd::event_map_ = {
  * -----------------------------------------------------------------------------
  */
 
-CtpMd::CtpMd() : api_(NULL) {
-  uv_async_init(uv_default_loop(), &async_, ResponseAsyncAfter);
+CtpMd::CtpMd(Isolate *isolate, uint32_t queue_capacity,
+             OverflowPolicy queue_overflow, bool sync_request,
+             uint32_t pool_capacity, uint32_t subscribe_chunk,
+             uint32_t subscribe_interval)
+    : api_(NULL),
+      isolate_(isolate),
+      loop_(node::GetCurrentEventLoop(isolate)),
+      closing_(false),
+      sync_request_(sync_request),
+      api_created_(false),
+      api_ready_(false),
+      exiting_(false),
+      transport_(MD_TRANSPORT_TCP),
+      queue_(queue_capacity, queue_overflow),
+      pool_(pool_capacity),
+      journal_("md"),
+      subscribe_chunk_(subscribe_chunk),
+      subscribe_interval_(subscribe_interval),
+      batch_size_(0),
+      batch_latency_(0),
+      delta_capacity_(0),
+      invalid_price_(INVALID_DOUBLE_KEEP),
+      tick_ring_(NULL),
+      tick_ring_cursor_(0),
+      snapshot_(NULL),
+      bars_(NULL) {
+  async_ = new uv_async_t();
+  uv_async_init(loop_, async_, ResponseAsyncAfter);
+  async_->data = this;
+  subscribe_timer_ = new uv_timer_t();
+  uv_timer_init(loop_, subscribe_timer_);
+  subscribe_timer_->data = this;
+  /* 定时器仅用于发送订阅请求, 不阻止事件循环退出 */
+  uv_unref(reinterpret_cast<uv_handle_t *>(subscribe_timer_));
+
+#ifdef NODE_MODULE_INIT
+  /* worker线程退出时实例不会被GC回收, 需要在环境清理时关闭 */
+  node::AddEnvironmentCleanupHook(isolate, EnvironmentCleanup, this);
+#endif
+}
+
+CtpMd::~CtpMd() {
+#ifdef NODE_MODULE_INIT
+  node::RemoveEnvironmentCleanupHook(isolate_, EnvironmentCleanup, this);
+#endif
+  Shutdown();
+  for (deque<ResponseBaton *>::iterator it = pending_.begin();
+       it != pending_.end(); ++it) {
+    pool_.Release(*it);
+  }
+  batch_callback_.Reset();
+  replay_callback_.Reset();
+  snapshot_callback_.Reset();
+  bar_callback_.Reset();
+  tick_ring_callback_.Reset();
+  tick_ring_buffer_.Reset();
+  timestamp_key_.Reset();
+  for (int i = 0; i < 3; ++i) {
+    delta_keys_[i].Reset();
+  }
+}
+
+/**
+ * 关闭实例
+ * @remark 环境退出时主线程已不再消费事件队列, 先标记关闭使后续事件直接丢弃,
+ * 再清空队列, 避免SPI线程阻塞在已满的队列上导致Release无法返回
+ */
+void CtpMd::Shutdown() {
+  closing_.store(true, std::memory_order_release);
+  api_ready_ = false;
+  ResponseBaton *baton = NULL;
+  while (queue_.TryPop(baton)) {
+    pool_.Release(baton);
+  }
+
+  if (api_) {
+    api_->RegisterSpi(NULL);
+    api_->Release();
+    api_ = NULL;
+  }
+  CancelReplay();
+
+  CloseHandle(async_);
+  CloseHandle(subscribe_timer_);
 }
 
-CtpMd::~CtpMd() { uv_close(reinterpret_cast<uv_handle_t *>(&async_), NULL); }
+void CtpMd::EnvironmentCleanup(void *arg) {
+  static_cast<CtpMd *>(arg)->Shutdown();
+}
 
 /**
  * 初始化C++类到Node模块
@@ -123,11 +230,41 @@ void CtpMd::InitNodeClass(Local<Object> exports) {
   NODE_SET_PROTOTYPE_METHOD(tpl, "reqUserLogout", ReqUserLogout);
   NODE_SET_PROTOTYPE_METHOD(tpl, "exit", Exit);
   NODE_SET_PROTOTYPE_METHOD(tpl, "on", On);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "addListener", AddListener);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "removeListener", RemoveListener);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableSnapshot", EnableSnapshot);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getSnapshot", GetSnapshot);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getSnapshots", GetSnapshots);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableBars", EnableBars);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setBarIntervals", SetBarIntervals);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableBatch", EnableBatch);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableRouting", EnableRouting);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setSubscriptions", SetSubscriptions);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "addSubscriptions", AddSubscriptions);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "removeSubscriptions", RemoveSubscriptions);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getSubscriptions", GetSubscriptions);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setConflation", SetConflation);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getConflationStats", GetConflationStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setFields", SetFields);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getStats", GetStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getQueueStats", GetQueueStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getPoolStats", GetPoolStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "startJournal", StartJournal);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "stopJournal", StopJournal);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "getJournalStats", GetJournalStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "replay", Replay);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "stopReplay", StopReplay);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableTickRing", EnableTickRing);
 
   constructor_.Reset(isolate, tpl->GetFunction());
   exports->Set(String::NewFromUtf8(isolate, "CtpMd"), tpl->GetFunction());
 }
 
+/**
+ * 释放当前线程的Node层构造函数
+ */
+void CtpMd::ReleaseNodeClass() { constructor_.Reset(); }
+
 /**
  * Node层构造函数
  */
@@ -136,14 +273,87 @@ void CtpMd::New(const FunctionCallbackInfo<Value> &args) {
 
   if (args.IsConstructCall()) {
     /* Invoked as constructor: `new CtpMd(...)` */
-    CtpMd *that = new CtpMd();
+    uint32_t queue_capacity = 65536;
+    uint32_t pool_capacity = 4096;
+    uint32_t subscribe_chunk = 100;
+    uint32_t subscribe_interval = 10;
+    OverflowPolicy queue_overflow = OVERFLOW_BLOCK;
+    bool sync_request = false;
+    bool timestamp = false;
+    bool deltas = false;
+    uint32_t delta_capacity = 4096;
+    InvalidDoubleMode invalid_price = INVALID_DOUBLE_KEEP;
+
+    if (args[0]->IsObject()) {
+      Local<Object> options = args[0]->ToObject();
+      string overflow;
+      string invalid;
+      GetNodeObjectUint32(isolate, options, "queueCapacity", queue_capacity);
+      GetNodeObjectString(isolate, options, "queueOverflow", overflow);
+      GetNodeObjectBool(isolate, options, "syncRequest", sync_request);
+      GetNodeObjectBool(isolate, options, "timestamp", timestamp);
+      GetNodeObjectBool(isolate, options, "deltas", deltas);
+      GetNodeObjectUint32(isolate, options, "deltaCapacity", delta_capacity);
+      GetNodeObjectUint32(isolate, options, "poolCapacity", pool_capacity);
+      GetNodeObjectString(isolate, options, "invalidPrice", invalid);
+      GetNodeObjectUint32(isolate, options, "subscribeChunk", subscribe_chunk);
+      GetNodeObjectUint32(isolate, options, "subscribeInterval",
+                          subscribe_interval);
+
+      if (!overflow.empty() &&
+          !ParseOverflowPolicy(overflow, queue_overflow)) {
+        isolate->ThrowException(Exception::TypeError(
+            String::NewFromUtf8(isolate, "Invalid queueOverflow")));
+        return;
+      }
+      if (!invalid.empty() && !ParseInvalidDoubleMode(invalid, invalid_price)) {
+        isolate->ThrowException(Exception::TypeError(
+            String::NewFromUtf8(isolate, "Invalid invalidPrice")));
+        return;
+      }
+      if (queue_capacity == 0) {
+        isolate->ThrowException(Exception::TypeError(
+            String::NewFromUtf8(isolate, "Invalid queueCapacity")));
+        return;
+      }
+      if (subscribe_chunk == 0) {
+        isolate->ThrowException(Exception::TypeError(
+            String::NewFromUtf8(isolate, "Invalid subscribeChunk")));
+        return;
+      }
+    }
+
+    CtpMd *that = new CtpMd(isolate, queue_capacity,
+                            queue_overflow, sync_request, pool_capacity,
+                            subscribe_chunk, subscribe_interval);
+    that->invalid_price_ = invalid_price;
+    that->depth_fields_.SetInvalidDouble(invalid_price);
+    if (timestamp) {
+      that->timestamp_key_.Reset(
+          isolate, String::NewFromUtf8(isolate, "Timestamp",
+                                       NewStringType::kInternalized)
+                       .ToLocalChecked());
+    }
+    if (deltas && delta_capacity > 0) {
+      static const char *kDeltaKeys[] = {"LastVolume", "LastTurnover",
+                                         "OIChange"};
+      that->tick_deltas_.reset(new TickDeltaTable(delta_capacity));
+      that->delta_capacity_ = delta_capacity;
+      for (int i = 0; i < 3; ++i) {
+        that->delta_keys_[i].Reset(
+            isolate, String::NewFromUtf8(isolate, kDeltaKeys[i],
+                                         NewStringType::kInternalized)
+                         .ToLocalChecked());
+      }
+    }
     that->Wrap(args.This());
     args.GetReturnValue().Set(args.This());
   } else {
-    /* Invoked as plain function `CtpMd()`, turn into constructor call */
+    /* Invoked as plain function `CtpMd(...)`, turn into constructor call */
     Local<Context> ctx = isolate->GetCurrentContext();
     Local<Function> cons = Local<Function>::New(isolate, constructor_);
-    Local<Object> ret = cons->NewInstance(ctx).ToLocalChecked();
+    Local<Value> argv[] = {args[0]};
+    Local<Object> ret = cons->NewInstance(ctx, 1, argv).ToLocalChecked();
     args.GetReturnValue().Set(ret);
   }
 }
@@ -156,26 +366,61 @@ void CtpMd::New(const FunctionCallbackInfo<Value> &args) {
 /**
  * 创建MdApi
  * @param pszFlowPath 存贮订阅信息文件的目录, 默认为当前目录
+ * @param options 传输方式{udp, multicast}, 可省略, 默认使用TCP
  * @return 创建出的UserApi
- * modify for udp marketdata
  */
 void CtpMd::CreateFtdcMdApi(const FunctionCallbackInfo<Value> &args) {
   Isolate *isolate = args.GetIsolate();
 
-  if (!args[0]->IsString() || !args[1]->IsFunction()) {
+  /* 兼容省略options的旧调用方式 */
+  int cb_index = args[1]->IsFunction() ? 1 : 2;
+  if (!args[0]->IsString() || !args[cb_index]->IsFunction() ||
+      (cb_index == 2 && !args[1]->IsObject())) {
     isolate->ThrowException(
         Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
     return;
   }
 
   CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+
+  /* exit之后事件句柄已关闭, 实例不能再使用 */
+  if (!that->async_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Instance has exited")));
+    return;
+  }
+  /* 回放线程与SPI线程共用单生产者队列, 不能同时运行 */
+  if (that->replayer_.Running()) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Cannot create API while replaying")));
+    return;
+  }
+  that->api_created_ = true;
+
   String::Utf8Value flow_path(args[0]);
-  Local<Function> cb = Local<Function>::Cast(args[1]);
+  Local<Function> cb = Local<Function>::Cast(args[cb_index]);
+
+  MdApiOptions *options = new MdApiOptions();
+  options->flow_path = *flow_path;
+  options->udp = false;
+  options->multicast = false;
+  if (cb_index == 2) {
+    Local<Object> obj = args[1]->ToObject();
+    GetNodeObjectBool(isolate, obj, "udp", options->udp);
+    GetNodeObjectBool(isolate, obj, "multicast", options->multicast);
+  }
+
+  /* 组播行情基于UDP */
+  if (options->multicast) {
+    options->udp = true;
+    that->transport_ = MD_TRANSPORT_MULTICAST;
+  } else {
+    that->transport_ = options->udp ? MD_TRANSPORT_UDP : MD_TRANSPORT_TCP;
+  }
 
-  RequestBaton *baton =
-      new RequestBaton(cb, that, EV_CREATE_FTDC_MD_API,
-                       shared_ptr<void>(new string(*flow_path)));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  RequestBaton *baton = new RequestBaton(cb, that, EV_CREATE_FTDC_MD_API,
+                                         shared_ptr<void>(options));
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -196,7 +441,7 @@ void CtpMd::GetApiVersion(const FunctionCallbackInfo<Value> &args) {
   Local<Function> cb = Local<Function>::Cast(args[0]);
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_GET_API_VERSION);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -224,7 +469,7 @@ void CtpMd::Init(const FunctionCallbackInfo<Value> &args) {
   Local<Function> cb = Local<Function>::Cast(args[0]);
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_INIT);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -253,7 +498,7 @@ void CtpMd::GetTradingDay(const FunctionCallbackInfo<Value> &args) {
   Local<Function> cb = Local<Function>::Cast(args[0]);
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_GET_TRADING_DAY);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -280,7 +525,7 @@ void CtpMd::RegisterFront(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_REGISTER_FRONT,
                                          shared_ptr<void>(new string(*addr)));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -308,7 +553,7 @@ void CtpMd::RegisterNameServer(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_REGISTER_NAME_SERVER,
                                          shared_ptr<void>(new string(*addr)));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -340,7 +585,7 @@ void CtpMd::RegisterFensUserInfo(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_REGISTER_FENS_USER_INFO,
                                          shared_ptr<void>(data));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -380,7 +625,7 @@ void CtpMd::SubscribeMarketData(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_SUBSCRIBE_MARKET_DATA,
                                          shared_ptr<void>(data));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -413,7 +658,7 @@ void CtpMd::UnSubscribeMarketData(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_UN_SUBSCRIBE_MARKET_DATA,
                                          shared_ptr<void>(data));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -446,7 +691,7 @@ void CtpMd::SubscribeForQuoteRsp(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_SUBSCRIBE_FOR_QUOTE_RSP,
                                          shared_ptr<void>(data));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -479,7 +724,7 @@ void CtpMd::UnSubscribeForQuoteRsp(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(
       cb, that, EV_UN_SUBSCRIBE_FOR_QUOTE_RSP, shared_ptr<void>(data));
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -529,8 +774,7 @@ void CtpMd::ReqUserLogin(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_REQ_USER_LOGIN,
                                          shared_ptr<void>(data), request_id);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
-                RequestAsyncAfter);
+  RequestSubmit(args, baton);
 }
 
 /**
@@ -560,8 +804,7 @@ void CtpMd::ReqUserLogout(const FunctionCallbackInfo<Value> &args) {
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_REQ_USER_LOGOUT,
                                          shared_ptr<void>(data), request_id);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
-                RequestAsyncAfter);
+  RequestSubmit(args, baton);
 }
 
 /**
@@ -578,9 +821,21 @@ void CtpMd::Exit(const FunctionCallbackInfo<Value> &args) {
 
   CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
   Local<Function> cb = Local<Function>::Cast(args[0]);
+  /* exit之后事件句柄已关闭, 实例不能再使用 */
+  if (!that->async_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Instance has exited")));
+    return;
+  }
+
+  /* API在线程池中释放, 此后不再发送订阅请求 */
+  that->exiting_ = true;
+  that->api_ready_ = false;
+  uv_timer_stop(that->subscribe_timer_);
+  that->subscriptions_.OnDisconnected();
 
   RequestBaton *baton = new RequestBaton(cb, that, EV_EXIT);
-  uv_queue_work(uv_default_loop(), &baton->work, RequestAsync,
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
                 RequestAsyncAfter);
 }
 
@@ -593,7 +848,7 @@ void CtpMd::Exit(const FunctionCallbackInfo<Value> &args) {
  * 当客户端与交易后台建立起通信连接时(还未登录前), 该方法被调用
  */
 void CtpMd::OnFrontConnected() {
-  ResponseAsyncSend(new ResponseBaton(EV_ON_FRONT_CONNECTED));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_FRONT_CONNECTED));
 }
 
 /**
@@ -607,8 +862,7 @@ void CtpMd::OnFrontConnected() {
  *         0x2003 收到错误报文
  */
 void CtpMd::OnFrontDisconnected(int reason) {
-  ResponseAsyncSend(new ResponseBaton(EV_ON_FRONT_DISCONNECTED,
-                                      shared_ptr<void>(new int(reason))));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_FRONT_DISCONNECTED, &reason));
 }
 
 /**
@@ -616,8 +870,7 @@ void CtpMd::OnFrontDisconnected(int reason) {
  * @param nTimeLapse 距离上次接收报文的时间
  */
 void CtpMd::OnHeartBeatWarning(int time_lapse) {
-  ResponseAsyncSend(new ResponseBaton(EV_ON_HEART_BEAT_WARNING,
-                                      shared_ptr<void>(new int(time_lapse))));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_HEART_BEAT_WARNING, &time_lapse));
 }
 
 /**
@@ -626,11 +879,8 @@ void CtpMd::OnHeartBeatWarning(int time_lapse) {
 void CtpMd::OnRspUserLogin(CThostFtdcRspUserLoginField *data,
                            CThostFtdcRspInfoField *error, int request_id,
                            bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_USER_LOGIN,
-      shared_ptr<void>(data ? new CThostFtdcRspUserLoginField(*data) : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_USER_LOGIN, data, error, request_id,
+                                  last));
 }
 
 /**
@@ -639,11 +889,8 @@ void CtpMd::OnRspUserLogin(CThostFtdcRspUserLoginField *data,
 void CtpMd::OnRspUserLogout(CThostFtdcUserLogoutField *data,
                             CThostFtdcRspInfoField *error, int request_id,
                             bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_USER_LOGOUT,
-      shared_ptr<void>(data ? new CThostFtdcUserLogoutField(*data) : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_USER_LOGOUT, data, error,
+                                  request_id, last));
 }
 
 /**
@@ -651,10 +898,8 @@ void CtpMd::OnRspUserLogout(CThostFtdcUserLogoutField *data,
  */
 void CtpMd::OnRspError(CThostFtdcRspInfoField *error, int request_id,
                        bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_ERROR,
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.AcquireError(EV_ON_RSP_ERROR, error, request_id,
+                                       last));
 }
 
 /**
@@ -663,12 +908,8 @@ void CtpMd::OnRspError(CThostFtdcRspInfoField *error, int request_id,
 void CtpMd::OnRspSubMarketData(CThostFtdcSpecificInstrumentField *data,
                                CThostFtdcRspInfoField *error, int request_id,
                                bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_SUB_MARKET_DATA,
-      shared_ptr<void>(data ? new CThostFtdcSpecificInstrumentField(*data)
-                            : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_SUB_MARKET_DATA, data, error,
+                                  request_id, last));
 }
 
 /**
@@ -677,12 +918,8 @@ void CtpMd::OnRspSubMarketData(CThostFtdcSpecificInstrumentField *data,
 void CtpMd::OnRspUnSubMarketData(CThostFtdcSpecificInstrumentField *data,
                                  CThostFtdcRspInfoField *error, int request_id,
                                  bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_UN_SUB_MARKET_DATA,
-      shared_ptr<void>(data ? new CThostFtdcSpecificInstrumentField(*data)
-                            : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_UN_SUB_MARKET_DATA, data, error,
+                                  request_id, last));
 }
 
 /**
@@ -691,12 +928,8 @@ void CtpMd::OnRspUnSubMarketData(CThostFtdcSpecificInstrumentField *data,
 void CtpMd::OnRspSubForQuoteRsp(CThostFtdcSpecificInstrumentField *data,
                                 CThostFtdcRspInfoField *error, int request_id,
                                 bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_SUB_FOR_QUOTE_RSP,
-      shared_ptr<void>(data ? new CThostFtdcSpecificInstrumentField(*data)
-                            : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_SUB_FOR_QUOTE_RSP, data, error,
+                                  request_id, last));
 }
 
 /**
@@ -705,31 +938,61 @@ void CtpMd::OnRspSubForQuoteRsp(CThostFtdcSpecificInstrumentField *data,
 void CtpMd::OnRspUnSubForQuoteRsp(CThostFtdcSpecificInstrumentField *data,
                                   CThostFtdcRspInfoField *error, int request_id,
                                   bool last) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RSP_UN_SUB_FOR_QUOTE_RSP,
-      shared_ptr<void>(data ? new CThostFtdcSpecificInstrumentField(*data)
-                            : NULL),
-      shared_ptr<void>(error ? new CThostFtdcRspInfoField(*error) : NULL),
-      request_id, last));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RSP_UN_SUB_FOR_QUOTE_RSP, data, error,
+                                  request_id, last));
 }
 
 /**
  * 深度行情通知
  */
 void CtpMd::OnRtnDepthMarketData(CThostFtdcDepthMarketDataField *data) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RTN_DEPTH_MARKET_DATA,
-      shared_ptr<void>(data ? new CThostFtdcDepthMarketDataField(*data)
-                            : NULL)));
+  journal_.Append(EV_ON_RTN_DEPTH_MARKET_DATA, data);
+
+  /* K线聚合, 只在K线完成或变更时唤醒主线程 */
+  BarBuilder *bars = bars_.load(std::memory_order_acquire);
+  bool forward = true;
+  if (bars && data) {
+    if (bars->Update(data)) {
+      uv_async_send(async_);
+    }
+    forward = bars->ForwardTicks();
+  }
+
+  /* 合并推送模式下只更新快照表, 变更的合约由主线程统一通知 */
+  SnapshotTable *snapshot = snapshot_.load(std::memory_order_acquire);
+  if (snapshot && data) {
+    bool notify = snapshot->Update(data);
+    if (snapshot->TrackChanges()) {
+      if (notify) {
+        uv_async_send(async_);
+      }
+      return;
+    }
+  }
+
+  if (!forward) {
+    return;
+  }
+
+  /* 零拷贝行情模式下直接写入环形缓冲区, 不再分配Baton */
+  TickRing *ring = tick_ring_.load(std::memory_order_acquire);
+  if (ring && data) {
+    ring->Push(data);
+    uv_async_send(async_);
+    return;
+  }
+
+  ResponseBaton *baton = pool_.Acquire(EV_ON_RTN_DEPTH_MARKET_DATA, data);
+  /* 实盘API与回放互斥, 传输方式在SPI线程或回放线程启动前设置 */
+  baton->source = transport_;
+  ResponseAsyncSend(baton);
 }
 
 /**
  * 询价通知
  */
 void CtpMd::OnRtnForQuoteRsp(CThostFtdcForQuoteRspField *data) {
-  ResponseAsyncSend(new ResponseBaton(
-      EV_ON_RTN_FOR_QUOTE_RSP,
-      shared_ptr<void>(data ? new CThostFtdcForQuoteRspField(*data) : NULL)));
+  ResponseAsyncSend(pool_.Acquire(EV_ON_RTN_FOR_QUOTE_RSP, data));
 }
 
 /* ---------------------------------------------------------------------------
@@ -762,812 +1025,1632 @@ void CtpMd::On(const FunctionCallbackInfo<Value> &args) {
 
 /* C++层每个事件只保存一个Node层回调函数, 如果事件已经注册则直接覆盖 */
 #if 0
-  unordered_map<int, Persistent<Function>>::iterator cIt =
-      that->callback_map_.find(eIt->second);
-  if (cIt != that->callback_map_.end()) {
+  if (that->listeners_.HasPrimary(eIt->second)) {
     isolate->ThrowException(
         Exception::Error(String::NewFromUtf8(isolate, "Duplicate event")));
     return;
   }
 #endif
 
-  that->callback_map_[eIt->second].Reset(isolate, cb);
+  that->listeners_.SetPrimary(isolate, eIt->second, cb);
 }
 
 /**
- * API请求异步执行时调用
+ * Node层添加SPI事件监听函数
  */
-void CtpMd::RequestAsync(uv_work_t *work) {
-  RequestBaton *baton = static_cast<RequestBaton *>(work->data);
-  CtpMd *that = static_cast<CtpMd *>(baton->that);
-
-  switch (baton->ev) {
-    case EV_CREATE_FTDC_MD_API: {
-      string *flow_path = static_cast<string *>(baton->data.get());
-      that->api_ = CThostFtdcMdApi::CreateFtdcMdApi(flow_path->c_str());
-      that->api_->RegisterSpi(that);
-      break;
-    }
-    case EV_GET_API_VERSION: {
-      baton->ret.s = shared_ptr<void>(new string(that->api_->GetApiVersion()));
-      break;
-    }
-    case EV_RELEASE: {
-      /* 未用 */
-      break;
-    }
-    case EV_INIT: {
-      that->api_->Init();
-      break;
-    }
-    case EV_JOIN: {
-      /* 未用 */
-      break;
-    }
-    case EV_GET_TRADING_DAY: {
-      baton->ret.s = shared_ptr<void>(new string(that->api_->GetTradingDay()));
-      break;
-    }
-    case EV_REGISTER_FRONT: {
-      string *addr = static_cast<string *>(baton->data.get());
-      that->api_->RegisterFront(const_cast<char *>(addr->c_str()));
-      break;
-    }
-    case EV_REGISTER_NAME_SERVER: {
-      string *addr = static_cast<string *>(baton->data.get());
-      that->api_->RegisterNameServer(const_cast<char *>(addr->c_str()));
-      break;
-    }
-    case EV_REGISTER_FENS_USER_INFO: {
-      CThostFtdcFensUserInfoField *data =
-          static_cast<CThostFtdcFensUserInfoField *>(baton->data.get());
-      that->api_->RegisterFensUserInfo(data);
-      break;
-    }
-    case EV_REGISTER_SPI: {
-      /* 未用 */
-      break;
-    }
-    case EV_SUBSCRIBE_MARKET_DATA: {
-      vector<string> *data = static_cast<vector<string> *>(baton->data.get());
-      vector<char *> vec;
+void CtpMd::AddListener(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
 
-      for (const auto &str : *data) {
-        vec.push_back(const_cast<char *>(str.c_str()));
-      }
+  if (!args[0]->IsString() || !args[1]->IsFunction() ||
+      !(args[2]->IsUndefined() || args[2]->IsArray())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
 
-      baton->ret.n = that->api_->SubscribeMarketData(&vec[0], vec.size());
-      break;
-    }
-    case EV_UN_SUBSCRIBE_MARKET_DATA: {
-      vector<string> *data = static_cast<vector<string> *>(baton->data.get());
-      vector<char *> vec;
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  String::Utf8Value ev(args[0]);
+  Local<Function> cb = Local<Function>::Cast(args[1]);
 
-      for (const auto &str : *data) {
-        vec.push_back(const_cast<char *>(str.c_str()));
-      }
+  unordered_map<string, int>::iterator eIt = event_map_.find(*ev);
+  if (eIt == event_map_.end()) {
+    isolate->ThrowException(
+        Exception::Error(String::NewFromUtf8(isolate, "Unknown event")));
+    return;
+  }
 
-      baton->ret.n = that->api_->UnSubscribeMarketData(&vec[0], vec.size());
-      break;
+  vector<string> instruments;
+  if (args[2]->IsArray()) {
+    Local<Array> ids = Local<Array>::Cast(args[2]);
+    for (uint32_t i = 0; i < ids->Length(); ++i) {
+      String::Utf8Value instrument_id(ids->Get(i));
+      instruments.push_back(*instrument_id);
     }
-    case EV_SUBSCRIBE_FOR_QUOTE_RSP: {
-      vector<string> *data = static_cast<vector<string> *>(baton->data.get());
-      vector<char *> vec;
-
-      for (const auto &str : *data) {
-        vec.push_back(const_cast<char *>(str.c_str()));
-      }
+  }
 
-      baton->ret.n = that->api_->SubscribeForQuoteRsp(&vec[0], vec.size());
-      break;
-    }
-    case EV_UN_SUBSCRIBE_FOR_QUOTE_RSP: {
-      vector<string> *data = static_cast<vector<string> *>(baton->data.get());
-      vector<char *> vec;
+  uint32_t id = that->listeners_.Add(isolate, eIt->second, cb, instruments);
+  args.GetReturnValue().Set(id);
+}
 
-      for (const auto &str : *data) {
-        vec.push_back(const_cast<char *>(str.c_str()));
-      }
+/**
+ * Node层移除SPI事件监听函数
+ */
+void CtpMd::RemoveListener(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
 
-      baton->ret.n = that->api_->UnSubscribeForQuoteRsp(&vec[0], vec.size());
-      break;
-    }
-    case EV_REQ_USER_LOGIN: {
-      CThostFtdcReqUserLoginField *data =
-          static_cast<CThostFtdcReqUserLoginField *>(baton->data.get());
-      baton->ret.n = that->api_->ReqUserLogin(data, baton->request_id);
-      break;
-    }
-    case EV_REQ_USER_LOGOUT: {
-      CThostFtdcUserLogoutField *data =
-          static_cast<CThostFtdcUserLogoutField *>(baton->data.get());
-      baton->ret.n = that->api_->ReqUserLogout(data, baton->request_id);
-      break;
-    }
-    case EV_EXIT: {
-      if (that->api_) {
-        that->api_->RegisterSpi(NULL);
-        that->api_->Release();
-        that->api_ = NULL;
-      }
-      /* 释放Node默认循环的引用计数, 使其可以在没有其它事件时可以正常退出 */
-      uv_unref(reinterpret_cast<uv_handle_t *>(&that->async_));
-      break;
-    }
-    default: {
-      baton->errmsg = "Unknown request event";
-      break;
-    }
+  if (!args[0]->IsUint32()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
   }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  args.GetReturnValue().Set(
+      that->listeners_.Remove(isolate, args[0]->Uint32Value()));
 }
 
 /**
- * API请求异步执行完成时调用
+ * 开启零拷贝行情模式
  */
-void CtpMd::RequestAsyncAfter(uv_work_t *work, int status) {
-  Isolate *isolate = Isolate::GetCurrent();
-  HandleScope scope(isolate);
-  Local<Object> ctx = isolate->GetCurrentContext()->Global();
-  RequestBaton *baton = static_cast<RequestBaton *>(work->data);
-  Local<Function> cb = Local<Function>::New(isolate, baton->callback);
+void CtpMd::EnableTickRing(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
 
-  /* 如果异步执行时出现错误，则将Node层回调函数第一个参数置为对应错误信息
-   */
-  if (!baton->errmsg.empty()) {
-    Local<Value> argv[] = {
-        Exception::Error(String::NewFromUtf8(isolate, baton->errmsg.c_str()))};
-    MakeCallback(isolate, ctx, cb, 1, argv);
+  if (!args[0]->IsUint32() || !args[1]->IsFunction()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
     return;
   }
 
-  switch (baton->ev) {
-    /* 以下事件无返回 */
-    case EV_CREATE_FTDC_MD_API:
-    case EV_RELEASE:
-    case EV_INIT:
-    case EV_JOIN:
-    case EV_REGISTER_FRONT:
-    case EV_REGISTER_NAME_SERVER:
-    case EV_REGISTER_FENS_USER_INFO:
-    case EV_REGISTER_SPI:
-    case EV_EXIT: {
-      MakeCallback(isolate, ctx, cb, 0, NULL);
-      break;
-    }
-
-    /* 以下事件返回String */
-    case EV_GET_API_VERSION:
-    case EV_GET_TRADING_DAY: {
-      string *ret = static_cast<string *>(baton->ret.s.get());
-      Local<Value> argv[] = {Null(isolate),
-                             String::NewFromUtf8(isolate, ret->c_str())};
-      MakeCallback(isolate, ctx, cb, 2, argv);
-      break;
-    }
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  uint32_t capacity = TickRing::RoundCapacity(args[0]->Uint32Value());
+  Local<Function> cb = Local<Function>::Cast(args[1]);
 
-    /* 以下事件返回Number */
-    case EV_SUBSCRIBE_MARKET_DATA:
-    case EV_UN_SUBSCRIBE_MARKET_DATA:
-    case EV_SUBSCRIBE_FOR_QUOTE_RSP:
-    case EV_UN_SUBSCRIBE_FOR_QUOTE_RSP:
-    case EV_REQ_USER_LOGIN:
-    case EV_REQ_USER_LOGOUT: {
-      Local<Value> argv[] = {Null(isolate), Number::New(isolate, baton->ret.n)};
-      MakeCallback(isolate, ctx, cb, 2, argv);
-      break;
-    }
-    default: { break; }
+  if (that->tick_ring_holder_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Tick ring already enabled")));
+    return;
   }
 
-  delete baton;
-}
+  /* 由V8分配并持有缓冲区内存, ArrayBuffer的内存不会被GC移动 */
+  Local<ArrayBuffer> buffer =
+      ArrayBuffer::New(isolate, TickRing::ByteLength(capacity));
 
-/**
- * 从其它线程向主线程中发送事件
- */
-void CtpMd::ResponseAsyncSend(ResponseBaton *baton) {
-  queue_.Push(baton);
-  async_.data = this;
-  uv_async_send(&async_);
+  that->tick_ring_buffer_.Reset(isolate, buffer);
+  that->tick_ring_callback_.Reset(isolate, cb);
+  that->tick_ring_holder_.reset(
+      new TickRing(buffer->GetContents().Data(), capacity,
+                   that->invalid_price_ != INVALID_DOUBLE_KEEP,
+                   that->delta_capacity_));
+  that->tick_ring_.store(that->tick_ring_holder_.get(),
+                         std::memory_order_release);
+
+  args.GetReturnValue().Set(buffer);
 }
 
 /**
- * 主线程中SPI事件处理函数
+ * 开启最新行情快照表
  */
-void CtpMd::ResponseAsyncAfter(uv_async_t *async) {
-  Isolate *isolate = Isolate::GetCurrent();
-  HandleScope scope(isolate);
+void CtpMd::EnableSnapshot(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsUint32() || args[0]->Uint32Value() == 0 ||
+      !(args[1]->IsUndefined() || args[1]->IsFunction())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  if (that->snapshot_holder_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Snapshot already enabled")));
+    return;
+  }
+
+  bool conflate = args[1]->IsFunction();
+  if (conflate) {
+    that->snapshot_callback_.Reset(isolate, Local<Function>::Cast(args[1]));
+  }
+
+  that->snapshot_holder_.reset(
+      new SnapshotTable(args[0]->Uint32Value(), conflate));
+  that->snapshot_.store(that->snapshot_holder_.get(),
+                        std::memory_order_release);
+}
+
+/**
+ * 读取合约的最新行情快照
+ */
+void CtpMd::GetSnapshot(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsString()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  SnapshotTable *snapshot = that->snapshot_holder_.get();
+  String::Utf8Value instrument_id(args[0]);
+  CThostFtdcDepthMarketDataField data;
+
+  if (snapshot && snapshot->Get(*instrument_id, data)) {
+    args.GetReturnValue().Set(that->NewDepthMarketData(isolate, &data));
+  }
+}
+
+/**
+ * 批量读取最新行情快照
+ */
+void CtpMd::GetSnapshots(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!(args[0]->IsUndefined() || args[0]->IsArray())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  SnapshotTable *snapshot = that->snapshot_holder_.get();
+  Local<Array> ret = Array::New(isolate);
+  CThostFtdcDepthMarketDataField data;
+
+  if (!snapshot) {
+    args.GetReturnValue().Set(ret);
+    return;
+  }
+
+  if (args[0]->IsArray()) {
+    Local<Array> ids = Local<Array>::Cast(args[0]);
+    ret = Array::New(isolate, ids->Length());
+    for (uint32_t i = 0; i < ids->Length(); ++i) {
+      Local<Value> id = ids->Get(i);
+      if (!id->IsString()) {
+        continue;
+      }
+      String::Utf8Value instrument_id(id);
+      if (snapshot->Get(*instrument_id, data)) {
+        ret->Set(i, that->NewDepthMarketData(isolate, &data));
+      }
+    }
+  } else {
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < snapshot->Slots(); ++i) {
+      if (snapshot->Get(i, data)) {
+        ret->Set(count++, that->NewDepthMarketData(isolate, &data));
+      }
+    }
+  }
+
+  args.GetReturnValue().Set(ret);
+}
+
+/**
+ * Node层合约代码数组->合约代码列表
+ */
+static vector<string> GetInstrumentIds(Local<Array> array) {
+  vector<string> ids;
+  for (uint32_t i = 0; i < array->Length(); ++i) {
+    Local<Value> v = array->Get(i);
+    if (v->IsString()) {
+      ids.push_back(string(*String::Utf8Value(v)));
+    }
+  }
+  return ids;
+}
+
+/**
+ * Node层周期数组->K线周期列表
+ * @return 不是非负整数数组或超过kMaxBarIntervals个时返回false
+ */
+static bool GetBarIntervals(Local<Value> value, vector<uint32_t> &out) {
+  if (!value->IsArray()) {
+    return false;
+  }
+  Local<Array> array = Local<Array>::Cast(value);
+  if (array->Length() > static_cast<uint32_t>(kMaxBarIntervals)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < array->Length(); ++i) {
+    Local<Value> v = array->Get(i);
+    if (!v->IsUint32()) {
+      return false;
+    }
+    out.push_back(v->Uint32Value());
+  }
+  return true;
+}
+
+/**
+ * K线->Node层对象
+ */
+static Local<Object> NewBarObject(Isolate *isolate, const Bar &bar,
+                                  bool closed) {
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "InstrumentID"),
+           GetInternTable().Get(isolate, bar.InstrumentID,
+                                strlen(bar.InstrumentID)));
+  obj->Set(String::NewFromUtf8(isolate, "TradingDay"),
+           GetInternTable().Get(isolate, bar.TradingDay,
+                                strlen(bar.TradingDay)));
+  obj->Set(String::NewFromUtf8(isolate, "Interval"),
+           Number::New(isolate, bar.Interval));
+  obj->Set(String::NewFromUtf8(isolate, "StartTime"),
+           Number::New(isolate, bar.StartTime));
+  obj->Set(String::NewFromUtf8(isolate, "EndTime"),
+           Number::New(isolate, bar.EndTime));
+  obj->Set(String::NewFromUtf8(isolate, "OpenPrice"),
+           Number::New(isolate, bar.OpenPrice));
+  obj->Set(String::NewFromUtf8(isolate, "HighestPrice"),
+           Number::New(isolate, bar.HighestPrice));
+  obj->Set(String::NewFromUtf8(isolate, "LowestPrice"),
+           Number::New(isolate, bar.LowestPrice));
+  obj->Set(String::NewFromUtf8(isolate, "ClosePrice"),
+           Number::New(isolate, bar.ClosePrice));
+  obj->Set(String::NewFromUtf8(isolate, "Volume"),
+           Number::New(isolate, static_cast<double>(bar.Volume)));
+  obj->Set(String::NewFromUtf8(isolate, "Turnover"),
+           Number::New(isolate, bar.Turnover));
+  obj->Set(String::NewFromUtf8(isolate, "OpenInterest"),
+           Number::New(isolate, bar.OpenInterest));
+  obj->Set(String::NewFromUtf8(isolate, "TickCount"),
+           Number::New(isolate, bar.TickCount));
+  obj->Set(String::NewFromUtf8(isolate, "Closed"),
+           Boolean::New(isolate, closed));
+  return obj;
+}
+
+/**
+ * 开启K线聚合
+ */
+void CtpMd::EnableBars(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  vector<uint32_t> intervals;
+
+  if (!GetBarIntervals(args[0], intervals) || !args[1]->IsObject() ||
+      !args[2]->IsFunction()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  if (that->bars_holder_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Bars already enabled")));
+    return;
+  }
+
+  Local<Object> options = args[1]->ToObject();
+  uint32_t capacity = 4096;
+  bool updates = false;
+  bool ticks = false;
+  GetNodeObjectUint32(isolate, options, "capacity", capacity);
+  GetNodeObjectBool(isolate, options, "updates", updates);
+  GetNodeObjectBool(isolate, options, "ticks", ticks);
+  if (capacity == 0) {
+    isolate->ThrowException(Exception::TypeError(
+        String::NewFromUtf8(isolate, "Invalid capacity")));
+    return;
+  }
+
+  that->bar_callback_.Reset(isolate, Local<Function>::Cast(args[2]));
+  that->bars_holder_.reset(new BarBuilder(capacity, updates, ticks));
+  that->bars_holder_->SetIntervals(intervals, vector<string>());
+  that->bars_.store(that->bars_holder_.get(), std::memory_order_release);
+}
+
+/**
+ * 设置K线周期
+ */
+void CtpMd::SetBarIntervals(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  vector<uint32_t> intervals;
+
+  if (!GetBarIntervals(args[0], intervals) ||
+      !(args[1]->IsUndefined() || args[1]->IsArray())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  if (!that->bars_holder_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Bars not enabled")));
+    return;
+  }
+
+  vector<string> instrument_ids;
+  if (args[1]->IsArray()) {
+    instrument_ids = GetInstrumentIds(Local<Array>::Cast(args[1]));
+  }
+  that->bars_holder_->SetIntervals(intervals, instrument_ids);
+}
+
+/**
+ * 开启批量事件模式
+ */
+void CtpMd::EnableBatch(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsUint32() || !args[1]->IsUint32() || !args[2]->IsFunction() ||
+      args[0]->Uint32Value() == 0) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  Local<Function> cb = Local<Function>::Cast(args[2]);
+
+  for (unordered_map<string, int>::iterator it = event_map_.begin();
+       it != event_map_.end(); ++it) {
+    that->event_names_[it->second].Reset(
+        isolate, String::NewFromUtf8(isolate, it->first.c_str(),
+                                     NewStringType::kInternalized)
+                     .ToLocalChecked());
+  }
+
+  that->batch_size_ = args[0]->Uint32Value();
+  that->batch_latency_ = args[1]->Uint32Value();
+  that->batch_callback_.Reset(isolate, cb);
+}
+
+/**
+ * 开启深度行情按合约路由
+ */
+void CtpMd::EnableRouting(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!(args[0]->IsUndefined() || args[0]->IsBoolean())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  bool enabled = args[0]->IsUndefined() || args[0]->BooleanValue();
+  that->listeners_.SetRouted(EV_ON_RTN_DEPTH_MARKET_DATA, enabled);
+}
+
+/**
+ * 设置行情订阅集合
+ */
+void CtpMd::SetSubscriptions(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsArray()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  uint32_t added = 0;
+  uint32_t removed = 0;
+  that->subscriptions_.Set(GetInstrumentIds(Local<Array>::Cast(args[0])),
+                           uv_hrtime(), added, removed);
+  that->SubscriptionSchedule();
+
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "added"), Number::New(isolate, added));
+  obj->Set(String::NewFromUtf8(isolate, "removed"),
+           Number::New(isolate, removed));
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 加入行情订阅集合
+ */
+void CtpMd::AddSubscriptions(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsArray()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  uint32_t added = that->subscriptions_.Add(
+      GetInstrumentIds(Local<Array>::Cast(args[0])), uv_hrtime());
+  that->SubscriptionSchedule();
+  args.GetReturnValue().Set(added);
+}
+
+/**
+ * 移出行情订阅集合
+ */
+void CtpMd::RemoveSubscriptions(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsArray()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  uint32_t removed = that->subscriptions_.Remove(
+      GetInstrumentIds(Local<Array>::Cast(args[0])));
+  that->SubscriptionSchedule();
+  args.GetReturnValue().Set(removed);
+}
+
+/**
+ * 读取行情订阅集合状态
+ */
+void CtpMd::GetSubscriptions(const FunctionCallbackInfo<Value> &args) {
+  static const char *kStateNames[] = {"pending", "sent", "active", "failed"};
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  bool reset = false;
+
+  if (args[0]->IsObject()) {
+    GetNodeObjectBool(isolate, args[0]->ToObject(), "reset", reset);
+  }
+
+  const unordered_map<string, SubscriptionEntry> &entries =
+      that->subscriptions_.Entries();
+  Local<Object> instruments = Object::New(isolate);
+  for (unordered_map<string, SubscriptionEntry>::const_iterator it =
+           entries.begin();
+       it != entries.end(); ++it) {
+    const SubscriptionEntry &entry = it->second;
+    Local<Object> item = Object::New(isolate);
+    item->Set(String::NewFromUtf8(isolate, "state"),
+              String::NewFromUtf8(isolate, kStateNames[entry.state]));
+    if (entry.first_tick > entry.since) {
+      item->Set(String::NewFromUtf8(isolate, "latency"),
+                Number::New(isolate, entry.first_tick - entry.since));
+    } else {
+      item->Set(String::NewFromUtf8(isolate, "latency"), Null(isolate));
+    }
+    instruments->Set(String::NewFromUtf8(isolate, it->first.c_str()), item);
+  }
+
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "loggedIn"),
+           Boolean::New(isolate, that->subscriptions_.LoggedIn()));
+  obj->Set(String::NewFromUtf8(isolate, "pending"),
+           Boolean::New(isolate, that->subscriptions_.Pending()));
+  obj->Set(String::NewFromUtf8(isolate, "latency"),
+           NewNodeHistogram(isolate,
+                            that->subscriptions_.FirstTickLatency()));
+  obj->Set(String::NewFromUtf8(isolate, "instruments"), instruments);
+
+  if (reset) {
+    that->subscriptions_.ResetLatency();
+  }
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 设置深度行情合并策略
+ */
+void CtpMd::SetConflation(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsUint32() ||
+      !(args[1]->IsUndefined() || args[1]->IsArray())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  uint32_t depth = args[0]->Uint32Value();
+
+  if (args[1]->IsUndefined()) {
+    that->conflation_.SetDepth(depth);
+    return;
+  }
+
+  Local<Array> ids = Local<Array>::Cast(args[1]);
+  for (uint32_t i = 0; i < ids->Length(); ++i) {
+    String::Utf8Value instrument_id(ids->Get(i));
+    that->conflation_.SetDepth(*instrument_id, depth);
+  }
+}
+
+/**
+ * 读取各合约被合并丢弃的行情条数
+ */
+void CtpMd::GetConflationStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+
+  Local<Object> obj = Object::New(isolate);
+  for (uint32_t i = 0; i < that->conflation_.Slots(); ++i) {
+    const char *instrument_id = that->conflation_.Key(i);
+    uint64_t dropped = that->conflation_.Dropped(i);
+    if (instrument_id && dropped > 0) {
+      obj->Set(String::NewFromUtf8(isolate, instrument_id),
+               Number::New(isolate, dropped));
+    }
+  }
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 设置事件转换的字段投影
+ */
+void CtpMd::SetFields(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsString() ||
+      !(args[1]->IsUndefined() || args[1]->IsArray())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  String::Utf8Value event(args[0]);
+
+  if (strcmp(*event, "RtnDepthMarketData") != 0) {
+    isolate->ThrowException(Exception::Error(String::NewFromUtf8(
+        isolate, "Field projection is not supported for this event")));
+    return;
+  }
+
+  Local<Array> names =
+      args[1]->IsArray() ? Local<Array>::Cast(args[1]) : Array::New(isolate);
+  string unknown;
+  if (!that->depth_fields_.Compile(
+          names,
+          GetFieldTable(
+              static_cast<const CThostFtdcDepthMarketDataField *>(NULL)),
+          unknown)) {
+    isolate->ThrowException(Exception::TypeError(String::NewFromUtf8(
+        isolate, ("Unknown field: " + unknown).c_str())));
+  }
+}
+
+/**
+ * 行情传输方式->Node层名称
+ */
+static const char *TransportName(MdTransport transport) {
+  switch (transport) {
+    case MD_TRANSPORT_UDP:
+      return "udp";
+    case MD_TRANSPORT_MULTICAST:
+      return "multicast";
+    case MD_TRANSPORT_REPLAY:
+      return "replay";
+    default:
+      return "tcp";
+  }
+}
+
+/**
+ * 读取SPI事件延迟统计
+ */
+void CtpMd::GetStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  bool reset = false;
+
+  if (args[0]->IsObject()) {
+    GetNodeObjectBool(isolate, args[0]->ToObject(), "reset", reset);
+  }
+
+  Local<Object> obj = Object::New(isolate);
+  for (unordered_map<string, int>::iterator it = event_map_.begin();
+       it != event_map_.end(); ++it) {
+    unordered_map<int, EventStats>::iterator sIt =
+        that->stats_.find(it->second);
+    if (sIt == that->stats_.end()) {
+      continue;
+    }
+    obj->Set(String::NewFromUtf8(isolate, it->first.c_str()),
+             NewNodeEventStats(isolate, sIt->second));
+  }
+
+  /* 深度行情按传输方式分别输出, 便于比较不同传输方式 */
+  Local<Object> transports = Object::New(isolate);
+  bool has_transport = false;
+  for (int transport = MD_TRANSPORT_TCP; transport <= MD_TRANSPORT_REPLAY;
+       ++transport) {
+    unordered_map<int, EventStats>::iterator sIt =
+        that->stats_.find(kTransportStats - transport);
+    if (sIt == that->stats_.end()) {
+      continue;
+    }
+    transports->Set(
+        String::NewFromUtf8(isolate,
+                            TransportName(static_cast<MdTransport>(transport))),
+        NewNodeEventStats(isolate, sIt->second));
+    has_transport = true;
+  }
+  if (has_transport) {
+    obj->Set(String::NewFromUtf8(isolate, "RtnDepthMarketData"), transports);
+  }
+
+  unordered_map<int, EventStats>::iterator sIt =
+      that->stats_.find(kBatchStats);
+  if (sIt != that->stats_.end()) {
+    obj->Set(String::NewFromUtf8(isolate, "Batch"),
+             NewNodeEventStats(isolate, sIt->second));
+  }
+
+  if (reset) {
+    that->stats_.clear();
+  }
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 读取SPI事件队列统计计数
+ */
+void CtpMd::GetQueueStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  QueueStats stats = that->queue_.Stats();
+
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "capacity"),
+           Number::New(isolate, stats.capacity));
+  obj->Set(String::NewFromUtf8(isolate, "size"),
+           Number::New(isolate, stats.size));
+  obj->Set(String::NewFromUtf8(isolate, "pushed"),
+           Number::New(isolate, stats.pushed));
+  obj->Set(String::NewFromUtf8(isolate, "popped"),
+           Number::New(isolate, stats.popped));
+  obj->Set(String::NewFromUtf8(isolate, "dropped"),
+           Number::New(isolate, stats.dropped));
+  obj->Set(String::NewFromUtf8(isolate, "blocked"),
+           Number::New(isolate, stats.blocked));
+  obj->Set(String::NewFromUtf8(isolate, "highWater"),
+           Number::New(isolate, stats.high_water));
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 读取SPI响应Baton对象池统计计数
+ */
+void CtpMd::GetPoolStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  vector<BatonPoolStats> stats = that->pool_.Stats();
+
+  Local<Array> arr = Array::New(isolate, stats.size());
+  for (size_t i = 0; i < stats.size(); ++i) {
+    Local<Object> obj = Object::New(isolate);
+    obj->Set(String::NewFromUtf8(isolate, "size"),
+             Number::New(isolate, stats[i].size));
+    obj->Set(String::NewFromUtf8(isolate, "allocated"),
+             Number::New(isolate, stats[i].allocated));
+    obj->Set(String::NewFromUtf8(isolate, "inUse"),
+             Number::New(isolate, stats[i].in_use));
+    obj->Set(String::NewFromUtf8(isolate, "highWater"),
+             Number::New(isolate, stats[i].high_water));
+    obj->Set(String::NewFromUtf8(isolate, "hits"),
+             Number::New(isolate, stats[i].hits));
+    obj->Set(String::NewFromUtf8(isolate, "misses"),
+             Number::New(isolate, stats[i].misses));
+    arr->Set(i, obj);
+  }
+
+  args.GetReturnValue().Set(arr);
+}
+
+/**
+ * 开始记录SPI事件二进制日志
+ */
+void CtpMd::StartJournal(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsString() ||
+      !(args[1]->IsUndefined() || args[1]->IsNumber())) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  String::Utf8Value path(args[0]);
+  uint64_t segment_size = 64 << 20;
+  if (args[1]->IsNumber()) {
+    segment_size = static_cast<uint64_t>(args[1]->NumberValue());
+  }
+
+  string error;
+  if (!that->journal_.Open(*path, segment_size, error)) {
+    isolate->ThrowException(
+        Exception::Error(String::NewFromUtf8(isolate, error.c_str())));
+  }
+}
+
+/**
+ * 停止记录SPI事件二进制日志
+ */
+void CtpMd::StopJournal(const FunctionCallbackInfo<Value> &args) {
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  that->journal_.Close();
+}
+
+/**
+ * 读取SPI事件二进制日志统计计数
+ */
+void CtpMd::GetJournalStats(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  JournalStats stats = that->journal_.Stats();
+
+  Local<Object> obj = Object::New(isolate);
+  obj->Set(String::NewFromUtf8(isolate, "segments"),
+           Number::New(isolate, stats.segments));
+  obj->Set(String::NewFromUtf8(isolate, "records"),
+           Number::New(isolate, stats.records));
+  obj->Set(String::NewFromUtf8(isolate, "bytes"),
+           Number::New(isolate, stats.bytes));
+  obj->Set(String::NewFromUtf8(isolate, "errors"),
+           Number::New(isolate, stats.errors));
+
+  args.GetReturnValue().Set(obj);
+}
+
+/**
+ * 回放SPI事件二进制日志
+ */
+void CtpMd::Replay(const FunctionCallbackInfo<Value> &args) {
+  Isolate *isolate = args.GetIsolate();
+
+  if (!args[0]->IsString() || !args[1]->IsNumber() ||
+      !args[2]->IsFunction()) {
+    isolate->ThrowException(
+        Exception::TypeError(String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  String::Utf8Value path(args[0]);
+  double speed = args[1]->NumberValue();
+  Local<Function> cb = Local<Function>::Cast(args[2]);
+
+  /* exit之后事件句柄已关闭, 实例不能再使用 */
+  if (!that->async_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Instance has exited")));
+    return;
+  }
+  /* 回放线程与SPI线程共用单生产者队列, 不能同时运行 */
+  if (that->api_created_) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Cannot replay after API created")));
+    return;
+  }
+  if (that->replayer_.Running()) {
+    isolate->ThrowException(Exception::Error(
+        String::NewFromUtf8(isolate, "Replay already running")));
+    return;
+  }
+
+  /* 回放线程读取传输方式, 需要在启动前设置 */
+  string error;
+  MdTransport transport = that->transport_;
+  that->transport_ = MD_TRANSPORT_REPLAY;
+  if (!that->replayer_.Start(*path, "md", speed > 0 ? speed : 0,
+                             ReplayEvent, ReplayDone, that, error)) {
+    that->transport_ = transport;
+    isolate->ThrowException(
+        Exception::Error(String::NewFromUtf8(isolate, error.c_str())));
+    return;
+  }
+  that->replay_callback_.Reset(isolate, cb);
+}
+
+/**
+ * 停止回放
+ */
+void CtpMd::StopReplay(const FunctionCallbackInfo<Value> &args) {
+  CtpMd *that = ObjectWrap::Unwrap<CtpMd>(args.Holder());
+  that->CancelReplay();
+}
+
+/**
+ * 提交API请求
+ */
+void CtpMd::RequestSubmit(const FunctionCallbackInfo<Value> &args,
+                          RequestBaton *baton) {
+  CtpMd *that = static_cast<CtpMd *>(baton->that);
+
+  if (that->sync_request_) {
+    /* CTP的Req*接口只将请求写入发送缓冲区, 不会阻塞, 可直接在主线程中调用 */
+    RequestAsync(&baton->work);
+    /* 返回值即CTP返回值, 由Node层据此完成Promise, 不再在调用者的栈帧内回调 */
+    if (!baton->errmsg.empty()) {
+      args.GetIsolate()->ThrowException(Exception::Error(String::NewFromUtf8(
+          args.GetIsolate(), baton->errmsg.c_str())));
+    } else {
+      args.GetReturnValue().Set(baton->ret.n);
+    }
+    delete baton;
+    return;
+  }
+
+  uv_queue_work(that->loop_, &baton->work, RequestAsync,
+                RequestAsyncAfter);
+}
+
+/**
+ * API请求异步执行时调用
+ */
+void CtpMd::RequestAsync(uv_work_t *work) {
+  RequestBaton *baton = static_cast<RequestBaton *>(work->data);
+  CtpMd *that = static_cast<CtpMd *>(baton->that);
+
+  switch (baton->ev) {
+    case EV_CREATE_FTDC_MD_API: {
+      MdApiOptions *options = baton->Data<MdApiOptions>();
+      that->api_ = CThostFtdcMdApi::CreateFtdcMdApi(
+          options->flow_path.c_str(), options->udp, options->multicast);
+      that->api_->RegisterSpi(that);
+      break;
+    }
+    case EV_GET_API_VERSION: {
+      baton->ret.s = shared_ptr<void>(new string(that->api_->GetApiVersion()));
+      break;
+    }
+    case EV_RELEASE: {
+      /* 未用 */
+      break;
+    }
+    case EV_INIT: {
+      that->api_->Init();
+      break;
+    }
+    case EV_JOIN: {
+      /* 未用 */
+      break;
+    }
+    case EV_GET_TRADING_DAY: {
+      baton->ret.s = shared_ptr<void>(new string(that->api_->GetTradingDay()));
+      break;
+    }
+    case EV_REGISTER_FRONT: {
+      string *addr = baton->Data<string>();
+      that->api_->RegisterFront(const_cast<char *>(addr->c_str()));
+      break;
+    }
+    case EV_REGISTER_NAME_SERVER: {
+      string *addr = baton->Data<string>();
+      that->api_->RegisterNameServer(const_cast<char *>(addr->c_str()));
+      break;
+    }
+    case EV_REGISTER_FENS_USER_INFO: {
+      CThostFtdcFensUserInfoField *data =
+          baton->Data<CThostFtdcFensUserInfoField>();
+      that->api_->RegisterFensUserInfo(data);
+      break;
+    }
+    case EV_REGISTER_SPI: {
+      /* 未用 */
+      break;
+    }
+    case EV_SUBSCRIBE_MARKET_DATA: {
+      vector<string> *data = baton->Data<vector<string>>();
+      vector<char *> vec;
+
+      for (const auto &str : *data) {
+        vec.push_back(const_cast<char *>(str.c_str()));
+      }
+
+      baton->ret.n = that->api_->SubscribeMarketData(&vec[0], vec.size());
+      break;
+    }
+    case EV_UN_SUBSCRIBE_MARKET_DATA: {
+      vector<string> *data = baton->Data<vector<string>>();
+      vector<char *> vec;
+
+      for (const auto &str : *data) {
+        vec.push_back(const_cast<char *>(str.c_str()));
+      }
+
+      baton->ret.n = that->api_->UnSubscribeMarketData(&vec[0], vec.size());
+      break;
+    }
+    case EV_SUBSCRIBE_FOR_QUOTE_RSP: {
+      vector<string> *data = baton->Data<vector<string>>();
+      vector<char *> vec;
+
+      for (const auto &str : *data) {
+        vec.push_back(const_cast<char *>(str.c_str()));
+      }
+
+      baton->ret.n = that->api_->SubscribeForQuoteRsp(&vec[0], vec.size());
+      break;
+    }
+    case EV_UN_SUBSCRIBE_FOR_QUOTE_RSP: {
+      vector<string> *data = baton->Data<vector<string>>();
+      vector<char *> vec;
+
+      for (const auto &str : *data) {
+        vec.push_back(const_cast<char *>(str.c_str()));
+      }
+
+      baton->ret.n = that->api_->UnSubscribeForQuoteRsp(&vec[0], vec.size());
+      break;
+    }
+    case EV_REQ_USER_LOGIN: {
+      CThostFtdcReqUserLoginField *data =
+          baton->Data<CThostFtdcReqUserLoginField>();
+      baton->ret.n = that->api_->ReqUserLogin(data, baton->request_id);
+      break;
+    }
+    case EV_REQ_USER_LOGOUT: {
+      CThostFtdcUserLogoutField *data =
+          baton->Data<CThostFtdcUserLogoutField>();
+      baton->ret.n = that->api_->ReqUserLogout(data, baton->request_id);
+      break;
+    }
+    case EV_EXIT: {
+      if (that->api_) {
+        that->api_->RegisterSpi(NULL);
+        that->api_->Release();
+        that->api_ = NULL;
+      }
+      break;
+    }
+    default: {
+      baton->errmsg = "Unknown request event";
+      break;
+    }
+  }
+}
+
+/**
+ * API请求异步执行完成时调用
+ */
+void CtpMd::RequestAsyncAfter(uv_work_t *work, int status) {
+  Isolate *isolate = Isolate::GetCurrent();
+  HandleScope scope(isolate);
   Local<Object> ctx = isolate->GetCurrentContext()->Global();
-  CtpMd *that = static_cast<CtpMd *>(async->data);
-  ResponseBaton *baton = NULL;
+  RequestBaton *baton = static_cast<RequestBaton *>(work->data);
+  Local<Function> cb = Local<Function>::New(isolate, baton->callback);
 
-  while (that->queue_.TryPop(baton)) {
-    /* 检测Node层是否注册了此事件的回调函数 */
-    unordered_map<int, Persistent<Function>>::iterator it =
-        that->callback_map_.find(baton->ev);
-    if (it == that->callback_map_.end()) {
-      return;
+  /* 如果异步执行时出现错误，则将Node层回调函数第一个参数置为对应错误信息
+   */
+  if (!baton->errmsg.empty()) {
+    Local<Value> argv[] = {
+        Exception::Error(String::NewFromUtf8(isolate, baton->errmsg.c_str()))};
+    MakeCallback(isolate, ctx, cb, 1, argv);
+    return;
+  }
+
+  switch (baton->ev) {
+    /* 以下事件无返回 */
+    case EV_CREATE_FTDC_MD_API: {
+      /* 线程池中赋值的api_此后对主线程可见 */
+      CtpMd *that = static_cast<CtpMd *>(baton->that);
+      that->api_ready_ = !that->exiting_ && that->async_ != NULL;
+      MakeCallback(isolate, ctx, cb, 0, NULL);
+      break;
+    }
+    case EV_RELEASE:
+    case EV_INIT:
+    case EV_JOIN:
+    case EV_REGISTER_FRONT:
+    case EV_REGISTER_NAME_SERVER:
+    case EV_REGISTER_FENS_USER_INFO:
+    case EV_REGISTER_SPI: {
+      MakeCallback(isolate, ctx, cb, 0, NULL);
+      break;
+    }
+    case EV_EXIT: {
+      /* API已释放, 关闭句柄后事件循环可以正常退出 */
+      static_cast<CtpMd *>(baton->that)->Shutdown();
+      MakeCallback(isolate, ctx, cb, 0, NULL);
+      break;
     }
-    Local<Function> cb = Local<Function>::New(isolate, it->second);
 
-    switch (baton->ev) {
-      case EV_ON_FRONT_CONNECTED: {
-        MakeCallback(isolate, ctx, cb, 0, NULL);
-        break;
+    /* 以下事件返回String */
+    case EV_GET_API_VERSION:
+    case EV_GET_TRADING_DAY: {
+      string *ret = static_cast<string *>(baton->ret.s.get());
+      Local<Value> argv[] = {Null(isolate),
+                             String::NewFromUtf8(isolate, ret->c_str())};
+      MakeCallback(isolate, ctx, cb, 2, argv);
+      break;
+    }
+
+    /* 以下事件返回Number */
+    case EV_SUBSCRIBE_MARKET_DATA:
+    case EV_UN_SUBSCRIBE_MARKET_DATA:
+    case EV_SUBSCRIBE_FOR_QUOTE_RSP:
+    case EV_UN_SUBSCRIBE_FOR_QUOTE_RSP:
+    case EV_REQ_USER_LOGIN:
+    case EV_REQ_USER_LOGOUT: {
+      Local<Value> argv[] = {Null(isolate), Number::New(isolate, baton->ret.n)};
+      MakeCallback(isolate, ctx, cb, 2, argv);
+      break;
+    }
+    default: { break; }
+  }
+
+  delete baton;
+}
+
+/**
+ * 回放线程中的事件回调
+ */
+void CtpMd::ReplayEvent(void *ctx, int ev, const char *data, uint32_t size) {
+  CtpMd *that = static_cast<CtpMd *>(ctx);
+  switch (ev) {
+    case EV_ON_RTN_DEPTH_MARKET_DATA: {
+      CThostFtdcDepthMarketDataField field;
+      if (size == sizeof(field)) {
+        memcpy(&field, data, sizeof(field));
+        that->OnRtnDepthMarketData(&field);
+      }
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+/**
+ * 回放线程结束时唤醒主线程
+ */
+void CtpMd::ReplayDone(void *ctx) {
+  CtpMd *that = static_cast<CtpMd *>(ctx);
+  uv_async_send(that->async_);
+}
+
+/**
+ * 停止回放线程
+ */
+void CtpMd::CancelReplay() {
+  if (!replayer_.Running()) {
+    return;
+  }
+
+  replayer_.RequestStop();
+  while (!replayer_.Finished()) {
+    ResponseBaton *baton = NULL;
+    while (queue_.TryPop(baton)) {
+      pool_.Release(baton);
+    }
+    std::this_thread::yield();
+  }
+  replayer_.Join();
+}
+
+/**
+ * 从其它线程向主线程中发送事件
+ */
+void CtpMd::ResponseAsyncSend(ResponseBaton *baton) {
+  /* 实例关闭后主线程不再消费队列, 直接丢弃以免阻塞在已满的队列上 */
+  if (closing_.load(std::memory_order_acquire)) {
+    pool_.ReleaseLocal(baton);
+    return;
+  }
+  ResponseBaton *dropped = NULL;
+  if (!queue_.Push(baton, dropped)) {
+    /* 队列已满, 按溢出策略被丢弃的事件在此释放 */
+    pool_.ReleaseLocal(dropped);
+  }
+  uv_async_send(async_);
+}
+
+/**
+ * SPI事件->Node层回调函数参数
+ * @return 参数个数
+ */
+int CtpMd::ResponseArgs(Isolate *isolate, ResponseBaton *baton,
+                        Local<Value> *argv) {
+  switch (baton->ev) {
+    case EV_ON_FRONT_CONNECTED: {
+      return 0;
+    }
+    case EV_ON_FRONT_DISCONNECTED: {
+      argv[0] = Number::New(isolate, *baton->Data<int>());
+      return 1;
+    }
+    case EV_ON_HEART_BEAT_WARNING: {
+      argv[0] = Number::New(isolate, *baton->Data<int>());
+      return 1;
+    }
+    case EV_ON_RSP_USER_LOGIN: {
+      CThostFtdcRspUserLoginField *data =
+          baton->Data<CThostFtdcRspUserLoginField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RSP_USER_LOGOUT: {
+      CThostFtdcUserLogoutField *data =
+          baton->Data<CThostFtdcUserLogoutField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RSP_ERROR: {
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, error);
+      argv[1] = Number::New(isolate, baton->request_id);
+      argv[2] = Boolean::New(isolate, baton->last);
+      return 3;
+    }
+    case EV_ON_RSP_SUB_MARKET_DATA: {
+      CThostFtdcSpecificInstrumentField *data =
+          baton->Data<CThostFtdcSpecificInstrumentField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RSP_UN_SUB_MARKET_DATA: {
+      CThostFtdcSpecificInstrumentField *data =
+          baton->Data<CThostFtdcSpecificInstrumentField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RSP_SUB_FOR_QUOTE_RSP: {
+      CThostFtdcSpecificInstrumentField *data =
+          baton->Data<CThostFtdcSpecificInstrumentField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RSP_UN_SUB_FOR_QUOTE_RSP: {
+      CThostFtdcSpecificInstrumentField *data =
+          baton->Data<CThostFtdcSpecificInstrumentField>();
+      CThostFtdcRspInfoField *error = baton->error;
+
+      argv[0] = NewNodeObject(isolate, data);
+      argv[1] = NewNodeObject(isolate, error);
+      argv[2] = Number::New(isolate, baton->request_id);
+      argv[3] = Boolean::New(isolate, baton->last);
+      return 4;
+    }
+    case EV_ON_RTN_DEPTH_MARKET_DATA: {
+      CThostFtdcDepthMarketDataField *data =
+          baton->Data<CThostFtdcDepthMarketDataField>();
+
+      Local<Object> obj = NewDepthMarketData(isolate, data);
+      /* 增量只对逐条推送的行情计算, 读取快照不改变基准 */
+      if (data && tick_deltas_) {
+        TickDelta delta;
+        tick_deltas_->Update(data, delta);
+        obj->Set(Local<String>::New(isolate, delta_keys_[0]),
+                 Integer::New(isolate, delta.LastVolume));
+        obj->Set(Local<String>::New(isolate, delta_keys_[1]),
+                 Number::New(isolate, delta.LastTurnover));
+        obj->Set(Local<String>::New(isolate, delta_keys_[2]),
+                 Number::New(isolate, delta.OIChange));
       }
-      case EV_ON_FRONT_DISCONNECTED: {
-        Local<Value> argv[] = {
-            Number::New(isolate, *static_cast<int *>(baton->data.get()))};
-        MakeCallback(isolate, ctx, cb, 1, argv);
+      argv[0] = obj;
+      return 1;
+    }
+    case EV_ON_RTN_FOR_QUOTE_RSP: {
+      CThostFtdcForQuoteRspField *data =
+          baton->Data<CThostFtdcForQuoteRspField>();
+
+      argv[0] = NewNodeObject(isolate, data);
+      return 1;
+    }
+    default: { return 0; }
+  }
+}
+
+/**
+ * 深度行情->Node层对象
+ */
+Local<Object> CtpMd::NewDepthMarketData(
+    Isolate *isolate, const CThostFtdcDepthMarketDataField *data) {
+  Local<Object> obj = depth_fields_.Convert(isolate, data);
+  if (data && !timestamp_key_.IsEmpty()) {
+    obj->Set(Local<String>::New(isolate, timestamp_key_),
+             Number::New(isolate, TickTimestamp(data)));
+  }
+  return obj;
+}
+
+/**
+ * 读取事件数据中的合约代码
+ */
+const char *CtpMd::ResponseInstrument(ResponseBaton *baton) {
+  if (!baton->data) {
+    return NULL;
+  }
+
+  switch (baton->ev) {
+    case EV_ON_RTN_DEPTH_MARKET_DATA:
+      return baton->Data<CThostFtdcDepthMarketDataField>()->InstrumentID;
+    case EV_ON_RTN_FOR_QUOTE_RSP:
+      return baton->Data<CThostFtdcForQuoteRspField>()->InstrumentID;
+    case EV_ON_RSP_SUB_MARKET_DATA:
+    case EV_ON_RSP_UN_SUB_MARKET_DATA:
+    case EV_ON_RSP_SUB_FOR_QUOTE_RSP:
+    case EV_ON_RSP_UN_SUB_FOR_QUOTE_RSP:
+      return baton->Data<CThostFtdcSpecificInstrumentField>()->InstrumentID;
+    default:
+      return NULL;
+  }
+}
+
+/**
+ * 主线程中SPI事件处理函数
+ */
+void CtpMd::ResponseAsyncAfter(uv_async_t *async) {
+  Isolate *isolate = Isolate::GetCurrent();
+  HandleScope scope(isolate);
+  Local<Object> ctx = isolate->GetCurrentContext()->Global();
+  CtpMd *that = static_cast<CtpMd *>(async->data);
+  ResponseBaton *baton = NULL;
+
+  if (!that->batch_callback_.IsEmpty()) {
+    that->ResponseBatch(isolate, ctx);
+  } else {
+    uint64_t deadline = uv_hrtime() + kDrainLatency * 1000;
+    for (uint32_t count = 0;; ++count) {
+      /* 超出单次唤醒的预算时让出事件循环, 剩余事件在下次唤醒时处理 */
+      if (count >= kDrainCount || (count > 0 && uv_hrtime() >= deadline)) {
+        if (that->ResponsePending()) {
+          uv_async_send(that->async_);
+        }
         break;
       }
-      case EV_ON_HEART_BEAT_WARNING: {
-        Local<Value> argv[] = {
-            Number::New(isolate, *static_cast<int *>(baton->data.get()))};
-        MakeCallback(isolate, ctx, cb, 1, argv);
+      if (!that->ResponsePop(baton)) {
         break;
       }
-      case EV_ON_RSP_USER_LOGIN: {
-        CThostFtdcRspUserLoginField *data =
-            static_cast<CThostFtdcRspUserLoginField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 交易日 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "TradingDay"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->TradingDay),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 登录成功时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "LoginTime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->LoginTime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 经纪公司代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "BrokerID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->BrokerID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 用户代码 */
-          obj_data->Set(String::NewFromUtf8(isolate, "UserID"),
-                        String::NewFromOneByte(
-                            isolate, reinterpret_cast<uint8_t *>(data->UserID),
-                            NewStringType::kNormal)
-                            .ToLocalChecked());
-          /* 交易系统名称 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "SystemName"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->SystemName),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 前置编号 */
-          obj_data->Set(String::NewFromUtf8(isolate, "FrontID"),
-                        Number::New(isolate, data->FrontID));
-          /* 会话编号 */
-          obj_data->Set(String::NewFromUtf8(isolate, "SessionID"),
-                        Number::New(isolate, data->SessionID));
-          /* 最大报单引用 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "MaxOrderRef"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->MaxOrderRef),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 上期所时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "SHFETime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->SHFETime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 大商所时间 */
-          obj_data->Set(String::NewFromUtf8(isolate, "DCETime"),
-                        String::NewFromOneByte(
-                            isolate, reinterpret_cast<uint8_t *>(data->DCETime),
-                            NewStringType::kNormal)
-                            .ToLocalChecked());
-          /* 郑商所时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "CZCETime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->CZCETime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 中金所时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "FFEXTime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->FFEXTime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 能源中心时间 */
-          obj_data->Set(String::NewFromUtf8(isolate, "INETime"),
-                        String::NewFromOneByte(
-                            isolate, reinterpret_cast<uint8_t *>(data->INETime),
-                            NewStringType::kNormal)
-                            .ToLocalChecked());
-        }
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+      /* 每个事件转换出的对象在处理完后即可回收 */
+      HandleScope event_scope(isolate);
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
+      that->SubscriptionTrack(baton);
+
+      /* 检测Node层是否注册了接收此事件的回调函数, 未注册时不转换 */
+      const char *instrument = ResponseInstrument(baton);
+      if (!that->listeners_.Wants(baton->ev, instrument)) {
+        that->pool_.Release(baton);
+        continue;
       }
-      case EV_ON_RSP_USER_LOGOUT: {
-        CThostFtdcUserLogoutField *data =
-            static_cast<CThostFtdcUserLogoutField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 经纪公司代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "BrokerID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->BrokerID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 用户代码 */
-          obj_data->Set(String::NewFromUtf8(isolate, "UserID"),
-                        String::NewFromOneByte(
-                            isolate, reinterpret_cast<uint8_t *>(data->UserID),
-                            NewStringType::kNormal)
-                            .ToLocalChecked());
-        }
+      uint64_t pop_time = uv_hrtime();
+      Local<Value> argv[kMaxResponseArgs];
+      int argc = that->ResponseArgs(isolate, baton, argv);
+      uint64_t convert_time = uv_hrtime();
+      that->listeners_.Dispatch(isolate, ctx, baton->ev, instrument, argc,
+                                argv);
+      uint64_t handler_time = uv_hrtime();
+
+      EventStats &stats = that->stats_[StatsKey(baton)];
+      stats.queue.Record(pop_time - baton->recv_time);
+      stats.convert.Record(convert_time - pop_time);
+      stats.handler.Record(handler_time - convert_time);
+      stats.total.Record(handler_time - baton->recv_time);
+
+      that->pool_.Release(baton);
+    }
+  }
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+  /* 零拷贝行情模式下每次唤醒只通知一次写游标 */
+  TickRing *ring = that->tick_ring_.load(std::memory_order_acquire);
+  if (ring) {
+    uint32_t cursor = ring->Cursor();
+    if (cursor != that->tick_ring_cursor_) {
+      that->tick_ring_cursor_ = cursor;
+      Local<Function> cb =
+          Local<Function>::New(isolate, that->tick_ring_callback_);
+      Local<Value> argv[] = {Number::New(isolate, cursor)};
+      MakeCallback(isolate, ctx, cb, 1, argv);
+    }
+  }
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
+  /* 合并推送模式下每次唤醒只通知一次发生变更的合约 */
+  SnapshotTable *snapshot = that->snapshot_.load(std::memory_order_acquire);
+  if (snapshot && snapshot->TrackChanges()) {
+    Local<Array> instrument_ids = Array::New(isolate);
+    CThostFtdcDepthMarketDataField data;
+    uint32_t index;
+    uint32_t count = 0;
+
+    while (snapshot->PopChanged(index)) {
+      if (snapshot->Get(index, data)) {
+        instrument_ids->Set(
+            count++, GetInternTable().Get(isolate, data.InstrumentID,
+                                          strlen(data.InstrumentID)));
       }
-      case EV_ON_RSP_ERROR: {
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+    }
 
-        Local<Value> argv[] = {obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 3, argv);
-        break;
-      }
-      case EV_ON_RSP_SUB_MARKET_DATA: {
-        CThostFtdcSpecificInstrumentField *data =
-            static_cast<CThostFtdcSpecificInstrumentField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+    if (count > 0) {
+      Local<Function> cb =
+          Local<Function>::New(isolate, that->snapshot_callback_);
+      Local<Value> argv[] = {instrument_ids};
+      MakeCallback(isolate, ctx, cb, 1, argv);
+    }
+  }
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+  /* K线模式下每次唤醒只推送一次完成及变更的K线 */
+  BarBuilder *bars = that->bars_.load(std::memory_order_acquire);
+  if (bars) {
+    Local<Array> array = Array::New(isolate);
+    uint32_t count = 0;
+    Bar bar;
+    while (bars->PopClosed(bar)) {
+      array->Set(count++, NewBarObject(isolate, bar, true));
+    }
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
+    Bar current[kMaxBarIntervals];
+    int n;
+    while ((n = bars->PopChanged(current)) >= 0) {
+      for (int i = 0; i < n; ++i) {
+        array->Set(count++, NewBarObject(isolate, current[i], false));
       }
-      case EV_ON_RSP_UN_SUB_MARKET_DATA: {
-        CThostFtdcSpecificInstrumentField *data =
-            static_cast<CThostFtdcSpecificInstrumentField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+    }
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+    if (count > 0) {
+      Local<Function> cb = Local<Function>::New(isolate, that->bar_callback_);
+      Local<Value> argv[] = {array};
+      MakeCallback(isolate, ctx, cb, 1, argv);
+    }
+  }
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
-      }
-      case EV_ON_RSP_SUB_FOR_QUOTE_RSP: {
-        CThostFtdcSpecificInstrumentField *data =
-            static_cast<CThostFtdcSpecificInstrumentField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+  /* 回放结束且事件全部处理后通知Node层 */
+  if (!that->replay_callback_.IsEmpty() && that->replayer_.Finished() &&
+      !that->ResponsePending()) {
+    that->replayer_.Join();
+    Local<Function> cb = Local<Function>::New(isolate, that->replay_callback_);
+    that->replay_callback_.Reset();
+    Local<Value> argv[] = {Number::New(isolate, that->replayer_.Count())};
+    MakeCallback(isolate, ctx, cb, 1, argv);
+  }
+}
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+/**
+ * 批量模式下的SPI事件处理函数
+ */
+void CtpMd::ResponseBatch(Isolate *isolate, Local<Object> ctx) {
+  uint64_t deadline = uv_hrtime() + batch_latency_ * 1000;
+  Local<Function> cb = Local<Function>::New(isolate, batch_callback_);
+  ResponseBaton *baton = NULL;
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
+  for (;;) {
+    HandleScope scope(isolate);
+    Local<Array> events = Array::New(isolate);
+    batch_recv_.clear();
+    uint32_t count = 0;
+
+    while (count < batch_size_ && ResponsePop(baton)) {
+      SubscriptionTrack(baton);
+
+      /* 与逐条模式一致, 只传递Node层注册了回调函数的事件 */
+      const char *instrument = ResponseInstrument(baton);
+      if (!listeners_.Wants(baton->ev, instrument)) {
+        pool_.Release(baton);
+        continue;
       }
-      case EV_ON_RSP_UN_SUB_FOR_QUOTE_RSP: {
-        CThostFtdcSpecificInstrumentField *data =
-            static_cast<CThostFtdcSpecificInstrumentField *>(baton->data.get());
-        CThostFtdcRspInfoField *error =
-            static_cast<CThostFtdcRspInfoField *>(baton->error.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-        Local<Object> obj_error = Object::New(isolate);
-
-        if (data) {
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
 
-        if (error) {
-          /* 错误代码 */
-          obj_error->Set(String::NewFromUtf8(isolate, "ErrorID"),
-                         Number::New(isolate, error->ErrorID));
-          /* 错误信息 */
-          obj_error->Set(
-              String::NewFromUtf8(isolate, "ErrorMsg"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(error->ErrorMsg),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+      uint64_t pop_time = uv_hrtime();
+      Local<Value> argv[kMaxResponseArgs];
+      int argc = ResponseArgs(isolate, baton, argv);
 
-        Local<Value> argv[] = {obj_data, obj_error,
-                               Number::New(isolate, baton->request_id),
-                               Boolean::New(isolate, baton->last)};
-        MakeCallback(isolate, ctx, cb, 4, argv);
-        break;
+      /* 主回调函数由批量回调代替 */
+      if (listeners_.WantsPrimary(baton->ev, instrument)) {
+        Local<Array> event = Array::New(isolate, argc + 1);
+        event->Set(0, Local<String>::New(isolate, event_names_[baton->ev]));
+        for (int i = 0; i < argc; ++i) {
+          event->Set(i + 1, argv[i]);
+        }
+        events->Set(count++, event);
+        batch_recv_.push_back(make_pair(StatsKey(baton), baton->recv_time));
       }
-      case EV_ON_RTN_DEPTH_MARKET_DATA: {
-        CThostFtdcDepthMarketDataField *data =
-            static_cast<CThostFtdcDepthMarketDataField *>(baton->data.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-
-        if (data) {
-          /* 交易日 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "TradingDay"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->TradingDay),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 交易所代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ExchangeID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ExchangeID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 合约在交易所的代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ExchangeInstID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ExchangeInstID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 最新价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "LastPrice"),
-                        Number::New(isolate, data->LastPrice));
-          /* 上次结算价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "PreSettlementPrice"),
-                        Number::New(isolate, data->PreSettlementPrice));
-          /* 昨收盘 */
-          obj_data->Set(String::NewFromUtf8(isolate, "PreClosePrice"),
-                        Number::New(isolate, data->PreClosePrice));
-          /* 昨持仓量 */
-          obj_data->Set(String::NewFromUtf8(isolate, "PreOpenInterest"),
-                        Number::New(isolate, data->PreOpenInterest));
-          /* 今开盘 */
-          obj_data->Set(String::NewFromUtf8(isolate, "OpenPrice"),
-                        Number::New(isolate, data->OpenPrice));
-          /* 最高价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "HighestPrice"),
-                        Number::New(isolate, data->HighestPrice));
-          /* 最低价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "LowestPrice"),
-                        Number::New(isolate, data->LowestPrice));
-          /* 数量 */
-          obj_data->Set(String::NewFromUtf8(isolate, "Volume"),
-                        Number::New(isolate, data->Volume));
-          /* 成交金额 */
-          obj_data->Set(String::NewFromUtf8(isolate, "Turnover"),
-                        Number::New(isolate, data->Turnover));
-          /* 持仓量 */
-          obj_data->Set(String::NewFromUtf8(isolate, "OpenInterest"),
-                        Number::New(isolate, data->OpenInterest));
-          /* 今收盘 */
-          obj_data->Set(String::NewFromUtf8(isolate, "ClosePrice"),
-                        Number::New(isolate, data->ClosePrice));
-          /* 本次结算价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "SettlementPrice"),
-                        Number::New(isolate, data->SettlementPrice));
-          /* 涨停板价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "UpperLimitPrice"),
-                        Number::New(isolate, data->UpperLimitPrice));
-          /* 跌停板价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "LowerLimitPrice"),
-                        Number::New(isolate, data->LowerLimitPrice));
-          /* 昨虚实度 */
-          obj_data->Set(String::NewFromUtf8(isolate, "PreDelta"),
-                        Number::New(isolate, data->PreDelta));
-          /* 今虚实度 */
-          obj_data->Set(String::NewFromUtf8(isolate, "CurrDelta"),
-                        Number::New(isolate, data->CurrDelta));
-          /* 最后修改时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "UpdateTime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->UpdateTime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 最后修改毫秒 */
-          obj_data->Set(String::NewFromUtf8(isolate, "UpdateMillisec"),
-                        Number::New(isolate, data->UpdateMillisec));
-          /* 申买价一 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidPrice1"),
-                        Number::New(isolate, data->BidPrice1));
-          /* 申买量一 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidVolume1"),
-                        Number::New(isolate, data->BidVolume1));
-          /* 申卖价一 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskPrice1"),
-                        Number::New(isolate, data->AskPrice1));
-          /* 申卖量一 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskVolume1"),
-                        Number::New(isolate, data->AskVolume1));
-          /* 申买价二 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidPrice2"),
-                        Number::New(isolate, data->BidPrice2));
-          /* 申买量二 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidVolume2"),
-                        Number::New(isolate, data->BidVolume2));
-          /* 申卖价二 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskPrice2"),
-                        Number::New(isolate, data->AskPrice2));
-          /* 申卖量二 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskVolume2"),
-                        Number::New(isolate, data->AskVolume2));
-          /* 申买价三 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidPrice3"),
-                        Number::New(isolate, data->BidPrice3));
-          /* 申买量三 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidVolume3"),
-                        Number::New(isolate, data->BidVolume3));
-          /* 申卖价三 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskPrice3"),
-                        Number::New(isolate, data->AskPrice3));
-          /* 申卖量三 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskVolume3"),
-                        Number::New(isolate, data->AskVolume3));
-          /* 申买价四 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidPrice4"),
-                        Number::New(isolate, data->BidPrice4));
-          /* 申买量四 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidVolume4"),
-                        Number::New(isolate, data->BidVolume4));
-          /* 申卖价四 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskPrice4"),
-                        Number::New(isolate, data->AskPrice4));
-          /* 申卖量四 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskVolume4"),
-                        Number::New(isolate, data->AskVolume4));
-          /* 申买价五 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidPrice5"),
-                        Number::New(isolate, data->BidPrice5));
-          /* 申买量五 */
-          obj_data->Set(String::NewFromUtf8(isolate, "BidVolume5"),
-                        Number::New(isolate, data->BidVolume5));
-          /* 申卖价五 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskPrice5"),
-                        Number::New(isolate, data->AskPrice5));
-          /* 申卖量五 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AskVolume5"),
-                        Number::New(isolate, data->AskVolume5));
-          /* 当日均价 */
-          obj_data->Set(String::NewFromUtf8(isolate, "AveragePrice"),
-                        Number::New(isolate, data->AveragePrice));
-          /* 业务日期 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ActionDay"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ActionDay),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
+
+      EventStats &stats = stats_[StatsKey(baton)];
+      uint64_t convert_time = uv_hrtime();
+      stats.queue.Record(pop_time - baton->recv_time);
+      stats.convert.Record(convert_time - pop_time);
+
+      /* 附加监听函数逐条调用 */
+      if (listeners_.Dispatch(isolate, ctx, baton->ev, instrument, argc, argv,
+                              false) > 0) {
+        uint64_t handler_time = uv_hrtime();
+        stats.handler.Record(handler_time - convert_time);
+        if (!listeners_.WantsPrimary(baton->ev, instrument)) {
+          stats.total.Record(handler_time - baton->recv_time);
         }
+      }
 
-        Local<Value> argv[] = {obj_data};
-        MakeCallback(isolate, ctx, cb, 1, argv);
-        break;
+      pool_.Release(baton);
+    }
+
+    if (count == 0) {
+      break;
+    }
+
+    uint64_t convert_time = uv_hrtime();
+    Local<Value> argv[] = {events};
+    MakeCallback(isolate, ctx, cb, 1, argv);
+    uint64_t handler_time = uv_hrtime();
+    stats_[kBatchStats].handler.Record(handler_time - convert_time);
+    for (size_t i = 0; i < batch_recv_.size(); ++i) {
+      stats_[batch_recv_[i].first].total.Record(handler_time -
+                                                batch_recv_[i].second);
+    }
+
+    /* 超出单次唤醒的时间预算时让出事件循环, 剩余事件在下次唤醒时处理 */
+    if (uv_hrtime() >= deadline) {
+      if (ResponsePending()) {
+        uv_async_send(async_);
       }
-      case EV_ON_RTN_FOR_QUOTE_RSP: {
-        CThostFtdcForQuoteRspField *data =
-            static_cast<CThostFtdcForQuoteRspField *>(baton->data.get());
-
-        Local<Object> obj_data = Object::New(isolate);
-
-        if (data) {
-          /* 交易日 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "TradingDay"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->TradingDay),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 合约代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "InstrumentID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->InstrumentID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 询价编号 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ForQuoteSysID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ForQuoteSysID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 询价时间 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ForQuoteTime"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ForQuoteTime),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 业务日期 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ActionDay"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ActionDay),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-          /* 交易所代码 */
-          obj_data->Set(
-              String::NewFromUtf8(isolate, "ExchangeID"),
-              String::NewFromOneByte(
-                  isolate, reinterpret_cast<uint8_t *>(data->ExchangeID),
-                  NewStringType::kNormal)
-                  .ToLocalChecked());
-        }
+      break;
+    }
+  }
+}
 
-        Local<Value> argv[] = {obj_data};
-        MakeCallback(isolate, ctx, cb, 1, argv);
-        break;
+/**
+ * 主线程中取出一个待处理的SPI事件
+ */
+bool CtpMd::ResponsePop(ResponseBaton *&baton) {
+  if (!conflation_.Enabled() && pending_.empty()) {
+    return queue_.TryPop(baton);
+  }
+
+  if (pending_.empty()) {
+    ResponseConflate();
+  }
+
+  while (!pending_.empty()) {
+    baton = pending_.front();
+    pending_.pop_front();
+    if (baton) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * 是否还有待处理的SPI事件
+ */
+bool CtpMd::ResponsePending() { return !pending_.empty() || !queue_.Empty(); }
+
+/**
+ * 按合并策略丢弃积压的深度行情
+ */
+void CtpMd::ResponseConflate() {
+  ResponseBaton *baton = NULL;
+  while (queue_.TryPop(baton)) {
+    pending_.push_back(baton);
+  }
+
+  /* 从最新的事件向前扫描, 每个合约只保留最新的depth条行情 */
+  conflation_.BeginRound();
+  for (deque<ResponseBaton *>::reverse_iterator it = pending_.rbegin();
+       it != pending_.rend(); ++it) {
+    baton = *it;
+    if (baton->ev != EV_ON_RTN_DEPTH_MARKET_DATA || !baton->data) {
+      continue;
+    }
+
+    if (conflation_.Drop(
+            baton->Data<CThostFtdcDepthMarketDataField>()->InstrumentID)) {
+      pool_.Release(baton);
+      *it = NULL;
+    }
+  }
+}
+
+/**
+ * 在主线程取出SPI事件时更新行情订阅集合
+ */
+void CtpMd::SubscriptionTrack(ResponseBaton *baton) {
+  switch (baton->ev) {
+    case EV_ON_FRONT_CONNECTED: {
+      subscriptions_.OnConnected(baton->recv_time);
+      break;
+    }
+    case EV_ON_FRONT_DISCONNECTED: {
+      uv_timer_stop(subscribe_timer_);
+      subscriptions_.OnDisconnected();
+      break;
+    }
+    case EV_ON_RSP_USER_LOGIN: {
+      /* exit之后队列中残留的登录应答不再触发订阅 */
+      if (api_ready_ && (!baton->error || baton->error->ErrorID == 0)) {
+        subscriptions_.OnLogin();
+        SubscriptionSchedule();
+      }
+      break;
+    }
+    case EV_ON_RSP_SUB_MARKET_DATA: {
+      if (baton->data) {
+        subscriptions_.OnSubscribed(
+            baton->Data<CThostFtdcSpecificInstrumentField>()->InstrumentID,
+            !baton->error || baton->error->ErrorID == 0);
       }
-      default: { break; }
+      break;
+    }
+    case EV_ON_RTN_DEPTH_MARKET_DATA: {
+      if (baton->data && !subscriptions_.Entries().empty()) {
+        subscriptions_.OnTick(
+            baton->Data<CThostFtdcDepthMarketDataField>()->InstrumentID,
+            baton->recv_time);
+      }
+      break;
     }
+    default:
+      break;
+  }
+}
 
-    delete baton;
+/**
+ * 有待发送的订阅/退订请求时启动发送定时器
+ */
+void CtpMd::SubscriptionSchedule() {
+  if (!api_ready_ || !subscriptions_.Pending() ||
+      uv_is_active(reinterpret_cast<uv_handle_t *>(subscribe_timer_))) {
+    return;
+  }
+  /* 第一块立即发送, 之后按间隔发送 */
+  uv_timer_start(subscribe_timer_, SubscriptionFlush, 0,
+                 subscribe_interval_ > 0 ? subscribe_interval_ : 1);
+}
+
+/**
+ * 定时发送一块订阅/退订请求
+ * @remark CTP的订阅接口只将请求写入发送缓冲区, 不会阻塞, 可在主线程中调用
+ */
+void CtpMd::SubscriptionFlush(uv_timer_t *timer) {
+  CtpMd *that = static_cast<CtpMd *>(timer->data);
+  vector<string> unsubscribe;
+  vector<string> subscribe;
+
+  if (!that->api_ready_ || that->subscriptions_.NextChunk(
+                         that->subscribe_chunk_, unsubscribe, subscribe) == 0) {
+    uv_timer_stop(timer);
+    return;
+  }
+
+  vector<char *> vec;
+  if (!unsubscribe.empty()) {
+    for (const auto &str : unsubscribe) {
+      vec.push_back(const_cast<char *>(str.c_str()));
+    }
+    that->api_->UnSubscribeMarketData(&vec[0], vec.size());
+  }
+  if (!subscribe.empty()) {
+    vec.clear();
+    for (const auto &str : subscribe) {
+      vec.push_back(const_cast<char *>(str.c_str()));
+    }
+    that->api_->SubscribeMarketData(&vec[0], vec.size());
+  }
+
+  if (!that->subscriptions_.Pending()) {
+    uv_timer_stop(timer);
   }
 }
 
-} /* namespace node_ctp */
\ No newline at end of file
+} /* namespace node_ctp */
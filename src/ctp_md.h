@@ -4,10 +4,26 @@
 #include <node.h>
 #include <node_object_wrap.h>
 #include <uv.h>
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include "ThostFtdcMdApi.h"
+#include "bar_builder.h"
 #include "baton.h"
+#include "baton_pool.h"
+#include "conflation_table.h"
+#include "field_projection.h"
+#include "histogram.h"
+#include "journal.h"
+#include "listener.h"
 #include "queue.h"
+#include "snapshot_table.h"
+#include "subscription.h"
+#include "tick_delta.h"
+#include "tick_ring.h"
 
 /* 此文件中代码大部分使用misc/code_generator生成, 不要手动修改 */
 
@@ -16,6 +32,32 @@ namespace node_ctp {
 using namespace v8;
 using std::string;
 using std::unordered_map;
+using std::unique_ptr;
+using std::atomic;
+using std::deque;
+using std::make_pair;
+using std::pair;
+using std::vector;
+
+/**
+ * 行情传输方式
+ */
+enum MdTransport {
+  MD_TRANSPORT_TCP,
+  MD_TRANSPORT_UDP,
+  MD_TRANSPORT_MULTICAST,
+  /* 回放SPI事件日志 */
+  MD_TRANSPORT_REPLAY
+};
+
+/**
+ * 创建MdApi的参数
+ */
+struct MdApiOptions {
+  string flow_path;
+  bool udp;
+  bool multicast;
+};
 
 class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
  public:
@@ -24,8 +66,25 @@ class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
    */
   static void InitNodeClass(Local<Object> exports);
 
+  /**
+   * 释放当前线程的Node层构造函数, 在Isolate销毁前调用
+   */
+  static void ReleaseNodeClass();
+
+  /**
+   * 成员中的事件队列按缓存行对齐, 实例需要按对齐分配
+   */
+  static void *operator new(size_t size) {
+    return AlignedAlloc(size, alignof(CtpMd));
+  }
+
+  static void operator delete(void *ptr) { AlignedFree(ptr); }
+
  private:
-  CtpMd();
+  CtpMd(Isolate *isolate, uint32_t queue_capacity,
+        OverflowPolicy queue_overflow, bool sync_request,
+        uint32_t pool_capacity, uint32_t subscribe_chunk,
+        uint32_t subscribe_interval);
   virtual ~CtpMd();
 
   /**
@@ -41,8 +100,8 @@ class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
   /**
    * 创建MdApi
    * @param pszFlowPath 存贮订阅信息文件的目录, 默认为当前目录
+   * @param options 传输方式{udp, multicast}, 可省略, 默认使用TCP
    * @return 创建出的UserApi
-   * modify for udp marketdata
    */
   static void CreateFtdcMdApi(const FunctionCallbackInfo<Value> &args);
 
@@ -258,6 +317,266 @@ class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
    */
   static void On(const FunctionCallbackInfo<Value> &args);
 
+  /**
+   * Node层添加SPI事件监听函数
+   * @param event 事件名
+   * @param callback 监听函数, 参数与on注册的回调函数相同
+   * @param instrumentIds 可选, 合约代码数组, 只接收这些合约的事件
+   * @return 监听函数ID
+   * @remark 同一事件的全部监听函数共享一次转换出的Node层对象. 合约过滤在
+   * 转换之前进行, 只作用于带有合约代码的事件. 批量模式下附加监听函数仍逐条调用
+   * Example:
+   *   ```
+   *   let id = md.addListener('RtnDepthMarketData', cb, ['rb1901'])
+   *   md.removeListener(id)
+   *   ```
+   */
+  static void AddListener(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * Node层移除SPI事件监听函数
+   * @param id addListener返回的监听函数ID
+   * @return 监听函数不存在时返回false
+   */
+  static void RemoveListener(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启零拷贝行情模式
+   * @param capacity 环形缓冲区可容纳的行情记录条数, 向上取整为2的幂
+   * @param callback 行情到达时的回调函数, 参数为写游标
+   * @return 环形缓冲区对应的ArrayBuffer
+   * @remark 开启后深度行情不再构造Node层对象,
+   * SPI线程直接将定长记录写入环形缓冲区, 每次唤醒主线程时只通知写游标
+   * Example:
+   *   ```
+   *   let buffer = md.enableTickRing(65536, (cursor) => {...})
+   *   ```
+   */
+  static void EnableTickRing(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启最新行情快照表
+   * @param capacity 可容纳的合约数
+   * @param callback 可选, 指定时开启合并推送模式, 参数为发生变更的合约代码数组
+   * @remark 开启后SPI线程将深度行情写入C++层快照表, 可通过getSnapshot读取.
+   * 合并推送模式下深度行情不再逐条推送, 每次唤醒主线程时只通知上次通知后
+   * 发生变更的合约
+   * Example:
+   *   ```
+   *   md.enableSnapshot(4096, (instrumentIds) => {...})
+   *   ```
+   */
+  static void EnableSnapshot(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启K线聚合
+   * @param intervals 默认周期(秒)数组, 为0时表示整个交易日, 最多4个
+   * @param options {capacity, updates, ticks}, capacity为可容纳的合约数,
+   * updates为是否同时推送正在聚合的K线, ticks为是否继续逐条推送深度行情
+   * @param callback K线回调函数, 参数为K线数组
+   * @remark 开启后SPI线程直接将深度行情聚合为K线, 每次唤醒主线程时只推送
+   * 完成的K线(Closed为true)及发生变更的正在聚合的K线. ticks为false时深度行情
+   * 不再逐条推送
+   * Example:
+   *   ```
+   *   md.enableBars([60], {capacity: 4096}, (bars) => {...})
+   *   ```
+   */
+  static void EnableBars(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 设置K线周期
+   * @param intervals 周期(秒)数组, 为0时表示整个交易日, 最多4个
+   * @param instrumentIds 可选, 合约代码数组, 省略时设置默认周期
+   */
+  static void SetBarIntervals(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取合约的最新行情快照
+   * @param instrumentId 合约代码
+   * @return 深度行情对象, 合约不存在时返回undefined
+   */
+  static void GetSnapshot(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 批量读取最新行情快照
+   * @param instrumentIds 可选, 合约代码数组, 省略时返回全部合约
+   * @return 深度行情对象数组, 合约不存在时对应位置为undefined
+   */
+  static void GetSnapshots(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启批量事件模式
+   * @param maxBatch 单次回调传递的最大事件数
+   * @param maxLatency 单次唤醒中处理事件的时间预算(微秒),
+   * 超出后让出事件循环, 剩余事件在下次唤醒时处理. 为0时每次唤醒只回调一次
+   * @param callback 批量回调函数, 参数为事件数组, 每个事件为[事件名, ...参数]
+   * @remark 开启后不再逐条调用on注册的回调函数, 但仍只传递已注册回调的事件.
+   * 每批事件只调用一次MakeCallback, 减少行情密集时microtask及nextTick的开销
+   * Example:
+   *   ```
+   *   md.enableBatch(256, 1000, (events) => {...})
+   *   ```
+   */
+  static void EnableBatch(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启深度行情按合约路由
+   * @param enabled 可选, 为false时关闭, 默认开启
+   * @remark 开启后深度行情只传递给通过addListener指定了该合约的监听函数,
+   * 不再传递给on注册的回调函数及未指定合约的监听函数. 主线程按合约代码在散列表
+   * 中查找监听函数, 没有监听函数的合约行情在转换为Node层对象之前即被丢弃
+   * Example:
+   *   ```
+   *   md.enableRouting()
+   *   md.addListener('RtnDepthMarketData', (data) => {...}, ['rb1901'])
+   *   ```
+   */
+  static void EnableRouting(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 设置行情订阅集合
+   * @param instrumentIds 合约代码数组
+   * @return {added, removed}, 新加入及移出集合的合约个数
+   * @remark 与当前集合比较, 只订阅新加入的合约并退订移出的合约. 请求按
+   * subscribeChunk分块, 每subscribeInterval毫秒发送一块. 断线重连并登录成功
+   * 后自动重新订阅整个集合, Node层无需处理. 与subscribeMarketData互相独立
+   * Example:
+   *   ```
+   *   md.setSubscriptions(['rb1901', 'cu1901'])
+   *   ```
+   */
+  static void SetSubscriptions(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 加入行情订阅集合
+   * @param instrumentIds 合约代码数组
+   * @return 新加入集合的合约个数, 已在集合中的合约不重复订阅
+   */
+  static void AddSubscriptions(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 移出行情订阅集合
+   * @param instrumentIds 合约代码数组
+   * @return 移出集合的合约个数
+   */
+  static void RemoveSubscriptions(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取行情订阅集合状态
+   * @param options 可选, {reset: true}时读取后清空首条行情延迟统计
+   * @return {loggedIn, pending, latency, instruments}
+   * @remark pending为是否还有待发送的请求. instruments为
+   * {合约代码: {state, latency}}, state为pending/sent/active/failed,
+   * latency为本次连接建立(或加入集合)到收到首条行情的时间(纳秒), 尚未收到时
+   * 为null. latency为全部合约首条行情延迟的直方图
+   */
+  static void GetSubscriptions(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 设置深度行情合并策略
+   * @param depth 每个合约在一次唤醒中最多保留的行情条数, 为0时不合并
+   * @param instrumentIds 可选, 合约代码数组, 省略时设置默认策略
+   * @remark 主线程处理不及时导致事件积压时, 同一合约较早的行情在转换为
+   * Node层对象之前被丢弃, 只保留最新的depth条. 其它事件不受影响
+   * Example:
+   *   ```
+   *   md.setConflation(1)
+   *   md.setConflation(5, ['rb1901'])
+   *   ```
+   */
+  static void SetConflation(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取各合约被合并丢弃的行情条数
+   * @return {instrumentId: count}
+   */
+  static void GetConflationStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 设置事件转换的字段投影
+   * @param event 事件名, 目前只支持RtnDepthMarketData
+   * @param fields 字段名数组, 省略或为空数组时转换全部字段
+   * @remark 只转换选中的字段, 减少高频事件创建对象的开销. 同时作用于
+   * 行情快照的读取
+   * Example:
+   *   ```
+   *   md.setFields('RtnDepthMarketData', ['InstrumentID', 'LastPrice'])
+   *   ```
+   */
+  static void SetFields(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件延迟统计
+   * @param options 可选, {reset: true}时读取后清空统计
+   * @return {事件名: {queue, convert, handler, total}}, 每项为
+   * {count, min, max, mean, p50, p90, p99, p999}, 单位纳秒
+   * @remark queue为SPI线程收到事件到主线程取出的时间, convert为转换Node层
+   * 对象的时间, handler为Node层回调函数执行时间, total为SPI线程收到事件到
+   * 回调函数执行完毕的时间. 批量模式下回调按批统计, 记录在Batch中, 事件的
+   * total截至所在批次的批量回调返回
+   */
+  static void GetStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件队列统计计数
+   * @return {capacity, size, pushed, popped, dropped, blocked, highWater}
+   * @remark dropped为溢出策略丢弃的事件数, blocked为SPI线程因队列满而等待的次数
+   */
+  static void GetQueueStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI响应Baton对象池统计计数
+   * @return [{size, allocated, inUse, highWater, hits, misses}], 每个尺寸等级一项
+   * @remark misses为池中无空闲Baton而分配内存的次数, 稳态下应不再增长
+   */
+  static void GetPoolStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开始记录SPI事件二进制日志
+   * @param path 段文件路径前缀, 段文件名为<path>.<段序号>.jnl
+   * @param segmentSize 可选, 段文件长度(字节), 默认64MB
+   * @remark 记录深度行情的原始CTP结构体及SPI线程收到事件的时间,
+   * 由SPI线程写入内存映射的段文件, 不占用主线程. 与是否注册回调函数无关
+   */
+  static void StartJournal(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 停止记录SPI事件二进制日志
+   */
+  static void StopJournal(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件二进制日志统计计数
+   * @return {segments, records, bytes, errors}
+   * @remark errors为创建段文件失败的次数, 失败后停止记录
+   */
+  static void GetJournalStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 回放SPI事件二进制日志
+   * @param path 段文件路径前缀, 与startJournal相同
+   * @param speed 回放倍速, 1为按记录的事件间隔, 为0时尽快回放
+   * @param callback 回放结束且事件全部处理后调用, 参数为回放的事件数
+   * @remark 由独立的回放线程代替SPI线程调用深度行情的SPI回调函数, 之后的
+   * 处理与实盘完全相同. 回放期间不能连接前置机, 因此createFtdcMdApi之后不可回放
+   */
+  static void Replay(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 停止回放, 队列中尚未处理的事件被丢弃
+   */
+  static void StopReplay(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 提交API请求
+   * @remark 同步请求模式下在主线程中直接调用CTP接口, 立即返回CTP的返回值,
+   * 并保证请求按调用顺序提交, 不再调用回调函数; 否则交由libuv线程池异步执行,
+   * 完成后以回调函数通知
+   */
+  static void RequestSubmit(const FunctionCallbackInfo<Value> &args,
+                            RequestBaton *baton);
+
   /**
    * libuv异步执行时调用
    * @remark
@@ -272,30 +591,133 @@ class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
    */
   static void RequestAsyncAfter(uv_work_t *work, int status);
 
+  /**
+   * 回放线程中的事件回调, 调用对应的SPI回调函数
+   */
+  static void ReplayEvent(void *ctx, int ev, const char *data, uint32_t size);
+
+  /**
+   * 回放线程结束时唤醒主线程
+   */
+  static void ReplayDone(void *ctx);
+
+  /**
+   * 停止回放线程, 等待期间丢弃队列中的事件, 避免回放线程阻塞在已满的队列上
+   */
+  void CancelReplay();
+
+  /**
+   * 释放API, 停止回放并关闭libuv句柄, 此后实例不再产生事件. 可重复调用
+   */
+  void Shutdown();
+
+  /**
+   * Node环境(主线程或worker线程)退出时调用, 关闭实例
+   */
+  static void EnvironmentCleanup(void *arg);
+
   /**
    * 从其它线程向主线程中发送事件
    */
   void ResponseAsyncSend(ResponseBaton *baton);
 
+  /**
+   * SPI事件->Node层回调函数参数
+   * @param argv 参数数组, 长度至少为kMaxResponseArgs
+   * @return 参数个数
+   */
+  int ResponseArgs(Isolate *isolate, ResponseBaton *baton, Local<Value> *argv);
+
+  /**
+   * 深度行情->Node层对象, 开启timestamp选项时附加Timestamp字段
+   */
+  Local<Object> NewDepthMarketData(Isolate *isolate,
+                                   const CThostFtdcDepthMarketDataField *data);
+
+  /**
+   * 读取事件数据中的合约代码, 用于按合约过滤监听函数
+   * @return 不带合约代码的事件返回NULL
+   */
+  static const char *ResponseInstrument(ResponseBaton *baton);
+
   /**
    * 主线程中SPI事件处理函数
    */
   static void ResponseAsyncAfter(uv_async_t *async);
 
+  /**
+   * 批量模式下的SPI事件处理函数
+   */
+  void ResponseBatch(Isolate *isolate, Local<Object> ctx);
+
+  /**
+   * 主线程中取出一个待处理的SPI事件, 开启合并策略时先对积压的行情进行合并
+   */
+  bool ResponsePop(ResponseBaton *&baton);
+
+  /**
+   * 是否还有待处理的SPI事件
+   */
+  bool ResponsePending();
+
+  /**
+   * 按合并策略丢弃积压的深度行情
+   */
+  void ResponseConflate();
+
+  /**
+   * 在主线程取出SPI事件时更新行情订阅集合的连接状态及首条行情延迟
+   */
+  void SubscriptionTrack(ResponseBaton *baton);
+
+  /**
+   * 有待发送的订阅/退订请求时启动发送定时器
+   */
+  void SubscriptionSchedule();
+
+  /**
+   * 定时发送一块订阅/退订请求
+   */
+  static void SubscriptionFlush(uv_timer_t *timer);
+
  private:
   /* Ctp API实例 */
   CThostFtdcMdApi *api_;
 
-  /* Node层构造函数持久对象 */
-  static Persistent<Function> constructor_;
+  /* 创建实例的Node环境(主线程或worker线程)的Isolate及事件循环 */
+  Isolate *isolate_;
+  uv_loop_t *loop_;
+
+  /* 实例已关闭, SPI线程及回放线程之后产生的事件直接丢弃 */
+  atomic<bool> closing_;
+
+  /* 是否在主线程中同步提交Req*请求 */
+  bool sync_request_;
+
+  /* 是否已请求创建API, 在主线程中调用create时同步置位, 此后不能回放.
+   * api_在线程池中赋值, 主线程不能以api_判断 */
+  bool api_created_;
+
+  /* API已创建完成且尚未exit, 仅在主线程中读写. 订阅集合据此判断能否
+   * 调用api_, 在创建请求完成时置位, 在exit请求提交前清除 */
+  bool api_ready_;
+
+  /* 已调用exit, 仅在主线程中读写 */
+  bool exiting_;
+
+  /* 行情传输方式, 用于标记行情延迟统计 */
+  MdTransport transport_;
+
+  /* Node层构造函数持久对象, 每个线程(Isolate)一份 */
+  static thread_local Persistent<Function> constructor_;
 
   /* Node层注册SPI事件回调函数时使用字符串标识事件,
    * 此Map保存字符串->响应事件类型的映射
    */
   static unordered_map<string, int> event_map_;
 
-  /* SPI响应事件类型->Node层注册的回调函数 */
-  unordered_map<int, Persistent<Function>> callback_map_;
+  /* SPI响应事件类型->Node层注册的回调函数及附加监听函数 */
+  ListenerTable listeners_;
 
   /* CTP的SPI是在一个独立线程中运行的, libuv的大部分接口都不是线程安全的,
    * 想要与主线程通信
@@ -303,9 +725,92 @@ class CtpMd : public node::ObjectWrap, public CThostFtdcMdSpi {
    * 某些时候(比如短时间内频繁调用此
    * 接口)会出现调用次数与回调触发次数不一致的情况,
    * 所以需要维护一个并发队列来缓存事件.
+   * SPI线程是唯一的生产者, 主线程是唯一的消费者, 因此使用有界无锁队列,
+   * 容量及队列满时的处理策略由Node层构造函数参数指定.
+   * 句柄单独分配, 在关闭回调中释放, 实例析构后libuv仍可安全访问.
    */
-  uv_async_t async_;
-  ConcurrentQueue<ResponseBaton *> queue_;
+  uv_async_t *async_;
+  SpscQueue<ResponseBaton *> queue_;
+
+  /* SPI响应Baton对象池, 事件数据内联存放, 避免每个事件的堆分配 */
+  ResponseBatonPool pool_;
+
+  /* SPI事件二进制日志, 由SPI线程写入 */
+  JournalWriter journal_;
+
+  /* SPI事件日志回放线程, 回放结束时调用的Node层回调函数 */
+  JournalReplayer replayer_;
+  Persistent<Function> replay_callback_;
+
+  /* 行情订阅集合, 仅在主线程中访问 */
+  SubscriptionSet subscriptions_;
+
+  /* 订阅/退订请求发送定时器, 每块合约个数及发送间隔(毫秒) */
+  uv_timer_t *subscribe_timer_;
+  uint32_t subscribe_chunk_;
+  uint32_t subscribe_interval_;
+
+  /* 深度行情合并策略及各合约被合并丢弃的行情条数 */
+  ConflationTable conflation_;
+
+  /* 已从队列中取出尚未处理的事件, 仅在开启合并策略时使用 */
+  deque<ResponseBaton *> pending_;
+
+  /* 响应事件类型->延迟统计, 仅在主线程中访问 */
+  unordered_map<int, EventStats> stats_;
+
+  /* 批量事件模式回调函数, 未开启时为空 */
+  Persistent<Function> batch_callback_;
+  uint32_t batch_size_;
+  uint32_t batch_latency_;
+
+  /* 当前批次中由批量回调处理的事件: 延迟统计键->SPI线程收到事件的时间 */
+  vector<pair<int, uint64_t>> batch_recv_;
+
+  /* 批量事件模式下的响应事件类型->Node层事件名 */
+  unordered_map<int, Persistent<String>> event_names_;
+
+  /* 深度行情时间戳字段名, 未开启timestamp选项时为空 */
+  Persistent<String> timestamp_key_;
+
+  /* 逐笔推送的深度行情的增量计算表, 未开启deltas选项时为NULL.
+   * 仅在主线程中访问, 零拷贝行情模式下由环形缓冲区另行维护 */
+  unique_ptr<TickDeltaTable> tick_deltas_;
+  uint32_t delta_capacity_;
+
+  /* 增量字段名: LastVolume, LastTurnover, OIChange */
+  Persistent<String> delta_keys_[3];
+
+  /* 深度行情的字段投影, 仅在主线程中访问 */
+  FieldProjection depth_fields_;
+
+  /* 深度行情中值为DBL_MAX的价格字段的处理方式 */
+  InvalidDoubleMode invalid_price_;
+
+  /* 零拷贝行情环形缓冲区, 未开启时为NULL. SPI线程中读取, 因此使用原子变量 */
+  atomic<TickRing *> tick_ring_;
+  unique_ptr<TickRing> tick_ring_holder_;
+
+  /* 环形缓冲区内存由Node层ArrayBuffer持有, 此处保存引用防止被GC回收 */
+  Persistent<ArrayBuffer> tick_ring_buffer_;
+
+  /* 零拷贝行情回调函数及上次通知Node层时的写游标 */
+  Persistent<Function> tick_ring_callback_;
+  uint32_t tick_ring_cursor_;
+
+  /* 最新行情快照表, 未开启时为NULL. SPI线程中读取, 因此使用原子变量 */
+  atomic<SnapshotTable *> snapshot_;
+  unique_ptr<SnapshotTable> snapshot_holder_;
+
+  /* 合并推送模式回调函数 */
+  Persistent<Function> snapshot_callback_;
+
+  /* K线聚合引擎, 未开启时为NULL. SPI线程中读取, 因此使用原子变量 */
+  atomic<BarBuilder *> bars_;
+  unique_ptr<BarBuilder> bars_holder_;
+
+  /* K线回调函数 */
+  Persistent<Function> bar_callback_;
 };
 
 } /* namespace node_ctp */
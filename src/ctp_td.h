@@ -5,8 +5,15 @@
 #include <node_object_wrap.h>
 #include <uv.h>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include "ThostFtdcTraderApi.h"
 #include "baton.h"
+#include "baton_pool.h"
+#include "field_projection.h"
+#include "histogram.h"
+#include "journal.h"
+#include "listener.h"
 #include "queue.h"
 
 /* 此文件中代码大部分使用misc/code_generator生成, 不要手动修改 */
@@ -16,6 +23,9 @@ namespace node_ctp {
 using namespace v8;
 using std::string;
 using std::unordered_map;
+using std::make_pair;
+using std::pair;
+using std::vector;
 
 class CtpTd : public node::ObjectWrap, public CThostFtdcTraderSpi {
  public:
@@ -24,8 +34,24 @@ class CtpTd : public node::ObjectWrap, public CThostFtdcTraderSpi {
    */
   static void InitNodeClass(Local<Object> exports);
 
+  /**
+   * 释放当前线程的Node层构造函数, 在Isolate销毁前调用
+   */
+  static void ReleaseNodeClass();
+
+  /**
+   * 成员中的事件队列按缓存行对齐, 实例需要按对齐分配
+   */
+  static void *operator new(size_t size) {
+    return AlignedAlloc(size, alignof(CtpTd));
+  }
+
+  static void operator delete(void *ptr) { AlignedFree(ptr); }
+
  private:
-  CtpTd();
+  CtpTd(Isolate *isolate, uint32_t queue_capacity,
+        OverflowPolicy queue_overflow, bool sync_request,
+        uint32_t pool_capacity);
   virtual ~CtpTd();
 
   /**
@@ -1334,6 +1360,127 @@ class CtpTd : public node::ObjectWrap, public CThostFtdcTraderSpi {
    */
   static void On(const FunctionCallbackInfo<Value> &args);
 
+  /**
+   * Node层添加SPI事件监听函数
+   * @param event 事件名
+   * @param callback 监听函数, 参数与on注册的回调函数相同
+   * @param instrumentIds 可选, 合约代码数组, 只接收这些合约的事件
+   * @return 监听函数ID
+   * @remark 同一事件的全部监听函数共享一次转换出的Node层对象. 合约过滤在
+   * 转换之前进行, 只作用于带有合约代码的事件. 批量模式下附加监听函数仍逐条调用
+   * Example:
+   *   ```
+   *   let id = td.addListener('RtnTrade', cb, ['rb1901'])
+   *   td.removeListener(id)
+   *   ```
+   */
+  static void AddListener(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * Node层移除SPI事件监听函数
+   * @param id addListener返回的监听函数ID
+   * @return 监听函数不存在时返回false
+   */
+  static void RemoveListener(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开启批量事件模式
+   * @param maxBatch 单次回调传递的最大事件数
+   * @param maxLatency 单次唤醒中处理事件的时间预算(微秒),
+   * 超出后让出事件循环, 剩余事件在下次唤醒时处理. 为0时每次唤醒只回调一次
+   * @param callback 批量回调函数, 参数为事件数组, 每个事件为[事件名, ...参数]
+   * @remark 开启后不再逐条调用on注册的回调函数, 但仍只传递已注册回调的事件.
+   * 每批事件只调用一次MakeCallback, 减少行情密集时microtask及nextTick的开销
+   * Example:
+   *   ```
+   *   td.enableBatch(256, 1000, (events) => {...})
+   *   ```
+   */
+  static void EnableBatch(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件延迟统计
+   * @param options 可选, {reset: true}时读取后清空统计
+   * @return {事件名: {queue, convert, handler, total}}, 每项为
+   * {count, min, max, mean, p50, p90, p99, p999}, 单位纳秒
+   * @remark queue为SPI线程收到事件到主线程取出的时间, convert为转换Node层
+   * 对象的时间, handler为Node层回调函数执行时间, total为SPI线程收到事件到
+   * 回调函数执行完毕的时间. 批量模式下回调按批统计, 记录在Batch中, 事件的
+   * total截至所在批次的批量回调返回
+   */
+  static void GetStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件队列统计计数
+   * @return {capacity, size, pushed, popped, dropped, blocked, highWater}
+   * @remark dropped为溢出策略丢弃的事件数, blocked为SPI线程因队列满而等待的次数
+   */
+  static void GetQueueStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI响应Baton对象池统计计数
+   * @return [{size, allocated, inUse, highWater, hits, misses}], 每个尺寸等级一项
+   * @remark misses为池中无空闲Baton而分配内存的次数, 稳态下应不再增长
+   */
+  static void GetPoolStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 开始记录SPI事件二进制日志
+   * @param path 段文件路径前缀, 段文件名为<path>.<段序号>.jnl
+   * @param segmentSize 可选, 段文件长度(字节), 默认64MB
+   * @remark 记录报单与成交回报的原始CTP结构体及SPI线程收到事件的时间,
+   * 由SPI线程写入内存映射的段文件, 不占用主线程. 与是否注册回调函数无关
+   */
+  static void StartJournal(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 停止记录SPI事件二进制日志
+   */
+  static void StopJournal(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 读取SPI事件二进制日志统计计数
+   * @return {segments, records, bytes, errors}
+   * @remark errors为创建段文件失败的次数, 失败后停止记录
+   */
+  static void GetJournalStats(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 回放SPI事件二进制日志
+   * @param path 段文件路径前缀, 与startJournal相同
+   * @param speed 回放倍速, 1为按记录的事件间隔, 为0时尽快回放
+   * @param callback 回放结束且事件全部处理后调用, 参数为回放的事件数
+   * @remark 由独立的回放线程代替SPI线程调用报单与成交回报的SPI回调函数, 之后的
+   * 处理与实盘完全相同. 回放期间不能连接前置机, 因此createFtdcTraderApi之后不可回放
+   */
+  static void Replay(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 停止回放, 队列中尚未处理的事件被丢弃
+   */
+  static void StopReplay(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 设置事件转换的字段投影
+   * @param event 事件名, 目前支持RtnOrder和RtnTrade
+   * @param fields 字段名数组, 省略或为空数组时转换全部字段
+   * @remark 只转换选中的字段, 减少高频事件创建对象的开销
+   * Example:
+   *   ```
+   *   td.setFields('RtnTrade', ['OrderRef', 'Price', 'Volume'])
+   *   ```
+   */
+  static void SetFields(const FunctionCallbackInfo<Value> &args);
+
+  /**
+   * 提交API请求
+   * @remark 同步请求模式下在主线程中直接调用CTP接口, 立即返回CTP的返回值,
+   * 并保证请求按调用顺序提交, 不再调用回调函数; 否则交由libuv线程池异步执行,
+   * 完成后以回调函数通知
+   */
+  static void RequestSubmit(const FunctionCallbackInfo<Value> &args,
+                            RequestBaton *baton);
+
   /**
    * libuv异步执行时调用
    * @remark
@@ -1348,30 +1495,87 @@ class CtpTd : public node::ObjectWrap, public CThostFtdcTraderSpi {
    */
   static void RequestAsyncAfter(uv_work_t *work, int status);
 
+  /**
+   * 回放线程中的事件回调, 调用对应的SPI回调函数
+   */
+  static void ReplayEvent(void *ctx, int ev, const char *data, uint32_t size);
+
+  /**
+   * 回放线程结束时唤醒主线程
+   */
+  static void ReplayDone(void *ctx);
+
+  /**
+   * 停止回放线程, 等待期间丢弃队列中的事件, 避免回放线程阻塞在已满的队列上
+   */
+  void CancelReplay();
+
+  /**
+   * 释放API, 停止回放并关闭libuv句柄, 此后实例不再产生事件. 可重复调用
+   */
+  void Shutdown();
+
+  /**
+   * Node环境(主线程或worker线程)退出时调用, 关闭实例
+   */
+  static void EnvironmentCleanup(void *arg);
+
   /**
    * 从其它线程向主线程中发送事件
    */
   void ResponseAsyncSend(ResponseBaton *baton);
 
+  /**
+   * SPI事件->Node层回调函数参数
+   * @param argv 参数数组, 长度至少为kMaxResponseArgs
+   * @return 参数个数
+   */
+  int ResponseArgs(Isolate *isolate, ResponseBaton *baton, Local<Value> *argv);
+
+  /**
+   * 读取事件数据中的合约代码, 用于按合约过滤监听函数
+   * @return 不带合约代码的事件返回NULL
+   */
+  static const char *ResponseInstrument(ResponseBaton *baton);
+
   /**
    * 主线程中SPI事件处理函数
    */
   static void ResponseAsyncAfter(uv_async_t *async);
 
+  /**
+   * 批量模式下的SPI事件处理函数
+   */
+  void ResponseBatch(Isolate *isolate, Local<Object> ctx);
+
  private:
   /* Ctp API实例 */
   CThostFtdcTraderApi *api_;
 
-  /* Node层构造函数持久对象 */
-  static Persistent<Function> constructor_;
+  /* 创建实例的Node环境(主线程或worker线程)的Isolate及事件循环 */
+  Isolate *isolate_;
+  uv_loop_t *loop_;
+
+  /* 实例已关闭, SPI线程及回放线程之后产生的事件直接丢弃 */
+  atomic<bool> closing_;
+
+  /* 是否在主线程中同步提交Req*请求 */
+  bool sync_request_;
+
+  /* 是否已请求创建API, 在主线程中调用create时同步置位, 此后不能回放.
+   * api_在线程池中赋值, 主线程不能以api_判断 */
+  bool api_created_;
+
+  /* Node层构造函数持久对象, 每个线程(Isolate)一份 */
+  static thread_local Persistent<Function> constructor_;
 
   /* Node层注册SPI事件回调函数时使用字符串标识事件,
    * 此Map保存字符串->响应事件类型的映射
    */
   static unordered_map<string, int> event_map_;
 
-  /* SPI响应事件类型->Node层注册的回调函数 */
-  unordered_map<int, Persistent<Function>> callback_map_;
+  /* SPI响应事件类型->Node层注册的回调函数及附加监听函数 */
+  ListenerTable listeners_;
 
   /* CTP的SPI是在一个独立线程中运行的, libuv的大部分接口都不是线程安全的,
    * 想要与主线程通信
@@ -1379,9 +1583,40 @@ class CtpTd : public node::ObjectWrap, public CThostFtdcTraderSpi {
    * 某些时候(比如短时间内频繁调用此
    * 接口)会出现调用次数与回调触发次数不一致的情况,
    * 所以需要维护一个并发队列来缓存事件.
+   * SPI线程是唯一的生产者, 主线程是唯一的消费者, 因此使用有界无锁队列,
+   * 容量及队列满时的处理策略由Node层构造函数参数指定.
+   * 句柄单独分配, 在关闭回调中释放, 实例析构后libuv仍可安全访问.
    */
-  uv_async_t async_;
-  ConcurrentQueue<ResponseBaton *> queue_;
+  uv_async_t *async_;
+  SpscQueue<ResponseBaton *> queue_;
+
+  /* SPI响应Baton对象池, 事件数据内联存放, 避免每个事件的堆分配 */
+  ResponseBatonPool pool_;
+
+  /* SPI事件二进制日志, 由SPI线程写入 */
+  JournalWriter journal_;
+
+  /* SPI事件日志回放线程, 回放结束时调用的Node层回调函数 */
+  JournalReplayer replayer_;
+  Persistent<Function> replay_callback_;
+
+  /* 响应事件类型->延迟统计, 仅在主线程中访问 */
+  unordered_map<int, EventStats> stats_;
+
+  /* 批量事件模式回调函数, 未开启时为空 */
+  Persistent<Function> batch_callback_;
+  uint32_t batch_size_;
+  uint32_t batch_latency_;
+
+  /* 当前批次中由批量回调处理的事件: 延迟统计键->SPI线程收到事件的时间 */
+  vector<pair<int, uint64_t>> batch_recv_;
+
+  /* 批量事件模式下的响应事件类型->Node层事件名 */
+  unordered_map<int, Persistent<String>> event_names_;
+
+  /* 报单与成交回报的字段投影, 仅在主线程中访问 */
+  FieldProjection order_fields_;
+  FieldProjection trade_fields_;
 };
 
 } /* namespace node_ctp */
@@ -0,0 +1,106 @@
+#ifndef FIELD_PROJECTION_H
+#define FIELD_PROJECTION_H
+
+#include <node.h>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "struct_convert.h"
+
+/**
+ * 此文件中定义CTP结构体->Node层对象的字段投影
+ */
+
+namespace node_ctp {
+
+using namespace v8;
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+/**
+ * 解析无效价格的处理方式
+ * @param name keep/nan/skip
+ */
+inline bool ParseInvalidDoubleMode(const string &name, InvalidDoubleMode &out) {
+  if (name == "keep") {
+    out = INVALID_DOUBLE_KEEP;
+  } else if (name == "nan") {
+    out = INVALID_DOUBLE_NAN;
+  } else if (name == "skip") {
+    out = INVALID_DOUBLE_SKIP;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/**
+ * 字段投影, 只转换Node层注册的字段
+ * @remark 选中的字段按结构体中的声明顺序排列, 转换出的对象共享相同的隐藏类.
+ * 仅可在主线程中使用
+ */
+class FieldProjection {
+ public:
+  FieldProjection() : invalid_(INVALID_DOUBLE_KEEP) {}
+
+  /**
+   * 按字段名编译投影
+   * @param names 字段名数组, 为空数组时清除投影
+   * @param table 结构体的全部字段描述
+   * @param unknown 输出第一个未知的字段名
+   * @return 存在未知字段名时返回false, 原有投影保持不变
+   */
+  bool Compile(Local<Array> names, const FieldTable &table, string &unknown) {
+    unordered_set<string> wanted;
+    for (uint32_t i = 0; i < names->Length(); ++i) {
+      String::Utf8Value name(names->Get(i));
+      wanted.insert(string(*name, name.length()));
+    }
+
+    vector<FieldInfo> fields;
+    for (size_t i = 0; i < table.count; ++i) {
+      if (wanted.erase(GetObjectKeyName(table.fields[i].key))) {
+        fields.push_back(table.fields[i]);
+      }
+    }
+    if (!wanted.empty()) {
+      unknown = *wanted.begin();
+      return false;
+    }
+
+    fields_.swap(fields);
+    return true;
+  }
+
+  bool Empty() const { return fields_.empty(); }
+
+  /**
+   * 设置值为DBL_MAX的浮点字段的处理方式
+   */
+  void SetInvalidDouble(InvalidDoubleMode invalid) { invalid_ = invalid; }
+
+  /**
+   * 按投影转换, 投影为空时转换全部字段
+   */
+  template <typename T>
+  Local<Object> Convert(Isolate *isolate, const T *data) const {
+    if (!fields_.empty()) {
+      return NewNodeObject(isolate, data, fields_.data(), fields_.size(),
+                           invalid_);
+    }
+    if (invalid_ != INVALID_DOUBLE_KEEP) {
+      FieldTable table = GetFieldTable(data);
+      return NewNodeObject(isolate, data, table.fields, table.count, invalid_);
+    }
+    return NewNodeObject(isolate, data);
+  }
+
+ private:
+  vector<FieldInfo> fields_;
+  InvalidDoubleMode invalid_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* FIELD_PROJECTION_H */
@@ -0,0 +1,70 @@
+#ifndef GBK_H
+#define GBK_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * 此文件中定义GBK->UTF-16解码函数, CTP结构体中的字符串均为GBK编码
+ */
+
+namespace node_ctp {
+
+/* 双字节编码的首字节与尾字节范围 */
+const uint8_t kGbkLeadMin = 0x81;
+const uint8_t kGbkLeadMax = 0xFE;
+const uint8_t kGbkTrailMin = 0x40;
+const uint8_t kGbkTrailMax = 0xFE;
+const size_t kGbkTrailCount = kGbkTrailMax - kGbkTrailMin + 1;
+const size_t kGbkTableSize =
+    (kGbkLeadMax - kGbkLeadMin + 1) * kGbkTrailCount;
+
+/**
+ * 双字节编码->UTF-16码表, 按(首字节-0x81)*191+(尾字节-0x40)索引
+ * @remark 由misc/code_creater生成, 见gbk_table.cc
+ */
+extern const uint16_t kGbkTable[kGbkTableSize];
+
+/**
+ * 检测字符串是否只包含ASCII字符
+ * @param len 输出字符串长度, 不含结尾的'\0'
+ */
+inline bool IsAsciiString(const char *str, size_t max_len, size_t &len) {
+  bool ascii = true;
+  for (len = 0; len < max_len && str[len]; ++len) {
+    if (static_cast<uint8_t>(str[len]) & 0x80) {
+      ascii = false;
+    }
+  }
+  return ascii;
+}
+
+/**
+ * GBK->UTF-16
+ * @param out 输出缓冲区, 长度不小于len
+ * @return 输出的UTF-16编码单元个数
+ * @remark 无法解码的字节输出U+FFFD, 单字节0x80按CP936输出欧元符号
+ */
+inline size_t DecodeGbk(const char *str, size_t len, uint16_t *out) {
+  const uint8_t *src = reinterpret_cast<const uint8_t *>(str);
+  size_t n = 0;
+  for (size_t i = 0; i < len; ++i) {
+    uint8_t c = src[i];
+    if (c < 0x80) {
+      out[n++] = c;
+    } else if (c == 0x80) {
+      out[n++] = 0x20AC;
+    } else if (c <= kGbkLeadMax && i + 1 < len && src[i + 1] >= kGbkTrailMin &&
+               src[i + 1] <= kGbkTrailMax && src[i + 1] != 0x7F) {
+      out[n++] = kGbkTable[(c - kGbkLeadMin) * kGbkTrailCount +
+                           (src[++i] - kGbkTrailMin)];
+    } else {
+      out[n++] = 0xFFFD;
+    }
+  }
+  return n;
+}
+
+} /* namespace node_ctp */
+
+#endif /* GBK_H */
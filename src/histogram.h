@@ -0,0 +1,135 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * 此文件中定义延迟统计使用的直方图
+ */
+
+namespace node_ctp {
+
+/**
+ * 对数线性直方图(HDR风格)
+ * @remark 每个2的幂区间均分为16个子桶, 相对误差不超过1/16.
+ * 记录值单位为纳秒, 超过2^40(约18分钟)的值计入最后一个桶. 非线程安全
+ */
+class Histogram {
+ public:
+  Histogram() { Reset(); }
+
+  void Reset() {
+    memset(counts_, 0x0, sizeof(counts_));
+    count_ = 0;
+    sum_ = 0;
+    min_ = UINT64_MAX;
+    max_ = 0;
+  }
+
+  void Record(uint64_t value) {
+    ++counts_[Index(value)];
+    ++count_;
+    sum_ += value;
+    if (value < min_) {
+      min_ = value;
+    }
+    if (value > max_) {
+      max_ = value;
+    }
+  }
+
+  uint64_t Count() const { return count_; }
+
+  uint64_t Min() const { return count_ ? min_ : 0; }
+
+  uint64_t Max() const { return max_; }
+
+  double Mean() const {
+    return count_ ? static_cast<double>(sum_) / count_ : 0;
+  }
+
+  /**
+   * 读取分位数
+   * @param quantile 0~1之间的分位
+   * @return 对应桶的上界, 不超过记录到的最大值
+   */
+  uint64_t Percentile(double quantile) const {
+    if (count_ == 0) {
+      return 0;
+    }
+
+    uint64_t target = static_cast<uint64_t>(quantile * count_ + 0.5);
+    if (target == 0) {
+      target = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      seen += counts_[i];
+      if (seen >= target) {
+        uint64_t upper = UpperBound(i);
+        return upper < max_ ? upper : max_;
+      }
+    }
+    return max_;
+  }
+
+ private:
+  static const int kSubBits = 4;
+  static const int kSubBuckets = 1 << kSubBits;
+  static const int kMaxBits = 40;
+  static const int kBuckets = (kMaxBits - kSubBits + 1) * kSubBuckets;
+
+  static int Index(uint64_t value) {
+    if (value < static_cast<uint64_t>(kSubBuckets)) {
+      return static_cast<int>(value);
+    }
+
+    int bits = 63 - __builtin_clzll(value);
+    if (bits >= kMaxBits) {
+      return kBuckets - 1;
+    }
+
+    int sub = static_cast<int>(value >> (bits - kSubBits)) & (kSubBuckets - 1);
+    return (bits - kSubBits + 1) * kSubBuckets + sub;
+  }
+
+  static uint64_t UpperBound(int index) {
+    if (index < kSubBuckets) {
+      return index;
+    }
+
+    int bits = index / kSubBuckets + kSubBits - 1;
+    uint64_t sub = index % kSubBuckets;
+    return ((kSubBuckets + sub + 1) << (bits - kSubBits)) - 1;
+  }
+
+ private:
+  uint64_t counts_[kBuckets];
+  uint64_t count_;
+  uint64_t sum_;
+  uint64_t min_;
+  uint64_t max_;
+};
+
+/**
+ * 单个事件类型的延迟统计
+ */
+struct EventStats {
+  /* SPI线程收到事件->主线程取出事件 */
+  Histogram queue;
+
+  /* 事件数据转换为Node层对象 */
+  Histogram convert;
+
+  /* Node层回调函数执行 */
+  Histogram handler;
+
+  /* SPI线程收到事件->Node层回调函数执行完毕, 批量模式下截至批量回调返回 */
+  Histogram total;
+};
+
+} /* namespace node_ctp */
+
+#endif /* HISTOGRAM_H */
@@ -0,0 +1,166 @@
+#ifndef INTERN_TABLE_H
+#define INTERN_TABLE_H
+
+#include <node.h>
+#include <cstdint>
+#include <cstring>
+#include "ThostFtdcUserApiStruct.h"
+
+/**
+ * 此文件中定义常用字段的V8字符串驻留表
+ */
+
+namespace node_ctp {
+
+using namespace v8;
+
+/**
+ * 字符串驻留表统计计数
+ */
+struct InternStats {
+  /* 可驻留的字符串数 */
+  uint32_t capacity;
+  /* 已驻留的字符串数 */
+  uint32_t size;
+  /* 命中已驻留字符串的次数 */
+  uint64_t hits;
+  /* 未命中而创建字符串的次数 */
+  uint64_t misses;
+  /* 表满或过长而未能驻留的次数, 包含在misses中 */
+  uint64_t overflow;
+};
+
+/**
+ * V8字符串驻留表
+ * @remark 合约代码/交易所代码/日期等字段在一个交易日内只有有限个取值,
+ * 转换时按内容查找已创建的内部化字符串并复用, 避免每条行情重复创建.
+ * 使用开放寻址的连续数组, 只增不删, 表满后新值不再驻留. 仅可在主线程中使用
+ */
+class StringInternTable {
+ public:
+  /* 可驻留字符串的最大长度, 与合约代码类型一致 */
+  static const size_t kMaxKeyLength = sizeof(TThostFtdcInstrumentIDType) - 1;
+
+  explicit StringInternTable(uint32_t capacity) : slots_(NULL) {
+    Init(capacity);
+  }
+
+  /* 进程退出时Isolate可能已销毁, 不释放驻留的字符串 */
+  ~StringInternTable() { delete[] slots_; }
+
+  StringInternTable(const StringInternTable &) = delete;
+  StringInternTable &operator=(const StringInternTable &) = delete;
+
+  /**
+   * 查找或创建驻留字符串
+   * @param value ASCII字符串
+   * @param len 字符串长度
+   */
+  Local<String> Get(Isolate *isolate, const char *value, size_t len) {
+    Slot *slot = len <= kMaxKeyLength ? Find(value, len) : NULL;
+    if (slot && !slot->value.IsEmpty()) {
+      ++hits_;
+      return Local<String>::New(isolate, slot->value);
+    }
+
+    ++misses_;
+    Local<String> str =
+        String::NewFromOneByte(isolate,
+                               reinterpret_cast<const uint8_t *>(value),
+                               NewStringType::kInternalized, len)
+            .ToLocalChecked();
+    if (slot) {
+      memcpy(slot->key, value, len);
+      slot->key[len] = '\0';
+      slot->value.Reset(isolate, str);
+      ++size_;
+    } else {
+      ++overflow_;
+    }
+    return str;
+  }
+
+  /**
+   * 清空驻留表并重新设置容量
+   */
+  void Reset(uint32_t capacity) {
+    for (uint32_t i = 0; i <= mask_; ++i) {
+      slots_[i].value.Reset();
+    }
+    delete[] slots_;
+    Init(capacity);
+  }
+
+  InternStats Stats() const {
+    InternStats stats;
+    stats.capacity = capacity_;
+    stats.size = size_;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.overflow = overflow_;
+    return stats;
+  }
+
+ private:
+  struct Slot {
+    Slot() { key[0] = '\0'; }
+
+    char key[kMaxKeyLength + 1];
+    Persistent<String> value;
+  };
+
+  void Init(uint32_t capacity) {
+    /* 保持装载率不超过50%, 缩短探测距离 */
+    uint32_t n = 2;
+    while (n < capacity * 2 && n < (1u << 30)) {
+      n <<= 1;
+    }
+    slots_ = new Slot[n];
+    capacity_ = capacity;
+    mask_ = n - 1;
+    size_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+    overflow_ = 0;
+  }
+
+  static uint32_t Hash(const char *key, size_t len) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+      hash = (hash ^ static_cast<uint8_t>(key[i])) * 16777619u;
+    }
+    return hash;
+  }
+
+  /**
+   * 查找字符串所在槽位
+   * @return 已驻留的槽位, 或可用于驻留的空槽位; 表满时返回NULL
+   */
+  Slot *Find(const char *key, size_t len) {
+    uint32_t index = Hash(key, len) & mask_;
+    for (uint32_t i = 0; i <= mask_; ++i, index = (index + 1) & mask_) {
+      Slot &slot = slots_[index];
+      if (slot.value.IsEmpty()) {
+        return size_ < capacity_ ? &slot : NULL;
+      }
+      if (memcmp(slot.key, key, len) == 0 && slot.key[len] == '\0') {
+        return &slot;
+      }
+    }
+    return NULL;
+  }
+
+ private:
+  Slot *slots_;
+  uint32_t capacity_;
+  uint32_t mask_;
+  uint32_t size_;
+  uint64_t hits_;
+  uint64_t misses_;
+  uint64_t overflow_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* INTERN_TABLE_H */
@@ -0,0 +1,564 @@
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#include <uv.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * 此文件中定义SPI事件的二进制日志
+ * 日志由若干定长的段文件组成, 文件名为<前缀>.<段序号>.jnl, 段序号为6位十进制.
+ * 每个段以JournalSegmentHeader开头, 之后依次为JournalRecordHeader+CTP结构体,
+ * 每条记录按8字节对齐. size为0的记录头表示段结束, 后续记录位于下一个段中
+ */
+
+namespace node_ctp {
+
+using std::atomic;
+using std::string;
+
+/* 段文件头部标识 */
+const char kJournalMagic[8] = {'C', 'T', 'P', 'J', 'R', 'N', 'L', '1'};
+const uint32_t kJournalVersion = 1;
+
+/**
+ * 段文件头部, 占用段起始的64字节
+ */
+struct JournalSegmentHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+
+  /* 段序号 */
+  uint32_t segment;
+  uint32_t reserved0;
+
+  /* 创建时间, UTC纳秒 */
+  uint64_t created;
+
+  /* 事件来源, md或td, 事件类型仅在同一来源中有意义 */
+  char source[8];
+
+  uint64_t reserved[3];
+};
+
+/**
+ * 记录头部
+ */
+struct JournalRecordHeader {
+  /* 事件数据长度, 不含头部及对齐填充. 为0时表示段结束 */
+  uint32_t size;
+
+  /* SPI响应事件类型 */
+  int32_t ev;
+
+  /* SPI线程收到事件的时间, uv_hrtime单调时钟纳秒, 用于回放时还原事件间隔 */
+  uint64_t recv_time;
+
+  /* SPI线程收到事件的时间, UTC纳秒 */
+  uint64_t wall_time;
+};
+
+static_assert(sizeof(JournalSegmentHeader) == 64,
+              "JournalSegmentHeader size mismatch");
+static_assert(sizeof(JournalRecordHeader) == 24,
+              "JournalRecordHeader size mismatch");
+
+/**
+ * 日志统计计数
+ */
+struct JournalStats {
+  /* 已创建的段数 */
+  uint64_t segments;
+  /* 已写入的记录数 */
+  uint64_t records;
+  /* 已写入的字节数, 含记录头部 */
+  uint64_t bytes;
+  /* 创建段文件失败的次数, 失败后停止记录 */
+  uint64_t errors;
+};
+
+/**
+ * SPI事件二进制日志写入器
+ * @remark 由SPI线程直接将CTP结构体复制到内存映射的段文件中, 不经过主线程,
+ * 写满一个段后关闭并创建下一个段. 未开启时只有一次原子变量读取的开销.
+ * Open/Close/Stats可在主线程中调用, Append仅可在SPI线程中调用
+ */
+class JournalWriter {
+ public:
+  explicit JournalWriter(const char *source)
+      : enabled_(false),
+        fd_(-1),
+        base_(NULL),
+        segment_size_(0),
+        offset_(0),
+        segment_(0),
+        segments_(0),
+        records_(0),
+        bytes_(0),
+        errors_(0) {
+    strncpy(source_, source, sizeof(source_) - 1);
+    source_[sizeof(source_) - 1] = '\0';
+  }
+
+  ~JournalWriter() { Close(); }
+
+  JournalWriter(const JournalWriter &) = delete;
+  JournalWriter &operator=(const JournalWriter &) = delete;
+
+  /**
+   * 开始记录
+   * @param prefix 段文件路径前缀, 从第一个不存在的段序号开始写入
+   * @param segment_size 段文件长度, 向上取整为页大小的整数倍
+   * @param error 失败时输出错误信息
+   */
+  bool Open(const string &prefix, uint64_t segment_size, string &error) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+
+    uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t min_size = sizeof(JournalSegmentHeader) +
+                        sizeof(JournalRecordHeader) * 2 + kMaxRecordSize;
+    if (segment_size < min_size) {
+      segment_size = min_size;
+    }
+    segment_size_ = (segment_size + page - 1) / page * page;
+    prefix_ = prefix;
+
+    segment_ = 0;
+    while (access(SegmentPath(prefix_, segment_).c_str(), F_OK) == 0) {
+      ++segment_;
+    }
+    if (!OpenSegment()) {
+      error = "Cannot create journal segment " +
+              SegmentPath(prefix_, segment_) + ": " + strerror(errno);
+      return false;
+    }
+
+    enabled_.store(true, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * 停止记录并关闭当前段文件
+   */
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+  }
+
+  /**
+   * 追加一条事件记录, 仅可在SPI线程中调用
+   */
+  template <typename T>
+  void Append(int ev, const T *data) {
+    static_assert(sizeof(T) <= kMaxRecordSize, "journal record too large");
+    if (!data || !enabled_.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (base_) {
+      AppendLocked(ev, data, sizeof(T));
+    }
+  }
+
+  JournalStats Stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    JournalStats stats;
+    stats.segments = segments_;
+    stats.records = records_;
+    stats.bytes = bytes_;
+    stats.errors = errors_;
+    return stats;
+  }
+
+  /**
+   * 段文件路径
+   */
+  static string SegmentPath(const string &prefix, uint32_t segment) {
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%06u.jnl", segment);
+    return prefix + suffix;
+  }
+
+ private:
+  /* 单条事件数据的长度上限, 大于所有记录的CTP结构体 */
+  static const uint64_t kMaxRecordSize = 4096;
+
+  static uint64_t Align(uint64_t size) { return (size + 7) & ~uint64_t(7); }
+
+  static uint64_t WallTime() {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+  }
+
+  void AppendLocked(int ev, const void *data, uint32_t size) {
+    uint64_t length = sizeof(JournalRecordHeader) + Align(size);
+
+    /* 保留一个记录头的空间用于写入段结束标记 */
+    if (offset_ + length + sizeof(JournalRecordHeader) > segment_size_) {
+      CloseSegment();
+      ++segment_;
+      if (!OpenSegment()) {
+        ++errors_;
+        enabled_.store(false, std::memory_order_release);
+        return;
+      }
+    }
+
+    JournalRecordHeader header;
+    header.size = size;
+    header.ev = ev;
+    header.recv_time = uv_hrtime();
+    header.wall_time = WallTime();
+
+    char *dst = base_ + offset_;
+    memcpy(dst, &header, sizeof(header));
+    memcpy(dst + sizeof(header), data, size);
+    offset_ += length;
+
+    ++records_;
+    bytes_ += length;
+  }
+
+  bool OpenSegment() {
+    string path = SegmentPath(prefix_, segment_);
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) {
+      return false;
+    }
+    if (ftruncate(fd, segment_size_) != 0) {
+      close(fd);
+      return false;
+    }
+    void *base =
+        mmap(NULL, segment_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+      close(fd);
+      return false;
+    }
+
+    fd_ = fd;
+    base_ = static_cast<char *>(base);
+
+    /* ftruncate扩展的部分已填充为0, 即段结束标记 */
+    JournalSegmentHeader header;
+    memset(&header, 0x0, sizeof(header));
+    memcpy(header.magic, kJournalMagic, sizeof(header.magic));
+    header.version = kJournalVersion;
+    header.header_size = sizeof(header);
+    header.segment = segment_;
+    header.created = WallTime();
+    memcpy(header.source, source_, sizeof(header.source));
+    memcpy(base_, &header, sizeof(header));
+
+    offset_ = sizeof(header);
+    ++segments_;
+    return true;
+  }
+
+  void CloseSegment() {
+    if (base_) {
+      munmap(base_, segment_size_);
+      base_ = NULL;
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+  }
+
+  void CloseLocked() {
+    enabled_.store(false, std::memory_order_release);
+    CloseSegment();
+  }
+
+ private:
+  /* 是否正在记录, SPI线程据此跳过加锁 */
+  atomic<bool> enabled_;
+
+  /* 保护以下成员, 仅在打开/关闭日志时与SPI线程竞争 */
+  std::mutex mutex_;
+
+  char source_[8];
+  string prefix_;
+  int fd_;
+  char *base_;
+  uint64_t segment_size_;
+  uint64_t offset_;
+  uint32_t segment_;
+
+  uint64_t segments_;
+  uint64_t records_;
+  uint64_t bytes_;
+  uint64_t errors_;
+};
+
+/**
+ * SPI事件二进制日志读取器
+ * @remark 按段序号依次以只读方式映射段文件, 遇到段结束标记或段文件末尾时
+ * 切换到下一个段, 下一个段不存在时结束
+ */
+class JournalReader {
+ public:
+  JournalReader() : fd_(-1), base_(NULL), size_(0), offset_(0), segment_(0) {}
+
+  ~JournalReader() { CloseSegment(); }
+
+  JournalReader(const JournalReader &) = delete;
+  JournalReader &operator=(const JournalReader &) = delete;
+
+  /**
+   * 打开日志
+   * @param prefix 段文件路径前缀, 从段序号0开始读取
+   * @param source 事件来源, 与段文件头部不一致时打开失败
+   */
+  bool Open(const string &prefix, const char *source, string &error) {
+    CloseSegment();
+    prefix_ = prefix;
+    source_ = source;
+    segment_ = 0;
+    if (!OpenSegment(error)) {
+      if (error.empty()) {
+        error = "Cannot open journal segment " +
+                JournalWriter::SegmentPath(prefix_, segment_) + ": " +
+                strerror(errno);
+      }
+      return false;
+    }
+    return true;
+  }
+
+  /**
+   * 读取下一条记录
+   * @param data 输出事件数据, 在下一次调用Next之前有效
+   * @return 日志结束时返回false
+   */
+  bool Next(JournalRecordHeader &header, const char *&data) {
+    for (;;) {
+      if (!base_) {
+        return false;
+      }
+      if (offset_ + sizeof(header) <= size_) {
+        memcpy(&header, base_ + offset_, sizeof(header));
+        uint64_t length = sizeof(header) + ((header.size + 7) & ~7u);
+        if (header.size > 0 && offset_ + length <= size_) {
+          data = base_ + offset_ + sizeof(header);
+          offset_ += length;
+          return true;
+        }
+      }
+
+      /* 当前段结束, 切换到下一个段 */
+      string error;
+      CloseSegment();
+      ++segment_;
+      if (!OpenSegment(error)) {
+        return false;
+      }
+    }
+  }
+
+ private:
+  bool OpenSegment(string &error) {
+    string path = JournalWriter::SegmentPath(prefix_, segment_);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    if (size < static_cast<off_t>(sizeof(JournalSegmentHeader))) {
+      close(fd);
+      error = "Invalid journal segment " + path;
+      return false;
+    }
+    void *base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+      close(fd);
+      return false;
+    }
+
+    fd_ = fd;
+    base_ = static_cast<const char *>(base);
+    size_ = size;
+
+    JournalSegmentHeader header;
+    memcpy(&header, base_, sizeof(header));
+    if (memcmp(header.magic, kJournalMagic, sizeof(header.magic)) != 0 ||
+        header.version != kJournalVersion ||
+        strncmp(header.source, source_.c_str(), sizeof(header.source)) != 0) {
+      CloseSegment();
+      error = "Invalid journal segment " + path;
+      return false;
+    }
+
+    offset_ = header.header_size;
+    madvise(const_cast<char *>(base_), size_, MADV_SEQUENTIAL);
+    return true;
+  }
+
+  void CloseSegment() {
+    if (base_) {
+      munmap(const_cast<char *>(base_), size_);
+      base_ = NULL;
+    }
+    if (fd_ >= 0) {
+      close(fd_);
+      fd_ = -1;
+    }
+  }
+
+ private:
+  string prefix_;
+  string source_;
+  int fd_;
+  const char *base_;
+  uint64_t size_;
+  uint64_t offset_;
+  uint32_t segment_;
+};
+
+/**
+ * SPI事件日志回放线程
+ * @remark 在独立线程中读取日志, 按记录的事件间隔(可加速)调用sink, 模拟SPI线程.
+ * sink与CTP的SPI回调函数运行在同一位置, 因此回放期间不能同时连接前置机.
+ * Start/Stop/Join仅可在主线程中调用
+ */
+class JournalReplayer {
+ public:
+  /**
+   * 事件回调, 在回放线程中调用
+   */
+  typedef void (*Sink)(void *ctx, int ev, const char *data, uint32_t size);
+
+  /**
+   * 回放结束回调, 在回放线程中调用
+   */
+  typedef void (*Done)(void *ctx);
+
+  JournalReplayer()
+      : running_(false), stop_(false), finished_(false), count_(0) {}
+
+  ~JournalReplayer() {
+    RequestStop();
+    Join();
+  }
+
+  JournalReplayer(const JournalReplayer &) = delete;
+  JournalReplayer &operator=(const JournalReplayer &) = delete;
+
+  /**
+   * 开始回放
+   * @param speed 回放倍速, 1为按原始间隔, 为0时不等待
+   */
+  bool Start(const string &prefix, const char *source, double speed,
+             Sink sink, Done done, void *ctx, string &error) {
+    if (running_) {
+      error = "Replay already running";
+      return false;
+    }
+    if (!reader_.Open(prefix, source, error)) {
+      return false;
+    }
+
+    speed_ = speed;
+    sink_ = sink;
+    done_ = done;
+    ctx_ = ctx;
+    stop_.store(false);
+    finished_.store(false);
+    count_.store(0);
+    if (uv_thread_create(&thread_, Run, this) != 0) {
+      error = "Cannot create replay thread";
+      return false;
+    }
+    running_ = true;
+    return true;
+  }
+
+  /**
+   * 通知回放线程停止, 回放线程可能阻塞在已满的事件队列上, 调用者需要继续
+   * 消费事件直到Finished
+   */
+  void RequestStop() { stop_.store(true); }
+
+  /**
+   * 回放线程已结束时回收线程
+   */
+  void Join() {
+    if (running_) {
+      uv_thread_join(&thread_);
+      running_ = false;
+    }
+  }
+
+  bool Running() const { return running_; }
+
+  bool Finished() const { return finished_.load(std::memory_order_acquire); }
+
+  /* 已回放的事件数 */
+  uint64_t Count() const { return count_.load(std::memory_order_relaxed); }
+
+ private:
+  static void Run(void *arg) {
+    JournalReplayer *self = static_cast<JournalReplayer *>(arg);
+    JournalRecordHeader header;
+    const char *data = NULL;
+    uint64_t last_recv = 0;
+    uint64_t elapsed = 0;
+    uint64_t start = uv_hrtime();
+
+    while (!self->stop_.load(std::memory_order_relaxed) &&
+           self->reader_.Next(header, data)) {
+      if (self->speed_ > 0) {
+        /* 累计记录的事件间隔, 不同进程写入的段之间时钟不连续, 倒退时视为0 */
+        if (last_recv != 0 && header.recv_time > last_recv) {
+          elapsed += header.recv_time - last_recv;
+        }
+        last_recv = header.recv_time;
+
+        /* 落后于记录的节奏时不等待 */
+        uint64_t due = start + static_cast<uint64_t>(elapsed / self->speed_);
+        uint64_t now = uv_hrtime();
+        if (due > now) {
+          std::this_thread::sleep_for(std::chrono::nanoseconds(due - now));
+        }
+      }
+
+      self->sink_(self->ctx_, header.ev, data, header.size);
+      self->count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    self->finished_.store(true, std::memory_order_release);
+    self->done_(self->ctx_);
+  }
+
+ private:
+  JournalReader reader_;
+  uv_thread_t thread_;
+  bool running_;
+  atomic<bool> stop_;
+  atomic<bool> finished_;
+  atomic<uint64_t> count_;
+  double speed_;
+  Sink sink_;
+  Done done_;
+  void *ctx_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* JOURNAL_H */
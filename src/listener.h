@@ -0,0 +1,320 @@
+#ifndef LISTENER_H
+#define LISTENER_H
+
+#include <node.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * 此文件中定义Node层SPI事件监听函数表
+ */
+
+namespace node_ctp {
+
+using namespace v8;
+using std::string;
+using std::unique_ptr;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+/**
+ * SPI事件监听函数表
+ * @remark 每个事件有一个主回调函数(on注册, 重复注册时覆盖)和任意个附加监听
+ * 函数(addListener注册). 事件数据只转换一次, 依次传递给所有匹配的监听函数.
+ * 附加监听函数可以按合约代码过滤, 在转换Node层对象之前按事件数据中的
+ * InstrumentID匹配, 不带合约代码的事件传递给全部监听函数.
+ * 指定了合约的监听函数按合约代码索引在散列表中, 每个事件只查找一次, 与合约数
+ * 和监听函数数无关. 每个回调函数注册时创建独立的async_hooks上下文, 调用时
+ * 以该上下文进入JS, 保持异步调用链. 仅可在主线程中使用
+ */
+class ListenerTable {
+ public:
+  ListenerTable()
+      : isolate_(NULL), next_id_(1), dispatching_(0), dirty_(false) {}
+
+  ~ListenerTable() {
+    for (unordered_map<int, EventListeners>::iterator it = events_.begin();
+         it != events_.end(); ++it) {
+      if (!it->second.primary.IsEmpty()) {
+        node::EmitAsyncDestroy(isolate_, it->second.primary_context);
+        it->second.primary.Reset();
+      }
+      for (size_t i = 0; i < it->second.listeners.size(); ++i) {
+        Listener *listener = it->second.listeners[i].get();
+        if (!listener->callback.IsEmpty()) {
+          node::EmitAsyncDestroy(isolate_, listener->context);
+          listener->callback.Reset();
+        }
+      }
+    }
+  }
+
+  ListenerTable(const ListenerTable &) = delete;
+  ListenerTable &operator=(const ListenerTable &) = delete;
+
+  /**
+   * 设置事件的主回调函数
+   */
+  void SetPrimary(Isolate *isolate, int ev, Local<Function> cb) {
+    isolate_ = isolate;
+    EventListeners &entry = events_[ev];
+    if (!entry.primary.IsEmpty()) {
+      node::EmitAsyncDestroy(isolate, entry.primary_context);
+    }
+    entry.primary.Reset(isolate, cb);
+    entry.primary_context = node::EmitAsyncInit(isolate, cb, kResourceName);
+  }
+
+  bool HasPrimary(int ev) const {
+    unordered_map<int, EventListeners>::const_iterator it = events_.find(ev);
+    return it != events_.end() && !it->second.primary.IsEmpty();
+  }
+
+  /**
+   * 设置事件是否按合约独占路由
+   * @remark 开启后带有合约代码的事件只传递给指定了该合约的监听函数, 不再传递
+   * 给主回调函数及未指定合约的监听函数, 没有对应监听函数的事件不做转换
+   */
+  void SetRouted(int ev, bool routed) { events_[ev].routed = routed; }
+
+  /**
+   * 事件是否需要传递给主回调函数
+   * @param instrument 事件数据中的合约代码, 不带合约代码的事件为NULL
+   */
+  bool WantsPrimary(int ev, const char *instrument) const {
+    unordered_map<int, EventListeners>::const_iterator it = events_.find(ev);
+    if (it == events_.end() || it->second.primary.IsEmpty()) {
+      return false;
+    }
+    return !instrument || !it->second.routed;
+  }
+
+  /**
+   * 添加附加监听函数
+   * @param instruments 合约代码, 为空时接收全部合约
+   * @return 监听函数ID, 用于Remove
+   */
+  uint32_t Add(Isolate *isolate, int ev, Local<Function> cb,
+               const vector<string> &instruments) {
+    isolate_ = isolate;
+    unique_ptr<Listener> listener(new Listener());
+    listener->id = next_id_++;
+    listener->callback.Reset(isolate, cb);
+    listener->context = node::EmitAsyncInit(isolate, cb, kResourceName);
+    listener->instruments.insert(instruments.begin(), instruments.end());
+
+    uint32_t id = listener->id;
+    EventListeners &entry = events_[ev];
+    entry.listeners.push_back(std::move(listener));
+    Rebuild(entry);
+    return id;
+  }
+
+  /**
+   * 移除附加监听函数
+   * @return 监听函数不存在时返回false
+   * @remark 可以在监听函数中调用, 分发过程中只做标记, 分发结束后再删除
+   */
+  bool Remove(Isolate *isolate, uint32_t id) {
+    for (unordered_map<int, EventListeners>::iterator it = events_.begin();
+         it != events_.end(); ++it) {
+      vector<unique_ptr<Listener>> &listeners = it->second.listeners;
+      for (size_t i = 0; i < listeners.size(); ++i) {
+        if (listeners[i]->id != id || listeners[i]->callback.IsEmpty()) {
+          continue;
+        }
+        node::EmitAsyncDestroy(isolate, listeners[i]->context);
+        listeners[i]->callback.Reset();
+        if (dispatching_ > 0) {
+          dirty_ = true;
+        } else {
+          listeners.erase(listeners.begin() + i);
+          Rebuild(it->second);
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * 事件是否有需要接收的监听函数, 用于在转换之前丢弃事件
+   * @param instrument 事件数据中的合约代码, 不带合约代码的事件为NULL
+   * @param primary 是否计入主回调函数
+   */
+  bool Wants(int ev, const char *instrument, bool primary = true) const {
+    unordered_map<int, EventListeners>::const_iterator it = events_.find(ev);
+    if (it == events_.end()) {
+      return false;
+    }
+
+    const EventListeners &entry = it->second;
+    if (instrument && entry.routed) {
+      return entry.routes.count(instrument) > 0;
+    }
+    if (primary && !entry.primary.IsEmpty()) {
+      return true;
+    }
+    if (!entry.unfiltered.empty()) {
+      return true;
+    }
+    return instrument ? entry.routes.count(instrument) > 0
+                      : !entry.routes.empty();
+  }
+
+  /**
+   * 调用事件的全部匹配监听函数
+   * @param primary 是否调用主回调函数, 批量模式下主回调函数由批量回调代替
+   * @return 调用的监听函数个数
+   */
+  int Dispatch(Isolate *isolate, Local<Object> ctx, int ev,
+               const char *instrument, int argc, Local<Value> *argv,
+               bool primary = true) {
+    unordered_map<int, EventListeners>::iterator it = events_.find(ev);
+    if (it == events_.end()) {
+      return 0;
+    }
+
+    /* 回调函数中可能添加或移除监听函数, 分发过程中不修改索引, 分发结束后
+     * 再重建. 添加事件可能导致散列表重建, 但不影响已有元素的引用 */
+    EventListeners &entry = it->second;
+    int called = 0;
+    ++dispatching_;
+
+    bool routed = instrument && entry.routed;
+    if (primary && !routed && !entry.primary.IsEmpty()) {
+      node::MakeCallback(isolate, ctx,
+                         Local<Function>::New(isolate, entry.primary), argc,
+                         argv, entry.primary_context);
+      ++called;
+    }
+    if (!routed) {
+      called += Call(isolate, ctx, entry.unfiltered, argc, argv);
+    }
+    if (instrument) {
+      unordered_map<string, vector<Listener *>>::iterator rIt =
+          entry.routes.find(instrument);
+      if (rIt != entry.routes.end()) {
+        called += Call(isolate, ctx, rIt->second, argc, argv);
+      }
+    } else {
+      /* 不带合约代码的事件传递给全部监听函数 */
+      called += Call(isolate, ctx, entry.filtered, argc, argv);
+    }
+
+    if (--dispatching_ == 0 && dirty_) {
+      Compact();
+    }
+    return called;
+  }
+
+ private:
+  /* async_hooks中的资源类型名 */
+  static constexpr const char *kResourceName = "CtpListener";
+
+  struct Listener {
+    uint32_t id;
+    Persistent<Function> callback;
+    node::async_context context;
+    unordered_set<string> instruments;
+  };
+
+  struct EventListeners {
+    EventListeners() : routed(false) {}
+
+    Persistent<Function> primary;
+    node::async_context primary_context;
+    vector<unique_ptr<Listener>> listeners;
+
+    /* 按监听函数是否指定合约建立的索引, 由listeners重建 */
+    vector<Listener *> unfiltered;
+    vector<Listener *> filtered;
+    unordered_map<string, vector<Listener *>> routes;
+
+    bool routed;
+  };
+
+  static int Call(Isolate *isolate, Local<Object> ctx,
+                  const vector<Listener *> &listeners, int argc,
+                  Local<Value> *argv) {
+    int called = 0;
+    for (size_t i = 0; i < listeners.size(); ++i) {
+      /* 分发过程中被移除的监听函数只做了标记 */
+      if (listeners[i]->callback.IsEmpty()) {
+        continue;
+      }
+      node::MakeCallback(isolate, ctx,
+                         Local<Function>::New(isolate, listeners[i]->callback),
+                         argc, argv, listeners[i]->context);
+      ++called;
+    }
+    return called;
+  }
+
+  /**
+   * 重建事件的监听函数索引, 分发过程中推迟到分发结束后
+   */
+  void Rebuild(EventListeners &entry) {
+    if (dispatching_ > 0) {
+      dirty_ = true;
+      return;
+    }
+
+    entry.unfiltered.clear();
+    entry.filtered.clear();
+    entry.routes.clear();
+    for (size_t i = 0; i < entry.listeners.size(); ++i) {
+      Listener *listener = entry.listeners[i].get();
+      if (listener->instruments.empty()) {
+        entry.unfiltered.push_back(listener);
+        continue;
+      }
+      entry.filtered.push_back(listener);
+      for (unordered_set<string>::iterator it = listener->instruments.begin();
+           it != listener->instruments.end(); ++it) {
+        entry.routes[*it].push_back(listener);
+      }
+    }
+  }
+
+  /**
+   * 删除分发过程中被移除的监听函数并重建索引
+   */
+  void Compact() {
+    for (unordered_map<int, EventListeners>::iterator it = events_.begin();
+         it != events_.end(); ++it) {
+      vector<unique_ptr<Listener>> &listeners = it->second.listeners;
+      size_t n = 0;
+      for (size_t i = 0; i < listeners.size(); ++i) {
+        if (!listeners[i]->callback.IsEmpty()) {
+          listeners[n++] = std::move(listeners[i]);
+        }
+      }
+      listeners.resize(n);
+    }
+    dirty_ = false;
+    for (unordered_map<int, EventListeners>::iterator it = events_.begin();
+         it != events_.end(); ++it) {
+      Rebuild(it->second);
+    }
+  }
+
+ private:
+  unordered_map<int, EventListeners> events_;
+
+  /* 注册回调函数时的Isolate, 析构时销毁async_hooks上下文 */
+  Isolate *isolate_;
+
+  uint32_t next_id_;
+  int dispatching_;
+  bool dirty_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* LISTENER_H */
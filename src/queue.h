@@ -1,78 +1,274 @@
 #ifndef QUEUE_H
 #define QUEUE_H
 
-#include <condition_variable>
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+
+/**
+ * 此文件中定义SPI线程与主线程之间传递事件使用的无锁队列
+ */
 
 namespace node_ctp {
 
-using std::mutex;
-using std::unique_lock;
-using std::condition_variable;
-using std::queue;
+using std::atomic;
+using std::string;
+
+/**
+ * 队列满时的处理策略
+ */
+enum OverflowPolicy {
+  /* 生产者自旋等待, 不丢弃任何事件 */
+  OVERFLOW_BLOCK = 0,
+  /* 丢弃队列中最早的事件 */
+  OVERFLOW_DROP_OLDEST = 1,
+  /* 丢弃新到达的事件并计数 */
+  OVERFLOW_DROP_NEWEST = 2,
+};
+
+/**
+ * Node层溢出策略字符串->枚举
+ */
+inline bool ParseOverflowPolicy(const string &name, OverflowPolicy &out) {
+  if (name == "block") {
+    out = OVERFLOW_BLOCK;
+  } else if (name == "dropOldest") {
+    out = OVERFLOW_DROP_OLDEST;
+  } else if (name == "dropNewest") {
+    out = OVERFLOW_DROP_NEWEST;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/* 缓存行长度 */
+static const size_t kCacheLine = 64;
+
+/**
+ * 按指定对齐分配内存
+ * @remark C++11的new不保证超过alignof(max_align_t)的对齐, 含有按缓存行对齐
+ * 成员的类需要通过类内的operator new调用此函数
+ */
+inline void *AlignedAlloc(size_t size, size_t alignment) {
+  void *ptr = NULL;
+  if (posix_memalign(&ptr, alignment, size) != 0) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+inline void AlignedFree(void *ptr) { free(ptr); }
+
+/**
+ * 队列统计计数
+ */
+struct QueueStats {
+  uint64_t capacity;
+  uint64_t size;
+  uint64_t pushed;
+  uint64_t popped;
+  uint64_t dropped;
+  uint64_t blocked;
+  uint64_t high_water;
+};
 
+/**
+ * 有界单生产者单消费者无锁队列
+ * @remark 生产者为CTP的SPI线程, 消费者为Node主线程. 读写游标分别位于不同的
+ * 缓存行, 各自缓存对端游标以减少缓存行争用. 元素类型需要可平凡复制(指针等).
+ * 队列及读写游标所在的数据组均按缓存行对齐, 作为成员时所在的类需要按对齐分配
+ */
 template <typename T>
-class ConcurrentQueue {
+class alignas(kCacheLine) SpscQueue {
  public:
-  T Pop() {
-    unique_lock<mutex> lock(mutex_);
-    while (queue_.empty()) {
-      cond_.wait(lock);
+  explicit SpscQueue(uint32_t capacity = 65536,
+                     OverflowPolicy policy = OVERFLOW_BLOCK)
+      : policy_(policy),
+        head_(0),
+        cached_tail_(0),
+        popped_(0),
+        high_water_(0),
+        tail_(0),
+        cached_head_(0),
+        pushed_(0),
+        dropped_(0),
+        blocked_(0) {
+    uint32_t n = 2;
+    while (n < capacity && n < (1u << 30)) {
+      n <<= 1;
     }
-    auto item = queue_.front();
-    queue_.pop();
+    capacity_ = n;
+    mask_ = n - 1;
+    buffer_ = new atomic<T>[n];
+  }
+
+  ~SpscQueue() { delete[] buffer_; }
+
+  SpscQueue(const SpscQueue &) = delete;
+  SpscQueue &operator=(const SpscQueue &) = delete;
 
-    return item;
+  static void *operator new(size_t size) {
+    return AlignedAlloc(size, alignof(SpscQueue));
   }
 
-  void Pop(T& item) {
-    unique_lock<mutex> lock(mutex_);
+  static void operator delete(void *ptr) { AlignedFree(ptr); }
 
-    while (queue_.empty()) {
-      cond_.wait(lock);
+  /**
+   * 入队, 仅可在生产者线程中调用
+   * @param item 新元素
+   * @param dropped 因队列已满而被丢弃的元素, 由调用者负责释放
+   * @return 有元素被丢弃时返回false
+   */
+  bool Push(const T &item, T &dropped) {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    bool ok = true;
+
+    if (tail - cached_head_ >= capacity_) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+
+      if (tail - cached_head_ >= capacity_) {
+        switch (policy_) {
+          case OVERFLOW_BLOCK: {
+            Increase(blocked_);
+            do {
+              std::this_thread::yield();
+              cached_head_ = head_.load(std::memory_order_acquire);
+            } while (tail - cached_head_ >= capacity_);
+            break;
+          }
+          case OVERFLOW_DROP_OLDEST: {
+            /* 与消费者竞争推进读游标, 失败说明消费者已取走元素, 队列有空位 */
+            uint64_t head = cached_head_;
+            T oldest = buffer_[head & mask_].load(std::memory_order_relaxed);
+            if (head_.compare_exchange_strong(head, head + 1,
+                                              std::memory_order_acq_rel)) {
+              dropped = oldest;
+              ok = false;
+              Increase(dropped_);
+              cached_head_ = head + 1;
+            } else {
+              cached_head_ = head;
+            }
+            break;
+          }
+          case OVERFLOW_DROP_NEWEST:
+          default: {
+            dropped = item;
+            Increase(dropped_);
+            return false;
+          }
+        }
+      }
     }
-    item = queue_.front();
-    queue_.pop();
+
+    buffer_[tail & mask_].store(item, std::memory_order_relaxed);
+    tail_.store(tail + 1, std::memory_order_release);
+    Increase(pushed_);
+    return ok;
   }
 
-  bool TryPop(T& item) {
-    unique_lock<mutex> lock(mutex_);
+  /**
+   * 出队, 仅可在消费者线程中调用
+   * @return 队列为空时返回false
+   */
+  bool TryPop(T &item) {
+    uint64_t head = head_.load(std::memory_order_relaxed);
+
+    for (;;) {
+      /* 丢弃最早元素策略下读游标可能越过缓存的写游标, 因此不能用相等判断 */
+      if (head >= cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (head >= cached_tail_) {
+          return false;
+        }
+        /* 占用量由消费者在刷新写游标时统计, 生产者缓存的读游标可能已过时 */
+        uint64_t size = cached_tail_ - head;
+        if (size > high_water_.load(std::memory_order_relaxed)) {
+          high_water_.store(size, std::memory_order_relaxed);
+        }
+      }
 
-    if (queue_.empty()) {
-      return false;
+      item = buffer_[head & mask_].load(std::memory_order_relaxed);
+
+      if (policy_ != OVERFLOW_DROP_OLDEST) {
+        head_.store(head + 1, std::memory_order_release);
+        break;
+      }
+
+      /* 丢弃最早元素策略下生产者也会推进读游标 */
+      if (head_.compare_exchange_weak(head, head + 1,
+                                      std::memory_order_acq_rel,
+                                      std::memory_order_relaxed)) {
+        break;
+      }
     }
 
-    item = queue_.front();
-    queue_.pop();
+    Increase(popped_);
     return true;
   }
 
-  void Push(const T& item) {
-    unique_lock<mutex> lock(mutex_);
-    queue_.push(item);
-    lock.unlock();
-    cond_.notify_one();
+  bool Empty() const {
+    return head_.load(std::memory_order_acquire) ==
+           tail_.load(std::memory_order_acquire);
   }
 
-  void Push(T&& item) {
-    unique_lock<mutex> lock(mutex_);
-    queue_.push(move(item));
-    lock.unlock();
-    cond_.notify_one();
+  uint64_t Size() const {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
   }
 
-  bool Empty() {
-    unique_lock<mutex> lock(mutex_);
-    return queue_.empty();
+  uint32_t Capacity() const { return capacity_; }
+
+  OverflowPolicy Policy() const { return policy_; }
+
+  /**
+   * 读取统计计数, 可在任意线程中调用
+   */
+  QueueStats Stats() const {
+    QueueStats stats;
+    stats.capacity = capacity_;
+    stats.size = Size();
+    stats.pushed = pushed_.load(std::memory_order_relaxed);
+    stats.popped = popped_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
+    stats.blocked = blocked_.load(std::memory_order_relaxed);
+    stats.high_water = high_water_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  /* 计数器只有一个写线程, 无需原子加 */
+  static void Increase(atomic<uint64_t> &counter) {
+    counter.store(counter.load(std::memory_order_relaxed) + 1,
+                  std::memory_order_relaxed);
   }
 
  private:
-  queue<T> queue_;
-  mutex mutex_;
-  condition_variable cond_;
+  /* 只读数据 */
+  atomic<T> *buffer_;
+  uint32_t capacity_;
+  uint32_t mask_;
+  OverflowPolicy policy_;
+
+  /* 消费者数据 */
+  alignas(kCacheLine) atomic<uint64_t> head_;
+  uint64_t cached_tail_;
+  atomic<uint64_t> popped_;
+  atomic<uint64_t> high_water_;
+
+  /* 生产者数据 */
+  alignas(kCacheLine) atomic<uint64_t> tail_;
+  uint64_t cached_head_;
+  atomic<uint64_t> pushed_;
+  atomic<uint64_t> dropped_;
+  atomic<uint64_t> blocked_;
 };
 
 } /* node_ctp */
 
-#endif /* QUEUE_H */
\ No newline at end of file
+#endif /* QUEUE_H */
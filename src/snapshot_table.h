@@ -0,0 +1,225 @@
+#ifndef SNAPSHOT_TABLE_H
+#define SNAPSHOT_TABLE_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include "ThostFtdcUserApiStruct.h"
+#include "queue.h"
+
+/**
+ * 此文件中定义按合约代码索引的最新行情快照表
+ */
+
+namespace node_ctp {
+
+using std::atomic;
+
+/**
+ * 最新行情快照表
+ * @remark SPI线程是唯一的写入者, 主线程读取. 使用开放寻址的连续数组,
+ * 合约只增不删; 每个槽位使用序号锁(seqlock), 读取时不会阻塞写入者.
+ * 开启变更跟踪时, 每个合约在被主线程取走前最多只记录一次变更
+ */
+class SnapshotTable {
+ public:
+  /**
+   * @param capacity 可容纳的合约数
+   * @param track_changes 是否记录发生变更的合约
+   */
+  SnapshotTable(uint32_t capacity, bool track_changes)
+      : track_changes_(track_changes), size_(0), overflow_(0) {
+    /* 保持装载率不超过50%, 缩短探测距离 */
+    uint32_t n = 2;
+    while (n < capacity * 2 && n < (1u << 30)) {
+      n <<= 1;
+    }
+    capacity_ = capacity;
+    mask_ = n - 1;
+    slots_ = new Slot[n];
+    changed_ = new SpscQueue<uint32_t>(n, OVERFLOW_BLOCK);
+  }
+
+  ~SnapshotTable() {
+    delete changed_;
+    delete[] slots_;
+  }
+
+  SnapshotTable(const SnapshotTable &) = delete;
+  SnapshotTable &operator=(const SnapshotTable &) = delete;
+
+  /**
+   * 写入一条深度行情, 仅可在SPI线程中调用
+   * @return 需要唤醒主线程处理变更时返回true
+   */
+  bool Update(const CThostFtdcDepthMarketDataField *data) {
+    int64_t index = Find(data->InstrumentID, true);
+    if (index < 0) {
+      overflow_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    Slot &slot = slots_[index];
+    bool inserted = !slot.used.load(std::memory_order_relaxed);
+
+    uint32_t seq = slot.seq.load(std::memory_order_relaxed);
+    slot.seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&slot.data, data, sizeof(slot.data));
+    slot.seq.store(seq + 2, std::memory_order_release);
+
+    if (inserted) {
+      /* 快照写入完成后才对读取者可见 */
+      slot.used.store(1, std::memory_order_release);
+      size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (track_changes_ &&
+        !slot.pending.exchange(1, std::memory_order_acq_rel)) {
+      uint32_t dropped;
+      changed_->Push(static_cast<uint32_t>(index), dropped);
+      return true;
+    }
+    return false;
+  }
+
+  /**
+   * 按合约代码读取快照, 可在任意线程中调用
+   * @return 合约不存在时返回false
+   */
+  bool Get(const char *instrument_id,
+           CThostFtdcDepthMarketDataField &out) const {
+    int64_t index = Find(instrument_id, false);
+    return index >= 0 && Get(static_cast<uint32_t>(index), out);
+  }
+
+  /**
+   * 按槽位号读取快照, 可在任意线程中调用
+   * @return 槽位未使用时返回false
+   */
+  bool Get(uint32_t index, CThostFtdcDepthMarketDataField &out) const {
+    const Slot &slot = slots_[index & mask_];
+    if (!slot.used.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    for (;;) {
+      uint32_t begin = slot.seq.load(std::memory_order_acquire);
+      if (begin & 1) {
+        std::this_thread::yield();
+        continue;
+      }
+      memcpy(&out, &slot.data, sizeof(out));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.seq.load(std::memory_order_relaxed) == begin) {
+        return true;
+      }
+    }
+  }
+
+  /**
+   * 取出一个发生变更的槽位号, 仅可在主线程中调用
+   * @remark 取出后该合约的下一次变更会被重新记录
+   */
+  bool PopChanged(uint32_t &index) {
+    if (!changed_->TryPop(index)) {
+      return false;
+    }
+    slots_[index].pending.store(0, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * 槽位总数, 用于遍历全部快照
+   */
+  uint32_t Slots() const { return mask_ + 1; }
+
+  uint32_t Size() const { return size_.load(std::memory_order_relaxed); }
+
+  uint32_t Capacity() const { return capacity_; }
+
+  /**
+   * 表满而未能记录的行情数
+   */
+  uint64_t Overflow() const {
+    return overflow_.load(std::memory_order_relaxed);
+  }
+
+  bool TrackChanges() const { return track_changes_; }
+
+ private:
+  struct Slot {
+    Slot() : used(0), seq(0), pending(0) {
+      memset(key, 0x0, sizeof(key));
+      memset(&data, 0x0, sizeof(data));
+    }
+
+    /* 槽位已写入合约, 写入后不再改变 */
+    atomic<uint32_t> used;
+
+    /* 序号锁, 奇数表示正在写入 */
+    atomic<uint32_t> seq;
+
+    /* 变更已记录且尚未被主线程取走 */
+    atomic<uint32_t> pending;
+
+    TThostFtdcInstrumentIDType key;
+    CThostFtdcDepthMarketDataField data;
+  };
+
+  static uint32_t Hash(const char *key) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (; *key; ++key) {
+      hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+  }
+
+  /**
+   * 查找合约所在槽位
+   * @param insert 未找到时是否占用空槽位, 仅写入者可为true
+   * @return 槽位号, 未找到或表满时返回-1
+   */
+  int64_t Find(const char *instrument_id, bool insert) const {
+    TThostFtdcInstrumentIDType key;
+    strncpy(key, instrument_id, sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+
+    uint32_t index = Hash(key) & mask_;
+    for (uint32_t i = 0; i <= mask_; ++i, index = (index + 1) & mask_) {
+      Slot &slot = slots_[index];
+      if (slot.used.load(std::memory_order_acquire)) {
+        if (strcmp(slot.key, key) == 0) {
+          return index;
+        }
+        continue;
+      }
+
+      if (!insert || size_.load(std::memory_order_relaxed) >= capacity_) {
+        return -1;
+      }
+
+      /* 只有写入者会占用槽位, 合约代码在快照对读取者可见前写入 */
+      memcpy(slot.key, key, sizeof(key));
+      return index;
+    }
+    return -1;
+  }
+
+ private:
+  Slot *slots_;
+  uint32_t capacity_;
+  uint32_t mask_;
+  bool track_changes_;
+  atomic<uint32_t> size_;
+  atomic<uint64_t> overflow_;
+
+  /* 发生变更的槽位号, SPI线程写入, 主线程读取 */
+  SpscQueue<uint32_t> *changed_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* SNAPSHOT_TABLE_H */
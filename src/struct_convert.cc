@@ -0,0 +1,14428 @@
+#include "struct_convert.h"
+#include <cfloat>
+#include <limits>
+#include "gbk.h"
+
+/* 此文件中代码使用misc/code_creater生成, 不要手动修改 */
+
+namespace node_ctp {
+
+using namespace v8;
+
+/* 属性名->字符串 */
+static const char *kObjectKeyNames[KEY_COUNT] = {
+    "AbandonFrozen",
+    "Abstract",
+    "AccountID",
+    "ActionDate",
+    "ActionDay",
+    "ActionFlag",
+    "ActionLocalID",
+    "ActionStatus",
+    "ActionTime",
+    "ActionType",
+    "ActiveTime",
+    "ActiveTraderID",
+    "ActiveUserID",
+    "Address",
+    "Algorithm",
+    "AllWithoutTrade",
+    "AShortMarginRatioByMoney",
+    "AShortMarginRatioByVolume",
+    "AskHedgeFlag",
+    "AskOffsetFlag",
+    "AskOrderRef",
+    "AskOrderSysID",
+    "AskPrice",
+    "AskPrice1",
+    "AskPrice2",
+    "AskPrice3",
+    "AskPrice4",
+    "AskPrice5",
+    "AskVolume",
+    "AskVolume1",
+    "AskVolume2",
+    "AskVolume3",
+    "AskVolume4",
+    "AskVolume5",
+    "AuthCode",
+    "AuthInfo",
+    "AuthKey",
+    "AvailabilityFlag",
+    "Available",
+    "AvailIncludeCloseProfit",
+    "AveragePrice",
+    "Balance",
+    "BalanceAlgorithm",
+    "BankAccount",
+    "BankAccType",
+    "BankBranchID",
+    "BankBrchID",
+    "BankFetchAmount",
+    "BankID",
+    "BankName",
+    "BankNewAccount",
+    "BankPassWord",
+    "BankPwdFlag",
+    "BankRepealFlag",
+    "BankRepealSerial",
+    "BankSecuAcc",
+    "BankSecuAccType",
+    "BankSerial",
+    "BankUseAmount",
+    "BidHedgeFlag",
+    "BidOffsetFlag",
+    "BidOrderRef",
+    "BidOrderSysID",
+    "BidPrice",
+    "BidPrice1",
+    "BidPrice2",
+    "BidPrice3",
+    "BidPrice4",
+    "BidPrice5",
+    "BidVolume",
+    "BidVolume1",
+    "BidVolume2",
+    "BidVolume3",
+    "BidVolume4",
+    "BidVolume5",
+    "BizType",
+    "BranchID",
+    "BrokerAbbr",
+    "BrokerBranchID",
+    "BrokerExecOrderSeq",
+    "BrokerFee",
+    "BrokerForQutoSeq",
+    "BrokerFunctionCode",
+    "BrokerID",
+    "BrokerIDByBank",
+    "BrokerLockSeq",
+    "BrokerName",
+    "BrokerOrderSeq",
+    "BrokerQuoteSeq",
+    "BrokerRepealFlag",
+    "BrokerSecAgentID",
+    "BulletinID",
+    "BusinessUnit",
+    "CancelTime",
+    "CashExchangeCode",
+    "CashIn",
+    "CertCode",
+    "ClearingPartID",
+    "ClientID",
+    "ClientIDType",
+    "ClientIPAddress",
+    "CloseAmount",
+    "CloseDealType",
+    "CloseFlag",
+    "ClosePrice",
+    "CloseProfit",
+    "CloseProfitByDate",
+    "CloseProfitByTrade",
+    "CloseRatioByMoney",
+    "CloseRatioByVolume",
+    "CloseTodayRatioByMoney",
+    "CloseTodayRatioByVolume",
+    "CloseVolume",
+    "CombinationType",
+    "CombActionRef",
+    "CombDirection",
+    "CombHedgeFlag",
+    "CombInstrumentID",
+    "CombLongFrozen",
+    "CombOffsetFlag",
+    "CombPosition",
+    "CombShortFrozen",
+    "ComeFrom",
+    "Commission",
+    "CommModelID",
+    "CommModelName",
+    "CommPhaseNo",
+    "ComTradeID",
+    "ConfirmDate",
+    "ConfirmTime",
+    "ConnectDate",
+    "ConnectRequestDate",
+    "ConnectRequestTime",
+    "ConnectTime",
+    "Content",
+    "ContingentCondition",
+    "CountryCode",
+    "CreateDate",
+    "CreateTime",
+    "Credit",
+    "CurrencyCode",
+    "CurrencyID",
+    "CurrentKey",
+    "CurrDate",
+    "CurrDelta",
+    "CurrMargin",
+    "CurrMillisec",
+    "CurrTime",
+    "CustomerName",
+    "CustFee",
+    "CustType",
+    "CZCETime",
+    "DataSyncStatus",
+    "DBFComdType",
+    "DBFComNo",
+    "DBFComTime",
+    "DBFFdContent1",
+    "DBFFdContent2",
+    "DBFFdContent3",
+    "DBFFdContent4",
+    "DBFFdName1",
+    "DBFFdName2",
+    "DBFFdName3",
+    "DBFFdName4",
+    "DBFOComNo",
+    "DCETime",
+    "DeliveryMargin",
+    "DeliveryMonth",
+    "DeliveryYear",
+    "Delta",
+    "Deposit",
+    "DepositSeqNo",
+    "DescrInfoForReturnCode",
+    "DesignateLocalID",
+    "DesignateRef",
+    "DesignateStatus",
+    "DesignateType",
+    "DestBrokerID",
+    "DestDRIdentityID",
+    "DeviceID",
+    "Digest",
+    "Direction",
+    "Discount",
+    "DRIdentityID",
+    "EMail",
+    "EndDelivDate",
+    "EnterReason",
+    "EnterTime",
+    "ErrorID",
+    "ErrorMsg",
+    "EventDate",
+    "EventSequenceNo",
+    "EventTime",
+    "ExchangeDeliveryMargin",
+    "ExchangeID",
+    "ExchangeInstID",
+    "ExchangeMargin",
+    "ExchangeName",
+    "ExchangeProductID",
+    "ExchangeProperty",
+    "ExchangeRate",
+    "ExchFixedMargin",
+    "ExchLongMarginRatioByMoney",
+    "ExchLongMarginRatioByVolume",
+    "ExchMargin",
+    "ExchMiniMargin",
+    "ExchOffsetAmount",
+    "ExchShortMarginRatioByMoney",
+    "ExchShortMarginRatioByVolume",
+    "ExecOrderActionRef",
+    "ExecOrderLocalID",
+    "ExecOrderRef",
+    "ExecOrderSysID",
+    "ExecResult",
+    "ExpireDate",
+    "Fax",
+    "FeePayFlag",
+    "FetchAmt",
+    "FFEXTime",
+    "FieldContent",
+    "FileBusinessCode",
+    "FindMarginRateAlgoID",
+    "FirstOTP",
+    "FixedMargin",
+    "Flag",
+    "ForceCloseReason",
+    "ForQuoteLocalID",
+    "ForQuoteRef",
+    "ForQuoteStatus",
+    "ForQuoteSysID",
+    "ForQuoteTime",
+    "FreezeReasonType",
+    "FreezeType",
+    "FromCurrencyID",
+    "FromCurrencyUnit",
+    "FrontID",
+    "FrozenAmount",
+    "FrozenCash",
+    "FrozenCommission",
+    "FrozenMargin",
+    "FrozenVolume",
+    "FunctionCode",
+    "FundMortgageAvailable",
+    "FundMortgageIn",
+    "FundMortgageOut",
+    "FundMortgageRatio",
+    "FutureAccount",
+    "FutureAccPwd",
+    "FutureAccType",
+    "FutureFetchAmount",
+    "FutureID",
+    "FuturePwdFlag",
+    "FutureRepealSerial",
+    "FutureSerial",
+    "Gender",
+    "GroupIP",
+    "GroupPort",
+    "GTDDate",
+    "GuarantRatio",
+    "HandlePositionAlgoID",
+    "HandleTradingAccountAlgoID",
+    "HedgeFlag",
+    "HighestPrice",
+    "HShortMarginRatioByMoney",
+    "HShortMarginRatioByVolume",
+    "IdentifiedCardNo",
+    "IdentifiedCardType",
+    "IdentityID",
+    "IdCardType",
+    "ImplyLevel",
+    "IncludeCloseProfit",
+    "INETime",
+    "InputPrice",
+    "InsertDate",
+    "InsertTime",
+    "InsertTimeEnd",
+    "InsertTimeStart",
+    "InstallCount",
+    "InstallID",
+    "InstructionRight",
+    "InstrumentCode",
+    "InstrumentID",
+    "InstrumentName",
+    "InstrumentStatus",
+    "InstLifePhase",
+    "Interest",
+    "InterestBase",
+    "InterfaceProductInfo",
+    "InvestorGroupID",
+    "InvestorGroupName",
+    "InvestorID",
+    "InvestorName",
+    "InvestorRange",
+    "InvestUnitID",
+    "IPAddress",
+    "IPMask",
+    "IsActive",
+    "IsAutoSuspend",
+    "IsBrokerUserEvent",
+    "IsForbidden",
+    "IsForce",
+    "IsRelative",
+    "IsResult",
+    "IsSwapOrder",
+    "IsTrading",
+    "IsUsingOTP",
+    "KeyID",
+    "KeyKind",
+    "LastDrift",
+    "LastFragment",
+    "LastPrice",
+    "LastReportDate",
+    "LastReportTime",
+    "LastSettlementPrice",
+    "LastSuccess",
+    "LegID",
+    "LegInstrumentID",
+    "LegMultiple",
+    "LevelType",
+    "LimitPrice",
+    "LockLocalID",
+    "LockRef",
+    "LockStatus",
+    "LockSysID",
+    "LockType",
+    "LoginDate",
+    "LoginMode",
+    "LoginRemark",
+    "LoginTime",
+    "LongAmount",
+    "LongAmountFrozen",
+    "LongExchMargin",
+    "LongExchOffsetAmount",
+    "LongFrozen",
+    "LongFrozenAmount",
+    "LongFrozenMargin",
+    "LongMarginRatio",
+    "LongMarginRatioByMoney",
+    "LongMarginRatioByVolume",
+    "LongOffsetAmount",
+    "LongUseMargin",
+    "LongVolume",
+    "LongVolumeFrozen",
+    "LowerLimitPrice",
+    "LowestPrice",
+    "MacAddress",
+    "MacKey",
+    "Margin",
+    "MarginModelID",
+    "MarginModelName",
+    "MarginPriceType",
+    "MarginRateByMoney",
+    "MarginRateByVolume",
+    "MarketID",
+    "MarketStatus",
+    "MaxLimitOrderVolume",
+    "MaxMarginSideAlgorithm",
+    "MaxMarketOrderVolume",
+    "MaxOrderMessageReference",
+    "MaxOrderRef",
+    "MaxTradeID",
+    "MaxVolume",
+    "Memo",
+    "Message",
+    "MiniMargin",
+    "MinBuyVolume",
+    "MinLimitOrderVolume",
+    "MinMargin",
+    "MinMarketOrderVolume",
+    "MinSellVolume",
+    "MinVolume",
+    "Mobile",
+    "MobilePhone",
+    "MoneyAccountStatus",
+    "Mortgage",
+    "MortgageableFund",
+    "MortgageAmount",
+    "MortgageFundUseRange",
+    "MortgageSeqNo",
+    "MShortMarginRatioByMoney",
+    "MShortMarginRatioByVolume",
+    "NewsType",
+    "NewsUrgency",
+    "NewBankAccount",
+    "NewBankPassWord",
+    "NewPassword",
+    "NotifySequence",
+    "NoLongMarginRatioByMoney",
+    "NoLongMarginRatioByVolume",
+    "NoShortMarginRatioByMoney",
+    "NoShortMarginRatioByVolume",
+    "Offset",
+    "OffsetAmount",
+    "OffsetFlag",
+    "OffsetType",
+    "OldPassword",
+    "OneTimePassword",
+    "OpenAmount",
+    "OpenCost",
+    "OpenDate",
+    "OpenInterest",
+    "OpenOrDestroy",
+    "OpenPrice",
+    "OpenRatioByMoney",
+    "OpenRatioByVolume",
+    "OpenVolume",
+    "OpenVolumeFrozen",
+    "OperatorCode",
+    "OperNo",
+    "OptionsType",
+    "OptionRoyaltyPriceType",
+    "OrderActionCommByVolume",
+    "OrderActionRef",
+    "OrderActionStatus",
+    "OrderCommByVolume",
+    "OrderLocalID",
+    "OrderPriceType",
+    "OrderRef",
+    "OrderSource",
+    "OrderStatus",
+    "OrderSubmitStatus",
+    "OrderSysID",
+    "OrderType",
+    "OriginDescrInfoForReturnCode",
+    "OriginReturnCode",
+    "OrigBrokerID",
+    "OrigDRIdentityID",
+    "OTPType",
+    "OTPVendorsID",
+    "OutDate",
+    "ParkedOrderActionID",
+    "ParkedOrderID",
+    "ParticipantID",
+    "Password",
+    "PersonFullName",
+    "PersonName",
+    "PersonType",
+    "PinKey",
+    "PlateRepealSerial",
+    "PlateSerial",
+    "Position",
+    "PositionCost",
+    "PositionDate",
+    "PositionDateType",
+    "PositionProfit",
+    "PositionProfitByDate",
+    "PositionProfitByTrade",
+    "PositionType",
+    "PosiDirection",
+    "PreBalance",
+    "PreClosePrice",
+    "PreCredit",
+    "PreDelta",
+    "PreDeposit",
+    "PreFundMortgageIn",
+    "PreFundMortgageOut",
+    "PreMargin",
+    "PreMortgage",
+    "PreOpenInterest",
+    "PreSettlementPrice",
+    "Price",
+    "PriceInterval",
+    "PriceSource",
+    "PriceTick",
+    "Priority",
+    "ProductClass",
+    "ProductGroupID",
+    "ProductID",
+    "ProductName",
+    "ProtocolInfo",
+    "QuoteActionRef",
+    "QuoteCurrencyID",
+    "QuoteLocalID",
+    "QuoteRef",
+    "QuoteStatus",
+    "QuoteSysID",
+    "RecordNum",
+    "Reference",
+    "RefrenceIssure",
+    "RefrenceIssureType",
+    "RegDate",
+    "RelativeOrderSysID",
+    "RepealedTimes",
+    "RepealTimeInterval",
+    "RequestID",
+    "Reserve",
+    "ReserveBalance",
+    "ReservePositionFlag",
+    "ReturnCode",
+    "RetCode",
+    "RetInfo",
+    "Royalty",
+    "SecondOTP",
+    "SecuPwdFlag",
+    "SendTime",
+    "SequenceLabel",
+    "SequenceNo",
+    "SequenceSeries",
+    "SerialNumber",
+    "SessionID",
+    "SettlementGroupID",
+    "SettlementID",
+    "SettlementPrice",
+    "SHFETime",
+    "ShortExchMargin",
+    "ShortExchOffsetAmount",
+    "ShortFrozen",
+    "ShortFrozenAmount",
+    "ShortFrozenMargin",
+    "ShortMarginRatio",
+    "ShortMarginRatioByMoney",
+    "ShortMarginRatioByVolume",
+    "ShortOffsetAmount",
+    "ShortUseMargin",
+    "SourceIP",
+    "SpecProductCloseProfit",
+    "SpecProductCommission",
+    "SpecProductExchangeMargin",
+    "SpecProductFrozenCommission",
+    "SpecProductFrozenMargin",
+    "SpecProductMargin",
+    "SpecProductPositionProfit",
+    "SpecProductPositionProfitByAlg",
+    "SShortMarginRatioByMoney",
+    "SShortMarginRatioByVolume",
+    "StartDate",
+    "StartDelivDate",
+    "StartTime",
+    "Status",
+    "StatusMsg",
+    "StockDisposalActionRef",
+    "StockDisposalLocalID",
+    "StockDisposalRef",
+    "StockDisposalStatus",
+    "StockDisposalSysID",
+    "StockDisposalType",
+    "StopPrice",
+    "StrikeFrozen",
+    "StrikeFrozenAmount",
+    "StrikePrice",
+    "StrikeRatioByMoney",
+    "StrikeRatioByVolume",
+    "SuspendTime",
+    "SystemID",
+    "SystemName",
+    "Telephone",
+    "TID",
+    "TimeCondition",
+    "TodayPosition",
+    "Token",
+    "TotalAmt",
+    "TotalVolume",
+    "TotalVolumeFrozen",
+    "ToCurrencyID",
+    "Tradeable",
+    "TraderConnectStatus",
+    "TraderID",
+    "TradeAmount",
+    "TradeAmt",
+    "TradeCode",
+    "TradeCurrencyID",
+    "TradeDate",
+    "TradeDay",
+    "TradeGroupID",
+    "TradeID",
+    "TradeSerial",
+    "TradeSource",
+    "TradeTime",
+    "TradeTimeEnd",
+    "TradeTimeStart",
+    "TradeType",
+    "TradingDay",
+    "TradingRight",
+    "TradingRole",
+    "TradingSegmentSN",
+    "TransferStatus",
+    "Turnover",
+    "TxAmount",
+    "UnderlyingInstrID",
+    "UnderlyingMultiple",
+    "UnderlyingPrice",
+    "UOAZipCode",
+    "UpdateMillisec",
+    "UpdateTime",
+    "UpperLimitPrice",
+    "URLLink",
+    "UserEventInfo",
+    "UserEventType",
+    "UserForceClose",
+    "UserID",
+    "UserName",
+    "UserProductInfo",
+    "UserRightType",
+    "UserType",
+    "UseAmt",
+    "UseMargin",
+    "UsingRatio",
+    "ValueMethod",
+    "VerifyCertNoFlag",
+    "Version",
+    "Volume",
+    "VolumeChange",
+    "VolumeCondition",
+    "VolumeMultiple",
+    "VolumeTotal",
+    "VolumeTotalOriginal",
+    "VolumeTraded",
+    "Withdraw",
+    "WithdrawAlgorithm",
+    "WithdrawQuota",
+    "YdPosition",
+    "YdStrikeFrozen",
+    "ZCETotalTradedVolume",
+    "ZipCode",
+};
+
+/* 常用字段的字符串驻留表, 每个线程一份, 默认可驻留8192个字符串 */
+static thread_local StringInternTable intern_table_(8192);
+
+/* 常驻的属性名字符串, 每个线程(Isolate)一份 */
+static thread_local Persistent<String> object_keys_[KEY_COUNT];
+
+void InitObjectKeys(Isolate *isolate) {
+  for (int i = 0; i < KEY_COUNT; ++i) {
+    object_keys_[i].Reset(
+        isolate, String::NewFromUtf8(isolate, kObjectKeyNames[i],
+                                     NewStringType::kInternalized)
+                     .ToLocalChecked());
+  }
+}
+
+void ReleaseObjectKeys() {
+  for (int i = 0; i < KEY_COUNT; ++i) {
+    object_keys_[i].Reset();
+  }
+  intern_table_.Reset(intern_table_.Stats().capacity);
+}
+
+Local<String> GetObjectKey(Isolate *isolate, ObjectKey key) {
+  return Local<String>::New(isolate, object_keys_[key]);
+}
+
+/* 字符串字段的最大长度 */
+static const size_t kMaxStringSize = 1025;
+
+
+StringInternTable &GetInternTable() { return intern_table_; }
+
+const char *GetObjectKeyName(ObjectKey key) { return kObjectKeyNames[key]; }
+
+/**
+ * 字符串字段按GBK解码, 只包含ASCII字符时直接创建单字节字符串
+ * @param size 字段长度
+ * @param intern 是否使用驻留表, 只对ASCII字符串生效
+ */
+static inline Local<String> NewNodeString(Isolate *isolate, const char *value,
+                                          size_t size, bool intern) {
+  size_t len = 0;
+  if (!IsAsciiString(value, size, len)) {
+    uint16_t buffer[kMaxStringSize];
+    return String::NewFromTwoByte(isolate, buffer, NewStringType::kNormal,
+                                  DecodeGbk(value, len, buffer))
+        .ToLocalChecked();
+  }
+  if (intern) {
+    return intern_table_.Get(isolate, value, len);
+  }
+  return String::NewFromOneByte(isolate,
+                                reinterpret_cast<const uint8_t *>(value),
+                                NewStringType::kNormal, len)
+      .ToLocalChecked();
+}
+
+template <size_t N>
+static inline void SetNodeObjectString(Isolate *isolate, Local<Object> obj,
+                                       ObjectKey key, const char (&value)[N]) {
+  static_assert(N <= kMaxStringSize, "String field too long");
+  obj->Set(GetObjectKey(isolate, key),
+           NewNodeString(isolate, value, N, false));
+}
+
+/**
+ * 取值有限的字段(合约代码, 交易所代码, 日期等)复用驻留的字符串
+ */
+template <size_t N>
+static inline void SetNodeObjectInternedString(Isolate *isolate,
+                                               Local<Object> obj,
+                                               ObjectKey key,
+                                               const char (&value)[N]) {
+  static_assert(N <= kMaxStringSize, "String field too long");
+  obj->Set(GetObjectKey(isolate, key), NewNodeString(isolate, value, N, true));
+}
+
+static inline void SetNodeObjectChar(Isolate *isolate, Local<Object> obj,
+                                     ObjectKey key, char value) {
+  obj->Set(GetObjectKey(isolate, key),
+           String::NewFromOneByte(isolate,
+                                  reinterpret_cast<const uint8_t *>(&value),
+                                  NewStringType::kNormal, value ? 1 : 0)
+               .ToLocalChecked());
+}
+
+static inline void SetNodeObjectInt(Isolate *isolate, Local<Object> obj,
+                                    ObjectKey key, int value) {
+  obj->Set(GetObjectKey(isolate, key), Integer::New(isolate, value));
+}
+
+static inline void SetNodeObjectDouble(Isolate *isolate, Local<Object> obj,
+                                       ObjectKey key, double value) {
+  obj->Set(GetObjectKey(isolate, key), Number::New(isolate, value));
+}
+
+template <typename T, size_t N>
+static inline size_t ArraySize(const T (&)[N]) {
+  return N;
+}
+
+Local<Object> NewNodeObject(Isolate *isolate, const void *data,
+                            const FieldInfo *fields, size_t count,
+                            InvalidDoubleMode invalid) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  const char *base = static_cast<const char *>(data);
+  for (size_t i = 0; i < count; ++i) {
+    const FieldInfo &field = fields[i];
+    const char *value = base + field.offset;
+    switch (field.type) {
+      case FIELD_STRING:
+      case FIELD_INTERNED_STRING: {
+        obj->Set(GetObjectKey(isolate, field.key),
+                 NewNodeString(isolate, value, field.size,
+                               field.type == FIELD_INTERNED_STRING));
+        break;
+      }
+      case FIELD_CHAR: {
+        SetNodeObjectChar(isolate, obj, field.key, *value);
+        break;
+      }
+      case FIELD_INT: {
+        int number;
+        memcpy(&number, value, sizeof(number));
+        SetNodeObjectInt(isolate, obj, field.key, number);
+        break;
+      }
+      case FIELD_DOUBLE: {
+        double number;
+        memcpy(&number, value, sizeof(number));
+        if (number == DBL_MAX && invalid != INVALID_DOUBLE_KEEP) {
+          if (invalid == INVALID_DOUBLE_SKIP) {
+            break;
+          }
+          number = std::numeric_limits<double>::quiet_NaN();
+        }
+        SetNodeObjectDouble(isolate, obj, field.key, number);
+        break;
+      }
+    }
+  }
+  return obj;
+}
+
+static const FieldInfo kDepthMarketDataFields[] = {
+    {KEY_TRADING_DAY, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, TradingDay),
+     sizeof(CThostFtdcDepthMarketDataField::TradingDay)},
+    {KEY_INSTRUMENT_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, InstrumentID),
+     sizeof(CThostFtdcDepthMarketDataField::InstrumentID)},
+    {KEY_EXCHANGE_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, ExchangeID),
+     sizeof(CThostFtdcDepthMarketDataField::ExchangeID)},
+    {KEY_EXCHANGE_INST_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, ExchangeInstID),
+     sizeof(CThostFtdcDepthMarketDataField::ExchangeInstID)},
+    {KEY_LAST_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, LastPrice),
+     sizeof(CThostFtdcDepthMarketDataField::LastPrice)},
+    {KEY_PRE_SETTLEMENT_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, PreSettlementPrice),
+     sizeof(CThostFtdcDepthMarketDataField::PreSettlementPrice)},
+    {KEY_PRE_CLOSE_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, PreClosePrice),
+     sizeof(CThostFtdcDepthMarketDataField::PreClosePrice)},
+    {KEY_PRE_OPEN_INTEREST, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, PreOpenInterest),
+     sizeof(CThostFtdcDepthMarketDataField::PreOpenInterest)},
+    {KEY_OPEN_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, OpenPrice),
+     sizeof(CThostFtdcDepthMarketDataField::OpenPrice)},
+    {KEY_HIGHEST_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, HighestPrice),
+     sizeof(CThostFtdcDepthMarketDataField::HighestPrice)},
+    {KEY_LOWEST_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, LowestPrice),
+     sizeof(CThostFtdcDepthMarketDataField::LowestPrice)},
+    {KEY_VOLUME, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, Volume),
+     sizeof(CThostFtdcDepthMarketDataField::Volume)},
+    {KEY_TURNOVER, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, Turnover),
+     sizeof(CThostFtdcDepthMarketDataField::Turnover)},
+    {KEY_OPEN_INTEREST, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, OpenInterest),
+     sizeof(CThostFtdcDepthMarketDataField::OpenInterest)},
+    {KEY_CLOSE_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, ClosePrice),
+     sizeof(CThostFtdcDepthMarketDataField::ClosePrice)},
+    {KEY_SETTLEMENT_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, SettlementPrice),
+     sizeof(CThostFtdcDepthMarketDataField::SettlementPrice)},
+    {KEY_UPPER_LIMIT_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, UpperLimitPrice),
+     sizeof(CThostFtdcDepthMarketDataField::UpperLimitPrice)},
+    {KEY_LOWER_LIMIT_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, LowerLimitPrice),
+     sizeof(CThostFtdcDepthMarketDataField::LowerLimitPrice)},
+    {KEY_PRE_DELTA, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, PreDelta),
+     sizeof(CThostFtdcDepthMarketDataField::PreDelta)},
+    {KEY_CURR_DELTA, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, CurrDelta),
+     sizeof(CThostFtdcDepthMarketDataField::CurrDelta)},
+    {KEY_UPDATE_TIME, FIELD_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, UpdateTime),
+     sizeof(CThostFtdcDepthMarketDataField::UpdateTime)},
+    {KEY_UPDATE_MILLISEC, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, UpdateMillisec),
+     sizeof(CThostFtdcDepthMarketDataField::UpdateMillisec)},
+    {KEY_BID_PRICE1, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, BidPrice1),
+     sizeof(CThostFtdcDepthMarketDataField::BidPrice1)},
+    {KEY_BID_VOLUME1, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, BidVolume1),
+     sizeof(CThostFtdcDepthMarketDataField::BidVolume1)},
+    {KEY_ASK_PRICE1, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AskPrice1),
+     sizeof(CThostFtdcDepthMarketDataField::AskPrice1)},
+    {KEY_ASK_VOLUME1, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, AskVolume1),
+     sizeof(CThostFtdcDepthMarketDataField::AskVolume1)},
+    {KEY_BID_PRICE2, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, BidPrice2),
+     sizeof(CThostFtdcDepthMarketDataField::BidPrice2)},
+    {KEY_BID_VOLUME2, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, BidVolume2),
+     sizeof(CThostFtdcDepthMarketDataField::BidVolume2)},
+    {KEY_ASK_PRICE2, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AskPrice2),
+     sizeof(CThostFtdcDepthMarketDataField::AskPrice2)},
+    {KEY_ASK_VOLUME2, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, AskVolume2),
+     sizeof(CThostFtdcDepthMarketDataField::AskVolume2)},
+    {KEY_BID_PRICE3, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, BidPrice3),
+     sizeof(CThostFtdcDepthMarketDataField::BidPrice3)},
+    {KEY_BID_VOLUME3, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, BidVolume3),
+     sizeof(CThostFtdcDepthMarketDataField::BidVolume3)},
+    {KEY_ASK_PRICE3, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AskPrice3),
+     sizeof(CThostFtdcDepthMarketDataField::AskPrice3)},
+    {KEY_ASK_VOLUME3, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, AskVolume3),
+     sizeof(CThostFtdcDepthMarketDataField::AskVolume3)},
+    {KEY_BID_PRICE4, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, BidPrice4),
+     sizeof(CThostFtdcDepthMarketDataField::BidPrice4)},
+    {KEY_BID_VOLUME4, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, BidVolume4),
+     sizeof(CThostFtdcDepthMarketDataField::BidVolume4)},
+    {KEY_ASK_PRICE4, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AskPrice4),
+     sizeof(CThostFtdcDepthMarketDataField::AskPrice4)},
+    {KEY_ASK_VOLUME4, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, AskVolume4),
+     sizeof(CThostFtdcDepthMarketDataField::AskVolume4)},
+    {KEY_BID_PRICE5, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, BidPrice5),
+     sizeof(CThostFtdcDepthMarketDataField::BidPrice5)},
+    {KEY_BID_VOLUME5, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, BidVolume5),
+     sizeof(CThostFtdcDepthMarketDataField::BidVolume5)},
+    {KEY_ASK_PRICE5, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AskPrice5),
+     sizeof(CThostFtdcDepthMarketDataField::AskPrice5)},
+    {KEY_ASK_VOLUME5, FIELD_INT,
+     offsetof(CThostFtdcDepthMarketDataField, AskVolume5),
+     sizeof(CThostFtdcDepthMarketDataField::AskVolume5)},
+    {KEY_AVERAGE_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcDepthMarketDataField, AveragePrice),
+     sizeof(CThostFtdcDepthMarketDataField::AveragePrice)},
+    {KEY_ACTION_DAY, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcDepthMarketDataField, ActionDay),
+     sizeof(CThostFtdcDepthMarketDataField::ActionDay)},
+};
+
+FieldTable GetFieldTable(const CThostFtdcDepthMarketDataField *) {
+  return {kDepthMarketDataFields, ArraySize(kDepthMarketDataFields)};
+}
+
+static const FieldInfo kOrderFields[] = {
+    {KEY_BROKER_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, BrokerID),
+     sizeof(CThostFtdcOrderField::BrokerID)},
+    {KEY_INVESTOR_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, InvestorID),
+     sizeof(CThostFtdcOrderField::InvestorID)},
+    {KEY_INSTRUMENT_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, InstrumentID),
+     sizeof(CThostFtdcOrderField::InstrumentID)},
+    {KEY_ORDER_REF, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, OrderRef),
+     sizeof(CThostFtdcOrderField::OrderRef)},
+    {KEY_USER_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, UserID),
+     sizeof(CThostFtdcOrderField::UserID)},
+    {KEY_ORDER_PRICE_TYPE, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, OrderPriceType),
+     sizeof(CThostFtdcOrderField::OrderPriceType)},
+    {KEY_DIRECTION, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, Direction),
+     sizeof(CThostFtdcOrderField::Direction)},
+    {KEY_COMB_OFFSET_FLAG, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, CombOffsetFlag),
+     sizeof(CThostFtdcOrderField::CombOffsetFlag)},
+    {KEY_COMB_HEDGE_FLAG, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, CombHedgeFlag),
+     sizeof(CThostFtdcOrderField::CombHedgeFlag)},
+    {KEY_LIMIT_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcOrderField, LimitPrice),
+     sizeof(CThostFtdcOrderField::LimitPrice)},
+    {KEY_VOLUME_TOTAL_ORIGINAL, FIELD_INT,
+     offsetof(CThostFtdcOrderField, VolumeTotalOriginal),
+     sizeof(CThostFtdcOrderField::VolumeTotalOriginal)},
+    {KEY_TIME_CONDITION, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, TimeCondition),
+     sizeof(CThostFtdcOrderField::TimeCondition)},
+    {KEY_GTDDATE, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, GTDDate),
+     sizeof(CThostFtdcOrderField::GTDDate)},
+    {KEY_VOLUME_CONDITION, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, VolumeCondition),
+     sizeof(CThostFtdcOrderField::VolumeCondition)},
+    {KEY_MIN_VOLUME, FIELD_INT,
+     offsetof(CThostFtdcOrderField, MinVolume),
+     sizeof(CThostFtdcOrderField::MinVolume)},
+    {KEY_CONTINGENT_CONDITION, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, ContingentCondition),
+     sizeof(CThostFtdcOrderField::ContingentCondition)},
+    {KEY_STOP_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcOrderField, StopPrice),
+     sizeof(CThostFtdcOrderField::StopPrice)},
+    {KEY_FORCE_CLOSE_REASON, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, ForceCloseReason),
+     sizeof(CThostFtdcOrderField::ForceCloseReason)},
+    {KEY_IS_AUTO_SUSPEND, FIELD_INT,
+     offsetof(CThostFtdcOrderField, IsAutoSuspend),
+     sizeof(CThostFtdcOrderField::IsAutoSuspend)},
+    {KEY_BUSINESS_UNIT, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, BusinessUnit),
+     sizeof(CThostFtdcOrderField::BusinessUnit)},
+    {KEY_REQUEST_ID, FIELD_INT,
+     offsetof(CThostFtdcOrderField, RequestID),
+     sizeof(CThostFtdcOrderField::RequestID)},
+    {KEY_ORDER_LOCAL_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, OrderLocalID),
+     sizeof(CThostFtdcOrderField::OrderLocalID)},
+    {KEY_EXCHANGE_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, ExchangeID),
+     sizeof(CThostFtdcOrderField::ExchangeID)},
+    {KEY_PARTICIPANT_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ParticipantID),
+     sizeof(CThostFtdcOrderField::ParticipantID)},
+    {KEY_CLIENT_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ClientID),
+     sizeof(CThostFtdcOrderField::ClientID)},
+    {KEY_EXCHANGE_INST_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, ExchangeInstID),
+     sizeof(CThostFtdcOrderField::ExchangeInstID)},
+    {KEY_TRADER_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, TraderID),
+     sizeof(CThostFtdcOrderField::TraderID)},
+    {KEY_INSTALL_ID, FIELD_INT,
+     offsetof(CThostFtdcOrderField, InstallID),
+     sizeof(CThostFtdcOrderField::InstallID)},
+    {KEY_ORDER_SUBMIT_STATUS, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, OrderSubmitStatus),
+     sizeof(CThostFtdcOrderField::OrderSubmitStatus)},
+    {KEY_NOTIFY_SEQUENCE, FIELD_INT,
+     offsetof(CThostFtdcOrderField, NotifySequence),
+     sizeof(CThostFtdcOrderField::NotifySequence)},
+    {KEY_TRADING_DAY, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcOrderField, TradingDay),
+     sizeof(CThostFtdcOrderField::TradingDay)},
+    {KEY_SETTLEMENT_ID, FIELD_INT,
+     offsetof(CThostFtdcOrderField, SettlementID),
+     sizeof(CThostFtdcOrderField::SettlementID)},
+    {KEY_ORDER_SYS_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, OrderSysID),
+     sizeof(CThostFtdcOrderField::OrderSysID)},
+    {KEY_ORDER_SOURCE, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, OrderSource),
+     sizeof(CThostFtdcOrderField::OrderSource)},
+    {KEY_ORDER_STATUS, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, OrderStatus),
+     sizeof(CThostFtdcOrderField::OrderStatus)},
+    {KEY_ORDER_TYPE, FIELD_CHAR,
+     offsetof(CThostFtdcOrderField, OrderType),
+     sizeof(CThostFtdcOrderField::OrderType)},
+    {KEY_VOLUME_TRADED, FIELD_INT,
+     offsetof(CThostFtdcOrderField, VolumeTraded),
+     sizeof(CThostFtdcOrderField::VolumeTraded)},
+    {KEY_VOLUME_TOTAL, FIELD_INT,
+     offsetof(CThostFtdcOrderField, VolumeTotal),
+     sizeof(CThostFtdcOrderField::VolumeTotal)},
+    {KEY_INSERT_DATE, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, InsertDate),
+     sizeof(CThostFtdcOrderField::InsertDate)},
+    {KEY_INSERT_TIME, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, InsertTime),
+     sizeof(CThostFtdcOrderField::InsertTime)},
+    {KEY_ACTIVE_TIME, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ActiveTime),
+     sizeof(CThostFtdcOrderField::ActiveTime)},
+    {KEY_SUSPEND_TIME, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, SuspendTime),
+     sizeof(CThostFtdcOrderField::SuspendTime)},
+    {KEY_UPDATE_TIME, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, UpdateTime),
+     sizeof(CThostFtdcOrderField::UpdateTime)},
+    {KEY_CANCEL_TIME, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, CancelTime),
+     sizeof(CThostFtdcOrderField::CancelTime)},
+    {KEY_ACTIVE_TRADER_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ActiveTraderID),
+     sizeof(CThostFtdcOrderField::ActiveTraderID)},
+    {KEY_CLEARING_PART_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ClearingPartID),
+     sizeof(CThostFtdcOrderField::ClearingPartID)},
+    {KEY_SEQUENCE_NO, FIELD_INT,
+     offsetof(CThostFtdcOrderField, SequenceNo),
+     sizeof(CThostFtdcOrderField::SequenceNo)},
+    {KEY_FRONT_ID, FIELD_INT,
+     offsetof(CThostFtdcOrderField, FrontID),
+     sizeof(CThostFtdcOrderField::FrontID)},
+    {KEY_SESSION_ID, FIELD_INT,
+     offsetof(CThostFtdcOrderField, SessionID),
+     sizeof(CThostFtdcOrderField::SessionID)},
+    {KEY_USER_PRODUCT_INFO, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, UserProductInfo),
+     sizeof(CThostFtdcOrderField::UserProductInfo)},
+    {KEY_STATUS_MSG, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, StatusMsg),
+     sizeof(CThostFtdcOrderField::StatusMsg)},
+    {KEY_USER_FORCE_CLOSE, FIELD_INT,
+     offsetof(CThostFtdcOrderField, UserForceClose),
+     sizeof(CThostFtdcOrderField::UserForceClose)},
+    {KEY_ACTIVE_USER_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, ActiveUserID),
+     sizeof(CThostFtdcOrderField::ActiveUserID)},
+    {KEY_BROKER_ORDER_SEQ, FIELD_INT,
+     offsetof(CThostFtdcOrderField, BrokerOrderSeq),
+     sizeof(CThostFtdcOrderField::BrokerOrderSeq)},
+    {KEY_RELATIVE_ORDER_SYS_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, RelativeOrderSysID),
+     sizeof(CThostFtdcOrderField::RelativeOrderSysID)},
+    {KEY_ZCETOTAL_TRADED_VOLUME, FIELD_INT,
+     offsetof(CThostFtdcOrderField, ZCETotalTradedVolume),
+     sizeof(CThostFtdcOrderField::ZCETotalTradedVolume)},
+    {KEY_IS_SWAP_ORDER, FIELD_INT,
+     offsetof(CThostFtdcOrderField, IsSwapOrder),
+     sizeof(CThostFtdcOrderField::IsSwapOrder)},
+    {KEY_BRANCH_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, BranchID),
+     sizeof(CThostFtdcOrderField::BranchID)},
+    {KEY_INVEST_UNIT_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, InvestUnitID),
+     sizeof(CThostFtdcOrderField::InvestUnitID)},
+    {KEY_ACCOUNT_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, AccountID),
+     sizeof(CThostFtdcOrderField::AccountID)},
+    {KEY_CURRENCY_ID, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, CurrencyID),
+     sizeof(CThostFtdcOrderField::CurrencyID)},
+    {KEY_IPADDRESS, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, IPAddress),
+     sizeof(CThostFtdcOrderField::IPAddress)},
+    {KEY_MAC_ADDRESS, FIELD_STRING,
+     offsetof(CThostFtdcOrderField, MacAddress),
+     sizeof(CThostFtdcOrderField::MacAddress)},
+};
+
+FieldTable GetFieldTable(const CThostFtdcOrderField *) {
+  return {kOrderFields, ArraySize(kOrderFields)};
+}
+
+static const FieldInfo kTradeFields[] = {
+    {KEY_BROKER_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, BrokerID),
+     sizeof(CThostFtdcTradeField::BrokerID)},
+    {KEY_INVESTOR_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, InvestorID),
+     sizeof(CThostFtdcTradeField::InvestorID)},
+    {KEY_INSTRUMENT_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, InstrumentID),
+     sizeof(CThostFtdcTradeField::InstrumentID)},
+    {KEY_ORDER_REF, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, OrderRef),
+     sizeof(CThostFtdcTradeField::OrderRef)},
+    {KEY_USER_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, UserID),
+     sizeof(CThostFtdcTradeField::UserID)},
+    {KEY_EXCHANGE_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, ExchangeID),
+     sizeof(CThostFtdcTradeField::ExchangeID)},
+    {KEY_TRADE_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, TradeID),
+     sizeof(CThostFtdcTradeField::TradeID)},
+    {KEY_DIRECTION, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, Direction),
+     sizeof(CThostFtdcTradeField::Direction)},
+    {KEY_ORDER_SYS_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, OrderSysID),
+     sizeof(CThostFtdcTradeField::OrderSysID)},
+    {KEY_PARTICIPANT_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, ParticipantID),
+     sizeof(CThostFtdcTradeField::ParticipantID)},
+    {KEY_CLIENT_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, ClientID),
+     sizeof(CThostFtdcTradeField::ClientID)},
+    {KEY_TRADING_ROLE, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, TradingRole),
+     sizeof(CThostFtdcTradeField::TradingRole)},
+    {KEY_EXCHANGE_INST_ID, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, ExchangeInstID),
+     sizeof(CThostFtdcTradeField::ExchangeInstID)},
+    {KEY_OFFSET_FLAG, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, OffsetFlag),
+     sizeof(CThostFtdcTradeField::OffsetFlag)},
+    {KEY_HEDGE_FLAG, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, HedgeFlag),
+     sizeof(CThostFtdcTradeField::HedgeFlag)},
+    {KEY_PRICE, FIELD_DOUBLE,
+     offsetof(CThostFtdcTradeField, Price),
+     sizeof(CThostFtdcTradeField::Price)},
+    {KEY_VOLUME, FIELD_INT,
+     offsetof(CThostFtdcTradeField, Volume),
+     sizeof(CThostFtdcTradeField::Volume)},
+    {KEY_TRADE_DATE, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, TradeDate),
+     sizeof(CThostFtdcTradeField::TradeDate)},
+    {KEY_TRADE_TIME, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, TradeTime),
+     sizeof(CThostFtdcTradeField::TradeTime)},
+    {KEY_TRADE_TYPE, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, TradeType),
+     sizeof(CThostFtdcTradeField::TradeType)},
+    {KEY_PRICE_SOURCE, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, PriceSource),
+     sizeof(CThostFtdcTradeField::PriceSource)},
+    {KEY_TRADER_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, TraderID),
+     sizeof(CThostFtdcTradeField::TraderID)},
+    {KEY_ORDER_LOCAL_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, OrderLocalID),
+     sizeof(CThostFtdcTradeField::OrderLocalID)},
+    {KEY_CLEARING_PART_ID, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, ClearingPartID),
+     sizeof(CThostFtdcTradeField::ClearingPartID)},
+    {KEY_BUSINESS_UNIT, FIELD_STRING,
+     offsetof(CThostFtdcTradeField, BusinessUnit),
+     sizeof(CThostFtdcTradeField::BusinessUnit)},
+    {KEY_SEQUENCE_NO, FIELD_INT,
+     offsetof(CThostFtdcTradeField, SequenceNo),
+     sizeof(CThostFtdcTradeField::SequenceNo)},
+    {KEY_TRADING_DAY, FIELD_INTERNED_STRING,
+     offsetof(CThostFtdcTradeField, TradingDay),
+     sizeof(CThostFtdcTradeField::TradingDay)},
+    {KEY_SETTLEMENT_ID, FIELD_INT,
+     offsetof(CThostFtdcTradeField, SettlementID),
+     sizeof(CThostFtdcTradeField::SettlementID)},
+    {KEY_BROKER_ORDER_SEQ, FIELD_INT,
+     offsetof(CThostFtdcTradeField, BrokerOrderSeq),
+     sizeof(CThostFtdcTradeField::BrokerOrderSeq)},
+    {KEY_TRADE_SOURCE, FIELD_CHAR,
+     offsetof(CThostFtdcTradeField, TradeSource),
+     sizeof(CThostFtdcTradeField::TradeSource)},
+};
+
+FieldTable GetFieldTable(const CThostFtdcTradeField *) {
+  return {kTradeFields, ArraySize(kTradeFields)};
+}
+
+/**
+ * 信息分发
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDisseminationField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 序列系列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_SERIES, data->SequenceSeries);
+  /* 序列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+
+  return obj;
+}
+
+/**
+ * 用户登录请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqUserLoginField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 接口端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_INTERFACE_PRODUCT_INFO,
+                      data->InterfaceProductInfo);
+  /* 协议信息 */
+  SetNodeObjectString(isolate, obj, KEY_PROTOCOL_INFO, data->ProtocolInfo);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 动态密码 */
+  SetNodeObjectString(isolate, obj, KEY_ONE_TIME_PASSWORD,
+                      data->OneTimePassword);
+  /* 终端IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_IPADDRESS,
+                      data->ClientIPAddress);
+  /* 登录备注 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_REMARK, data->LoginRemark);
+
+  return obj;
+}
+
+/**
+ * 用户登录应答
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspUserLoginField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 登录成功时间 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_TIME, data->LoginTime);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易系统名称 */
+  SetNodeObjectString(isolate, obj, KEY_SYSTEM_NAME, data->SystemName);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 最大报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_ORDER_REF, data->MaxOrderRef);
+  /* 上期所时间 */
+  SetNodeObjectString(isolate, obj, KEY_SHFETIME, data->SHFETime);
+  /* 大商所时间 */
+  SetNodeObjectString(isolate, obj, KEY_DCETIME, data->DCETime);
+  /* 郑商所时间 */
+  SetNodeObjectString(isolate, obj, KEY_CZCETIME, data->CZCETime);
+  /* 中金所时间 */
+  SetNodeObjectString(isolate, obj, KEY_FFEXTIME, data->FFEXTime);
+  /* 能源中心时间 */
+  SetNodeObjectString(isolate, obj, KEY_INETIME, data->INETime);
+
+  return obj;
+}
+
+/**
+ * 用户登出请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserLogoutField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 强制交易员退出
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForceUserLogoutField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 客户端认证请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqAuthenticateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 认证码 */
+  SetNodeObjectString(isolate, obj, KEY_AUTH_CODE, data->AuthCode);
+
+  return obj;
+}
+
+/**
+ * 客户端认证响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspAuthenticateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+
+  return obj;
+}
+
+/**
+ * 客户端认证信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcAuthenticationInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 认证信息 */
+  SetNodeObjectString(isolate, obj, KEY_AUTH_INFO, data->AuthInfo);
+  /* 是否为认证结果 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RESULT, data->IsResult);
+
+  return obj;
+}
+
+/**
+ * 银期转帐报文头
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferHeaderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 版本号，常量，1.0 */
+  SetNodeObjectString(isolate, obj, KEY_VERSION, data->Version);
+  /* 交易代码，必填 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 交易日期，必填，格式：yyyymmdd */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间，必填，格式：hhmmss */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 发起方流水号，N/A */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_SERIAL, data->TradeSerial);
+  /* 期货公司代码，必填 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ID, data->FutureID);
+  /* 银行代码，根据查询银行得到，必填 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码，根据查询银行得到，必填 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+  /* 操作员，N/A */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 交易设备类型，N/A */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 记录数，N/A */
+  SetNodeObjectString(isolate, obj, KEY_RECORD_NUM, data->RecordNum);
+  /* 会话编号，N/A */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 请求编号，N/A */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+
+  return obj;
+}
+
+/**
+ * 银行资金转期货请求，TradeCode=202001
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTransferBankToFutureReqField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 期货资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FUTURE_PWD_FLAG, data->FuturePwdFlag);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACC_PWD, data->FutureAccPwd);
+  /* 转账金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMT, data->TradeAmt);
+  /* 客户手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 币种：RMB-人民币 USD-美圆 HKD-港元 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 银行资金转期货请求响应
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTransferBankToFutureRspField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 响应代码 */
+  SetNodeObjectString(isolate, obj, KEY_RET_CODE, data->RetCode);
+  /* 响应信息 */
+  SetNodeObjectString(isolate, obj, KEY_RET_INFO, data->RetInfo);
+  /* 资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMT, data->TradeAmt);
+  /* 应收客户手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 币种 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 期货资金转银行请求，TradeCode=202002
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTransferFutureToBankReqField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 期货资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FUTURE_PWD_FLAG, data->FuturePwdFlag);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACC_PWD, data->FutureAccPwd);
+  /* 转账金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMT, data->TradeAmt);
+  /* 客户手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 币种：RMB-人民币 USD-美圆 HKD-港元 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 期货资金转银行请求响应
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTransferFutureToBankRspField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 响应代码 */
+  SetNodeObjectString(isolate, obj, KEY_RET_CODE, data->RetCode);
+  /* 响应信息 */
+  SetNodeObjectString(isolate, obj, KEY_RET_INFO, data->RetInfo);
+  /* 资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMT, data->TradeAmt);
+  /* 应收客户手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 币种 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 查询银行资金请求，TradeCode=204002
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryBankReqField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 期货资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FUTURE_PWD_FLAG, data->FuturePwdFlag);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACC_PWD, data->FutureAccPwd);
+  /* 币种：RMB-人民币 USD-美圆 HKD-港元 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 查询银行资金请求响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryBankRspField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 响应代码 */
+  SetNodeObjectString(isolate, obj, KEY_RET_CODE, data->RetCode);
+  /* 响应信息 */
+  SetNodeObjectString(isolate, obj, KEY_RET_INFO, data->RetInfo);
+  /* 资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 银行余额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMT, data->TradeAmt);
+  /* 银行可用余额 */
+  SetNodeObjectDouble(isolate, obj, KEY_USE_AMT, data->UseAmt);
+  /* 银行可取余额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FETCH_AMT, data->FetchAmt);
+  /* 币种 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+
+  return obj;
+}
+
+/**
+ * 查询银行交易明细请求，TradeCode=204999
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryDetailReqField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 期货资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+
+  return obj;
+}
+
+/**
+ * 查询银行交易明细请求响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryDetailRspField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 交易代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 期货流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 期货公司代码 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ID, data->FutureID);
+  /* 资金帐号 */
+  SetNodeObjectString(isolate, obj, KEY_FUTURE_ACCOUNT, data->FutureAccount);
+  /* 银行流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+  /* 银行账号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_CERT_CODE, data->CertCode);
+  /* 货币代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_CODE, data->CurrencyCode);
+  /* 发生金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TX_AMOUNT, data->TxAmount);
+  /* 有效标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FLAG, data->Flag);
+
+  return obj;
+}
+
+/**
+ * 响应信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 交易所
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所名称 */
+  SetNodeObjectString(isolate, obj, KEY_EXCHANGE_NAME, data->ExchangeName);
+  /* 交易所属性 */
+  SetNodeObjectChar(isolate, obj, KEY_EXCHANGE_PROPERTY,
+                    data->ExchangeProperty);
+
+  return obj;
+}
+
+/**
+ * 产品
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 产品名称 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_NAME, data->ProductName);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 产品类型 */
+  SetNodeObjectChar(isolate, obj, KEY_PRODUCT_CLASS, data->ProductClass);
+  /* 合约数量乘数 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_MULTIPLE, data->VolumeMultiple);
+  /* 最小变动价位 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE_TICK, data->PriceTick);
+  /* 市价单最大下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_MARKET_ORDER_VOLUME,
+                   data->MaxMarketOrderVolume);
+  /* 市价单最小下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_MARKET_ORDER_VOLUME,
+                   data->MinMarketOrderVolume);
+  /* 限价单最大下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_LIMIT_ORDER_VOLUME,
+                   data->MaxLimitOrderVolume);
+  /* 限价单最小下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_LIMIT_ORDER_VOLUME,
+                   data->MinLimitOrderVolume);
+  /* 持仓类型 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_TYPE, data->PositionType);
+  /* 持仓日期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_DATE_TYPE,
+                    data->PositionDateType);
+  /* 平仓处理类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CLOSE_DEAL_TYPE, data->CloseDealType);
+  /* 交易币种类型 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CURRENCY_ID,
+                      data->TradeCurrencyID);
+  /* 质押资金可用范围 */
+  SetNodeObjectChar(isolate, obj, KEY_MORTGAGE_FUND_USE_RANGE,
+                    data->MortgageFundUseRange);
+  /* 交易所产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_EXCHANGE_PRODUCT_ID,
+                      data->ExchangeProductID);
+  /* 合约基础商品乘数 */
+  SetNodeObjectDouble(isolate, obj, KEY_UNDERLYING_MULTIPLE,
+                      data->UnderlyingMultiple);
+
+  return obj;
+}
+
+/**
+ * 合约
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约名称 */
+  SetNodeObjectString(isolate, obj, KEY_INSTRUMENT_NAME, data->InstrumentName);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 产品类型 */
+  SetNodeObjectChar(isolate, obj, KEY_PRODUCT_CLASS, data->ProductClass);
+  /* 交割年份 */
+  SetNodeObjectInt(isolate, obj, KEY_DELIVERY_YEAR, data->DeliveryYear);
+  /* 交割月 */
+  SetNodeObjectInt(isolate, obj, KEY_DELIVERY_MONTH, data->DeliveryMonth);
+  /* 市价单最大下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_MARKET_ORDER_VOLUME,
+                   data->MaxMarketOrderVolume);
+  /* 市价单最小下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_MARKET_ORDER_VOLUME,
+                   data->MinMarketOrderVolume);
+  /* 限价单最大下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_LIMIT_ORDER_VOLUME,
+                   data->MaxLimitOrderVolume);
+  /* 限价单最小下单量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_LIMIT_ORDER_VOLUME,
+                   data->MinLimitOrderVolume);
+  /* 合约数量乘数 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_MULTIPLE, data->VolumeMultiple);
+  /* 最小变动价位 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE_TICK, data->PriceTick);
+  /* 创建日 */
+  SetNodeObjectString(isolate, obj, KEY_CREATE_DATE, data->CreateDate);
+  /* 上市日 */
+  SetNodeObjectString(isolate, obj, KEY_OPEN_DATE, data->OpenDate);
+  /* 到期日 */
+  SetNodeObjectString(isolate, obj, KEY_EXPIRE_DATE, data->ExpireDate);
+  /* 开始交割日 */
+  SetNodeObjectString(isolate, obj, KEY_START_DELIV_DATE, data->StartDelivDate);
+  /* 结束交割日 */
+  SetNodeObjectString(isolate, obj, KEY_END_DELIV_DATE, data->EndDelivDate);
+  /* 合约生命周期状态 */
+  SetNodeObjectChar(isolate, obj, KEY_INST_LIFE_PHASE, data->InstLifePhase);
+  /* 当前是否交易 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_TRADING, data->IsTrading);
+  /* 持仓类型 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_TYPE, data->PositionType);
+  /* 持仓日期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_DATE_TYPE,
+                    data->PositionDateType);
+  /* 多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO,
+                      data->LongMarginRatio);
+  /* 空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO,
+                      data->ShortMarginRatio);
+  /* 是否使用大额单边保证金算法 */
+  SetNodeObjectChar(isolate, obj, KEY_MAX_MARGIN_SIDE_ALGORITHM,
+                    data->MaxMarginSideAlgorithm);
+  /* 基础商品代码 */
+  SetNodeObjectString(isolate, obj, KEY_UNDERLYING_INSTR_ID,
+                      data->UnderlyingInstrID);
+  /* 执行价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_PRICE, data->StrikePrice);
+  /* 期权类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OPTIONS_TYPE, data->OptionsType);
+  /* 合约基础商品乘数 */
+  SetNodeObjectDouble(isolate, obj, KEY_UNDERLYING_MULTIPLE,
+                      data->UnderlyingMultiple);
+  /* 组合类型 */
+  SetNodeObjectChar(isolate, obj, KEY_COMBINATION_TYPE, data->CombinationType);
+  /* 最小买下单单位 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_BUY_VOLUME, data->MinBuyVolume);
+  /* 最小卖下单单位 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_SELL_VOLUME, data->MinSellVolume);
+  /* 合约标识码 */
+  SetNodeObjectString(isolate, obj, KEY_INSTRUMENT_CODE, data->InstrumentCode);
+
+  return obj;
+}
+
+/**
+ * 经纪公司
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 经纪公司简称 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_ABBR, data->BrokerAbbr);
+  /* 经纪公司名称 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_NAME, data->BrokerName);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+
+  return obj;
+}
+
+/**
+ * 交易所交易员
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTraderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装数量 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_COUNT, data->InstallCount);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 投资者
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者分组代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_ID,
+                      data->InvestorGroupID);
+  /* 投资者名称 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_NAME, data->InvestorName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_IDENTIFIED_CARD_TYPE,
+                    data->IdentifiedCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+  /* 联系电话 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 通讯地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 开户日期 */
+  SetNodeObjectString(isolate, obj, KEY_OPEN_DATE, data->OpenDate);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE, data->Mobile);
+  /* 手续费率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMM_MODEL_ID, data->CommModelID);
+  /* 保证金率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_MARGIN_MODEL_ID, data->MarginModelID);
+
+  return obj;
+}
+
+/**
+ * 交易编码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingCodeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+  /* 交易编码类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CLIENT_IDTYPE, data->ClientIDType);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 会员编码和经纪公司编码对照表
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcPartBrokerField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+
+  return obj;
+}
+
+/**
+ * 管理用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSuperUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户名称 */
+  SetNodeObjectString(isolate, obj, KEY_USER_NAME, data->UserName);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+
+  return obj;
+}
+
+/**
+ * 管理用户功能权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSuperUserFunctionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 功能代码 */
+  SetNodeObjectChar(isolate, obj, KEY_FUNCTION_CODE, data->FunctionCode);
+
+  return obj;
+}
+
+/**
+ * 投资者组
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorGroupField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者分组代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_ID,
+                      data->InvestorGroupID);
+  /* 投资者分组名称 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_NAME,
+                      data->InvestorGroupName);
+
+  return obj;
+}
+
+/**
+ * 资金账户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 上次质押金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MORTGAGE, data->PreMortgage);
+  /* 上次信用额度 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_CREDIT, data->PreCredit);
+  /* 上次存款额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_DEPOSIT, data->PreDeposit);
+  /* 上次结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_BALANCE, data->PreBalance);
+  /* 上次占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MARGIN, data->PreMargin);
+  /* 利息基数 */
+  SetNodeObjectDouble(isolate, obj, KEY_INTEREST_BASE, data->InterestBase);
+  /* 利息收入 */
+  SetNodeObjectDouble(isolate, obj, KEY_INTEREST, data->Interest);
+  /* 入金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_DEPOSIT, data->Deposit);
+  /* 出金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_WITHDRAW, data->Withdraw);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+  /* 冻结的资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_CASH, data->FrozenCash);
+  /* 冻结的手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_COMMISSION,
+                      data->FrozenCommission);
+  /* 当前保证金总额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_MARGIN, data->CurrMargin);
+  /* 资金差额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CASH_IN, data->CashIn);
+  /* 手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_COMMISSION, data->Commission);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT, data->PositionProfit);
+  /* 期货结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_BALANCE, data->Balance);
+  /* 可用资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_AVAILABLE, data->Available);
+  /* 可取资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_WITHDRAW_QUOTA, data->WithdrawQuota);
+  /* 基本准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE, data->Reserve);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 信用额度 */
+  SetNodeObjectDouble(isolate, obj, KEY_CREDIT, data->Credit);
+  /* 质押金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_MORTGAGE, data->Mortgage);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_MARGIN, data->ExchangeMargin);
+  /* 投资者交割保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_DELIVERY_MARGIN, data->DeliveryMargin);
+  /* 交易所交割保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_DELIVERY_MARGIN,
+                      data->ExchangeDeliveryMargin);
+  /* 保底期货结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE_BALANCE, data->ReserveBalance);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 上次货币质入金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_FUND_MORTGAGE_IN,
+                      data->PreFundMortgageIn);
+  /* 上次货币质出金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_FUND_MORTGAGE_OUT,
+                      data->PreFundMortgageOut);
+  /* 货币质入金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_IN, data->FundMortgageIn);
+  /* 货币质出金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_OUT,
+                      data->FundMortgageOut);
+  /* 货币质押余额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_AVAILABLE,
+                      data->FundMortgageAvailable);
+  /* 可质押货币金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_MORTGAGEABLE_FUND,
+                      data->MortgageableFund);
+  /* 特殊产品占用保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_MARGIN,
+                      data->SpecProductMargin);
+  /* 特殊产品冻结保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_FROZEN_MARGIN,
+                      data->SpecProductFrozenMargin);
+  /* 特殊产品手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_COMMISSION,
+                      data->SpecProductCommission);
+  /* 特殊产品冻结手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_FROZEN_COMMISSION,
+                      data->SpecProductFrozenCommission);
+  /* 特殊产品持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_POSITION_PROFIT,
+                      data->SpecProductPositionProfit);
+  /* 特殊产品平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_CLOSE_PROFIT,
+                      data->SpecProductCloseProfit);
+  /* 根据持仓盈亏算法计算的特殊产品持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_POSITION_PROFIT_BY_ALG,
+                      data->SpecProductPositionProfitByAlg);
+  /* 特殊产品交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_EXCHANGE_MARGIN,
+                      data->SpecProductExchangeMargin);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 投资者持仓
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorPositionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 持仓多空方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 持仓日期 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_DATE, data->PositionDate);
+  /* 上日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_YD_POSITION, data->YdPosition);
+  /* 今日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_POSITION, data->Position);
+  /* 多头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_LONG_FROZEN, data->LongFrozen);
+  /* 空头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_SHORT_FROZEN, data->ShortFrozen);
+  /* 开仓冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_FROZEN_AMOUNT,
+                      data->LongFrozenAmount);
+  /* 开仓冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_FROZEN_AMOUNT,
+                      data->ShortFrozenAmount);
+  /* 开仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+  /* 平仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_CLOSE_VOLUME, data->CloseVolume);
+  /* 开仓金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_AMOUNT, data->OpenAmount);
+  /* 平仓金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_AMOUNT, data->CloseAmount);
+  /* 持仓成本 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_COST, data->PositionCost);
+  /* 上次占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MARGIN, data->PreMargin);
+  /* 占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_USE_MARGIN, data->UseMargin);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+  /* 冻结的资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_CASH, data->FrozenCash);
+  /* 冻结的手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_COMMISSION,
+                      data->FrozenCommission);
+  /* 资金差额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CASH_IN, data->CashIn);
+  /* 手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_COMMISSION, data->Commission);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT, data->PositionProfit);
+  /* 上次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_SETTLEMENT_PRICE,
+                      data->PreSettlementPrice);
+  /* 本次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 开仓成本 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_COST, data->OpenCost);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_MARGIN, data->ExchangeMargin);
+  /* 组合成交形成的持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_POSITION, data->CombPosition);
+  /* 组合多头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_LONG_FROZEN, data->CombLongFrozen);
+  /* 组合空头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_SHORT_FROZEN, data->CombShortFrozen);
+  /* 逐日盯市平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_DATE,
+                      data->CloseProfitByDate);
+  /* 逐笔对冲平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_TRADE,
+                      data->CloseProfitByTrade);
+  /* 今日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_TODAY_POSITION, data->TodayPosition);
+  /* 保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_MONEY,
+                      data->MarginRateByMoney);
+  /* 保证金率(按手数) */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_VOLUME,
+                      data->MarginRateByVolume);
+  /* 执行冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_STRIKE_FROZEN, data->StrikeFrozen);
+  /* 执行冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_FROZEN_AMOUNT,
+                      data->StrikeFrozenAmount);
+  /* 放弃执行冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_ABANDON_FROZEN, data->AbandonFrozen);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行冻结的昨仓 */
+  SetNodeObjectInt(isolate, obj, KEY_YD_STRIKE_FROZEN, data->YdStrikeFrozen);
+
+  return obj;
+}
+
+/**
+ * 合约保证金率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentMarginRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->LongMarginRatioByMoney);
+  /* 多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->LongMarginRatioByVolume);
+  /* 空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ShortMarginRatioByMoney);
+  /* 空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ShortMarginRatioByVolume);
+  /* 是否相对交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+
+  return obj;
+}
+
+/**
+ * 合约手续费率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInstrumentCommissionRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 深度行情
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDepthMarketDataField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 最新价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LAST_PRICE, data->LastPrice);
+  /* 上次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_SETTLEMENT_PRICE,
+                      data->PreSettlementPrice);
+  /* 昨收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_CLOSE_PRICE, data->PreClosePrice);
+  /* 昨持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_OPEN_INTEREST,
+                      data->PreOpenInterest);
+  /* 今开盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_PRICE, data->OpenPrice);
+  /* 最高价 */
+  SetNodeObjectDouble(isolate, obj, KEY_HIGHEST_PRICE, data->HighestPrice);
+  /* 最低价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWEST_PRICE, data->LowestPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 成交金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TURNOVER, data->Turnover);
+  /* 持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_INTEREST, data->OpenInterest);
+  /* 今收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PRICE, data->ClosePrice);
+  /* 本次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 涨停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_UPPER_LIMIT_PRICE,
+                      data->UpperLimitPrice);
+  /* 跌停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWER_LIMIT_PRICE,
+                      data->LowerLimitPrice);
+  /* 昨虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_DELTA, data->PreDelta);
+  /* 今虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_DELTA, data->CurrDelta);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 最后修改毫秒 */
+  SetNodeObjectInt(isolate, obj, KEY_UPDATE_MILLISEC, data->UpdateMillisec);
+  /* 申买价一 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE1, data->BidPrice1);
+  /* 申买量一 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME1, data->BidVolume1);
+  /* 申卖价一 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE1, data->AskPrice1);
+  /* 申卖量一 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME1, data->AskVolume1);
+  /* 申买价二 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE2, data->BidPrice2);
+  /* 申买量二 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME2, data->BidVolume2);
+  /* 申卖价二 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE2, data->AskPrice2);
+  /* 申卖量二 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME2, data->AskVolume2);
+  /* 申买价三 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE3, data->BidPrice3);
+  /* 申买量三 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME3, data->BidVolume3);
+  /* 申卖价三 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE3, data->AskPrice3);
+  /* 申卖量三 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME3, data->AskVolume3);
+  /* 申买价四 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE4, data->BidPrice4);
+  /* 申买量四 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME4, data->BidVolume4);
+  /* 申卖价四 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE4, data->AskPrice4);
+  /* 申卖量四 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME4, data->AskVolume4);
+  /* 申买价五 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE5, data->BidPrice5);
+  /* 申买量五 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME5, data->BidVolume5);
+  /* 申卖价五 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE5, data->AskPrice5);
+  /* 申卖量五 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME5, data->AskVolume5);
+  /* 当日均价 */
+  SetNodeObjectDouble(isolate, obj, KEY_AVERAGE_PRICE, data->AveragePrice);
+  /* 业务日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_ACTION_DAY, data->ActionDay);
+
+  return obj;
+}
+
+/**
+ * 投资者合约交易权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentTradingRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易权限 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADING_RIGHT, data->TradingRight);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 经纪公司用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户名称 */
+  SetNodeObjectString(isolate, obj, KEY_USER_NAME, data->UserName);
+  /* 用户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_TYPE, data->UserType);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+  /* 是否使用令牌 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_USING_OTP, data->IsUsingOTP);
+
+  return obj;
+}
+
+/**
+ * 经纪公司用户口令
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserPasswordField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+
+  return obj;
+}
+
+/**
+ * 经纪公司用户功能权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserFunctionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 经纪公司功能代码 */
+  SetNodeObjectChar(isolate, obj, KEY_BROKER_FUNCTION_CODE,
+                    data->BrokerFunctionCode);
+
+  return obj;
+}
+
+/**
+ * 交易所交易员报盘机
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTraderOfferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所交易员连接状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADER_CONNECT_STATUS,
+                    data->TraderConnectStatus);
+  /* 发出连接请求的日期 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_REQUEST_DATE,
+                      data->ConnectRequestDate);
+  /* 发出连接请求的时间 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_REQUEST_TIME,
+                      data->ConnectRequestTime);
+  /* 上次报告日期 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_DATE, data->LastReportDate);
+  /* 上次报告时间 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_TIME, data->LastReportTime);
+  /* 完成连接日期 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_DATE, data->ConnectDate);
+  /* 完成连接时间 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_TIME, data->ConnectTime);
+  /* 启动日期 */
+  SetNodeObjectString(isolate, obj, KEY_START_DATE, data->StartDate);
+  /* 启动时间 */
+  SetNodeObjectString(isolate, obj, KEY_START_TIME, data->StartTime);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 本席位最大成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_TRADE_ID, data->MaxTradeID);
+  /* 本席位最大报单备拷 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_ORDER_MESSAGE_REFERENCE,
+                      data->MaxOrderMessageReference);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 投资者结算结果
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 消息正文 */
+  SetNodeObjectString(isolate, obj, KEY_CONTENT, data->Content);
+
+  return obj;
+}
+
+/**
+ * 合约保证金率调整
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInstrumentMarginRateAdjustField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->LongMarginRatioByMoney);
+  /* 多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->LongMarginRatioByVolume);
+  /* 空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ShortMarginRatioByMoney);
+  /* 空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ShortMarginRatioByVolume);
+  /* 是否相对交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+
+  return obj;
+}
+
+/**
+ * 交易所保证金率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeMarginRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->LongMarginRatioByMoney);
+  /* 多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->LongMarginRatioByVolume);
+  /* 空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ShortMarginRatioByMoney);
+  /* 空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ShortMarginRatioByVolume);
+
+  return obj;
+}
+
+/**
+ * 交易所保证金率调整
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeMarginRateAdjustField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 跟随交易所投资者多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->LongMarginRatioByMoney);
+  /* 跟随交易所投资者多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->LongMarginRatioByVolume);
+  /* 跟随交易所投资者空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ShortMarginRatioByMoney);
+  /* 跟随交易所投资者空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ShortMarginRatioByVolume);
+  /* 交易所多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->ExchLongMarginRatioByMoney);
+  /* 交易所多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->ExchLongMarginRatioByVolume);
+  /* 交易所空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ExchShortMarginRatioByMoney);
+  /* 交易所空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ExchShortMarginRatioByVolume);
+  /* 不跟随交易所投资者多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_NO_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->NoLongMarginRatioByMoney);
+  /* 不跟随交易所投资者多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_NO_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->NoLongMarginRatioByVolume);
+  /* 不跟随交易所投资者空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_NO_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->NoShortMarginRatioByMoney);
+  /* 不跟随交易所投资者空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_NO_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->NoShortMarginRatioByVolume);
+
+  return obj;
+}
+
+/**
+ * 汇率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 源币种 */
+  SetNodeObjectString(isolate, obj, KEY_FROM_CURRENCY_ID, data->FromCurrencyID);
+  /* 源币种单位数量 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROM_CURRENCY_UNIT,
+                      data->FromCurrencyUnit);
+  /* 目标币种 */
+  SetNodeObjectString(isolate, obj, KEY_TO_CURRENCY_ID, data->ToCurrencyID);
+  /* 汇率 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_RATE, data->ExchangeRate);
+
+  return obj;
+}
+
+/**
+ * 结算引用
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementRefField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+
+  return obj;
+}
+
+/**
+ * 当前时间
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCurrentTimeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 当前日期 */
+  SetNodeObjectString(isolate, obj, KEY_CURR_DATE, data->CurrDate);
+  /* 当前时间 */
+  SetNodeObjectString(isolate, obj, KEY_CURR_TIME, data->CurrTime);
+  /* 当前时间（毫秒） */
+  SetNodeObjectInt(isolate, obj, KEY_CURR_MILLISEC, data->CurrMillisec);
+  /* 业务日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_ACTION_DAY, data->ActionDay);
+
+  return obj;
+}
+
+/**
+ * 通讯阶段
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCommPhaseField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 通讯时段编号 */
+  SetNodeObjectInt(isolate, obj, KEY_COMM_PHASE_NO, data->CommPhaseNo);
+  /* 系统编号 */
+  SetNodeObjectString(isolate, obj, KEY_SYSTEM_ID, data->SystemID);
+
+  return obj;
+}
+
+/**
+ * 登录信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoginInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 登录日期 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_DATE, data->LoginDate);
+  /* 登录时间 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_TIME, data->LoginTime);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 接口端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_INTERFACE_PRODUCT_INFO,
+                      data->InterfaceProductInfo);
+  /* 协议信息 */
+  SetNodeObjectString(isolate, obj, KEY_PROTOCOL_INFO, data->ProtocolInfo);
+  /* 系统名称 */
+  SetNodeObjectString(isolate, obj, KEY_SYSTEM_NAME, data->SystemName);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 最大报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_ORDER_REF, data->MaxOrderRef);
+  /* 上期所时间 */
+  SetNodeObjectString(isolate, obj, KEY_SHFETIME, data->SHFETime);
+  /* 大商所时间 */
+  SetNodeObjectString(isolate, obj, KEY_DCETIME, data->DCETime);
+  /* 郑商所时间 */
+  SetNodeObjectString(isolate, obj, KEY_CZCETIME, data->CZCETime);
+  /* 中金所时间 */
+  SetNodeObjectString(isolate, obj, KEY_FFEXTIME, data->FFEXTime);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 动态密码 */
+  SetNodeObjectString(isolate, obj, KEY_ONE_TIME_PASSWORD,
+                      data->OneTimePassword);
+  /* 能源中心时间 */
+  SetNodeObjectString(isolate, obj, KEY_INETIME, data->INETime);
+  /* 登录备注 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_REMARK, data->LoginRemark);
+
+  return obj;
+}
+
+/**
+ * 登录信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLogoutAllField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 系统名称 */
+  SetNodeObjectString(isolate, obj, KEY_SYSTEM_NAME, data->SystemName);
+
+  return obj;
+}
+
+/**
+ * 前置状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFrontStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 上次报告日期 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_DATE, data->LastReportDate);
+  /* 上次报告时间 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_TIME, data->LastReportTime);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+
+  return obj;
+}
+
+/**
+ * 用户口令变更
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserPasswordUpdateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 原来的口令 */
+  SetNodeObjectString(isolate, obj, KEY_OLD_PASSWORD, data->OldPassword);
+  /* 新的口令 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_PASSWORD, data->NewPassword);
+
+  return obj;
+}
+
+/**
+ * 输入报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 用户强评标志 */
+  SetNodeObjectInt(isolate, obj, KEY_USER_FORCE_CLOSE, data->UserForceClose);
+  /* 互换单标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_SWAP_ORDER, data->IsSwapOrder);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报单提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 报单来源 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SOURCE, data->OrderSource);
+  /* 报单状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_STATUS, data->OrderStatus);
+  /* 报单类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_TYPE, data->OrderType);
+  /* 今成交数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TRADED, data->VolumeTraded);
+  /* 剩余数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL, data->VolumeTotal);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 委托时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 激活时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TIME, data->ActiveTime);
+  /* 挂起时间 */
+  SetNodeObjectString(isolate, obj, KEY_SUSPEND_TIME, data->SuspendTime);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 最后修改交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TRADER_ID, data->ActiveTraderID);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 用户强评标志 */
+  SetNodeObjectInt(isolate, obj, KEY_USER_FORCE_CLOSE, data->UserForceClose);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司报单编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_ORDER_SEQ, data->BrokerOrderSeq);
+  /* 相关报单 */
+  SetNodeObjectString(isolate, obj, KEY_RELATIVE_ORDER_SYS_ID,
+                      data->RelativeOrderSysID);
+  /* 郑商所成交数量 */
+  SetNodeObjectInt(isolate, obj, KEY_ZCETOTAL_TRADED_VOLUME,
+                   data->ZCETotalTradedVolume);
+  /* 互换单标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_SWAP_ORDER, data->IsSwapOrder);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报单提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 报单来源 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SOURCE, data->OrderSource);
+  /* 报单状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_STATUS, data->OrderStatus);
+  /* 报单类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_TYPE, data->OrderType);
+  /* 今成交数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TRADED, data->VolumeTraded);
+  /* 剩余数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL, data->VolumeTotal);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 委托时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 激活时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TIME, data->ActiveTime);
+  /* 挂起时间 */
+  SetNodeObjectString(isolate, obj, KEY_SUSPEND_TIME, data->SuspendTime);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 最后修改交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TRADER_ID, data->ActiveTraderID);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所报单插入失败
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeOrderInsertErrorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 输入报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量变化 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_CHANGE, data->VolumeChange);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量变化 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_CHANGE, data->VolumeChange);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量变化 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_CHANGE, data->VolumeChange);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所报单操作失败
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeOrderActionErrorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 交易所成交
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeTradeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_ID, data->TradeID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易角色 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADING_ROLE, data->TradingRole);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE, data->Price);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 成交时期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 成交时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 成交类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADE_TYPE, data->TradeType);
+  /* 成交价来源 */
+  SetNodeObjectChar(isolate, obj, KEY_PRICE_SOURCE, data->PriceSource);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 成交来源 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADE_SOURCE, data->TradeSource);
+
+  return obj;
+}
+
+/**
+ * 成交
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_ID, data->TradeID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易角色 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADING_ROLE, data->TradingRole);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE, data->Price);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 成交时期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 成交时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 成交类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADE_TYPE, data->TradeType);
+  /* 成交价来源 */
+  SetNodeObjectChar(isolate, obj, KEY_PRICE_SOURCE, data->PriceSource);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 经纪公司报单编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_ORDER_SEQ, data->BrokerOrderSeq);
+  /* 成交来源 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADE_SOURCE, data->TradeSource);
+
+  return obj;
+}
+
+/**
+ * 用户会话
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserSessionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 登录日期 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_DATE, data->LoginDate);
+  /* 登录时间 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_TIME, data->LoginTime);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 接口端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_INTERFACE_PRODUCT_INFO,
+                      data->InterfaceProductInfo);
+  /* 协议信息 */
+  SetNodeObjectString(isolate, obj, KEY_PROTOCOL_INFO, data->ProtocolInfo);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 登录备注 */
+  SetNodeObjectString(isolate, obj, KEY_LOGIN_REMARK, data->LoginRemark);
+
+  return obj;
+}
+
+/**
+ * 查询最大报单数量
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQueryMaxOrderVolumeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 最大允许报单数量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_VOLUME, data->MaxVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者结算结果确认信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementInfoConfirmField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 确认日期 */
+  SetNodeObjectString(isolate, obj, KEY_CONFIRM_DATE, data->ConfirmDate);
+  /* 确认时间 */
+  SetNodeObjectString(isolate, obj, KEY_CONFIRM_TIME, data->ConfirmTime);
+
+  return obj;
+}
+
+/**
+ * 出入金同步
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncDepositField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 出入金流水号 */
+  SetNodeObjectString(isolate, obj, KEY_DEPOSIT_SEQ_NO, data->DepositSeqNo);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 入金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_DEPOSIT, data->Deposit);
+  /* 是否强制进行 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_FORCE, data->IsForce);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 货币质押同步
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncFundMortgageField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 货币质押流水号 */
+  SetNodeObjectString(isolate, obj, KEY_MORTGAGE_SEQ_NO, data->MortgageSeqNo);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 源币种 */
+  SetNodeObjectString(isolate, obj, KEY_FROM_CURRENCY_ID, data->FromCurrencyID);
+  /* 质押金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_MORTGAGE_AMOUNT, data->MortgageAmount);
+  /* 目标币种 */
+  SetNodeObjectString(isolate, obj, KEY_TO_CURRENCY_ID, data->ToCurrencyID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司同步
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerSyncField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的投资者
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingInvestorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者分组代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_ID,
+                      data->InvestorGroupID);
+  /* 投资者名称 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_NAME, data->InvestorName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_IDENTIFIED_CARD_TYPE,
+                    data->IdentifiedCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+  /* 联系电话 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 通讯地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 开户日期 */
+  SetNodeObjectString(isolate, obj, KEY_OPEN_DATE, data->OpenDate);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE, data->Mobile);
+  /* 手续费率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMM_MODEL_ID, data->CommModelID);
+  /* 保证金率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_MARGIN_MODEL_ID, data->MarginModelID);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的交易代码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingTradingCodeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+  /* 交易编码类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CLIENT_IDTYPE, data->ClientIDType);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的投资者分组
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingInvestorGroupField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者分组代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_ID,
+                      data->InvestorGroupID);
+  /* 投资者分组名称 */
+  SetNodeObjectString(isolate, obj, KEY_INVESTOR_GROUP_NAME,
+                      data->InvestorGroupName);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的交易账号
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingTradingAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 上次质押金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MORTGAGE, data->PreMortgage);
+  /* 上次信用额度 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_CREDIT, data->PreCredit);
+  /* 上次存款额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_DEPOSIT, data->PreDeposit);
+  /* 上次结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_BALANCE, data->PreBalance);
+  /* 上次占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MARGIN, data->PreMargin);
+  /* 利息基数 */
+  SetNodeObjectDouble(isolate, obj, KEY_INTEREST_BASE, data->InterestBase);
+  /* 利息收入 */
+  SetNodeObjectDouble(isolate, obj, KEY_INTEREST, data->Interest);
+  /* 入金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_DEPOSIT, data->Deposit);
+  /* 出金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_WITHDRAW, data->Withdraw);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+  /* 冻结的资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_CASH, data->FrozenCash);
+  /* 冻结的手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_COMMISSION,
+                      data->FrozenCommission);
+  /* 当前保证金总额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_MARGIN, data->CurrMargin);
+  /* 资金差额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CASH_IN, data->CashIn);
+  /* 手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_COMMISSION, data->Commission);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT, data->PositionProfit);
+  /* 期货结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_BALANCE, data->Balance);
+  /* 可用资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_AVAILABLE, data->Available);
+  /* 可取资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_WITHDRAW_QUOTA, data->WithdrawQuota);
+  /* 基本准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE, data->Reserve);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 信用额度 */
+  SetNodeObjectDouble(isolate, obj, KEY_CREDIT, data->Credit);
+  /* 质押金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_MORTGAGE, data->Mortgage);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_MARGIN, data->ExchangeMargin);
+  /* 投资者交割保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_DELIVERY_MARGIN, data->DeliveryMargin);
+  /* 交易所交割保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_DELIVERY_MARGIN,
+                      data->ExchangeDeliveryMargin);
+  /* 保底期货结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE_BALANCE, data->ReserveBalance);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 上次货币质入金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_FUND_MORTGAGE_IN,
+                      data->PreFundMortgageIn);
+  /* 上次货币质出金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_FUND_MORTGAGE_OUT,
+                      data->PreFundMortgageOut);
+  /* 货币质入金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_IN, data->FundMortgageIn);
+  /* 货币质出金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_OUT,
+                      data->FundMortgageOut);
+  /* 货币质押余额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_AVAILABLE,
+                      data->FundMortgageAvailable);
+  /* 可质押货币金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_MORTGAGEABLE_FUND,
+                      data->MortgageableFund);
+  /* 特殊产品占用保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_MARGIN,
+                      data->SpecProductMargin);
+  /* 特殊产品冻结保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_FROZEN_MARGIN,
+                      data->SpecProductFrozenMargin);
+  /* 特殊产品手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_COMMISSION,
+                      data->SpecProductCommission);
+  /* 特殊产品冻结手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_FROZEN_COMMISSION,
+                      data->SpecProductFrozenCommission);
+  /* 特殊产品持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_POSITION_PROFIT,
+                      data->SpecProductPositionProfit);
+  /* 特殊产品平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_CLOSE_PROFIT,
+                      data->SpecProductCloseProfit);
+  /* 根据持仓盈亏算法计算的特殊产品持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_POSITION_PROFIT_BY_ALG,
+                      data->SpecProductPositionProfitByAlg);
+  /* 特殊产品交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SPEC_PRODUCT_EXCHANGE_MARGIN,
+                      data->SpecProductExchangeMargin);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的投资者持仓
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcSyncingInvestorPositionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 持仓多空方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 持仓日期 */
+  SetNodeObjectChar(isolate, obj, KEY_POSITION_DATE, data->PositionDate);
+  /* 上日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_YD_POSITION, data->YdPosition);
+  /* 今日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_POSITION, data->Position);
+  /* 多头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_LONG_FROZEN, data->LongFrozen);
+  /* 空头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_SHORT_FROZEN, data->ShortFrozen);
+  /* 开仓冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_FROZEN_AMOUNT,
+                      data->LongFrozenAmount);
+  /* 开仓冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_FROZEN_AMOUNT,
+                      data->ShortFrozenAmount);
+  /* 开仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+  /* 平仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_CLOSE_VOLUME, data->CloseVolume);
+  /* 开仓金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_AMOUNT, data->OpenAmount);
+  /* 平仓金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_AMOUNT, data->CloseAmount);
+  /* 持仓成本 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_COST, data->PositionCost);
+  /* 上次占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_MARGIN, data->PreMargin);
+  /* 占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_USE_MARGIN, data->UseMargin);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+  /* 冻结的资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_CASH, data->FrozenCash);
+  /* 冻结的手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_COMMISSION,
+                      data->FrozenCommission);
+  /* 资金差额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CASH_IN, data->CashIn);
+  /* 手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_COMMISSION, data->Commission);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT, data->PositionProfit);
+  /* 上次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_SETTLEMENT_PRICE,
+                      data->PreSettlementPrice);
+  /* 本次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 开仓成本 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_COST, data->OpenCost);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_MARGIN, data->ExchangeMargin);
+  /* 组合成交形成的持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_POSITION, data->CombPosition);
+  /* 组合多头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_LONG_FROZEN, data->CombLongFrozen);
+  /* 组合空头冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_COMB_SHORT_FROZEN, data->CombShortFrozen);
+  /* 逐日盯市平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_DATE,
+                      data->CloseProfitByDate);
+  /* 逐笔对冲平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_TRADE,
+                      data->CloseProfitByTrade);
+  /* 今日持仓 */
+  SetNodeObjectInt(isolate, obj, KEY_TODAY_POSITION, data->TodayPosition);
+  /* 保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_MONEY,
+                      data->MarginRateByMoney);
+  /* 保证金率(按手数) */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_VOLUME,
+                      data->MarginRateByVolume);
+  /* 执行冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_STRIKE_FROZEN, data->StrikeFrozen);
+  /* 执行冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_FROZEN_AMOUNT,
+                      data->StrikeFrozenAmount);
+  /* 放弃执行冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_ABANDON_FROZEN, data->AbandonFrozen);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行冻结的昨仓 */
+  SetNodeObjectInt(isolate, obj, KEY_YD_STRIKE_FROZEN, data->YdStrikeFrozen);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的合约保证金率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcSyncingInstrumentMarginRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 多头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_MONEY,
+                      data->LongMarginRatioByMoney);
+  /* 多头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_MARGIN_RATIO_BY_VOLUME,
+                      data->LongMarginRatioByVolume);
+  /* 空头保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_MONEY,
+                      data->ShortMarginRatioByMoney);
+  /* 空头保证金费 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->ShortMarginRatioByVolume);
+  /* 是否相对交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的合约手续费率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcSyncingInstrumentCommissionRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 正在同步中的合约交易权限
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcSyncingInstrumentTradingRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易权限 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADING_RIGHT, data->TradingRight);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 查询成交
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_ID, data->TradeID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME_START, data->TradeTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME_END, data->TradeTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 查询投资者持仓
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorPositionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询资金账户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 查询投资者
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 查询交易编码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingCodeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易编码类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CLIENT_IDTYPE, data->ClientIDType);
+
+  return obj;
+}
+
+/**
+ * 查询投资者组
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorGroupField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 查询合约保证金率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentMarginRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 查询手续费率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentCommissionRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询合约交易权限
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentTradingRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 查询交易员
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTraderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询管理用户功能权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySuperUserFunctionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 查询用户会话
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryUserSessionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司会员代码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryPartBrokerField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+
+  return obj;
+}
+
+/**
+ * 查询前置状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryFrontStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+
+  return obj;
+}
+
+/**
+ * 查询交易所报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询交易所报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询管理用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySuperUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 查询交易所
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询产品
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 产品类型 */
+  SetNodeObjectChar(isolate, obj, KEY_PRODUCT_CLASS, data->ProductClass);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询合约
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInstrumentField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+
+  return obj;
+}
+
+/**
+ * 查询行情
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryDepthMarketDataField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司用户权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserFunctionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 查询交易员报盘机
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTraderOfferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询出入金流水
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncDepositField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 出入金流水号 */
+  SetNodeObjectString(isolate, obj, KEY_DEPOSIT_SEQ_NO, data->DepositSeqNo);
+
+  return obj;
+}
+
+/**
+ * 查询投资者结算结果
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySettlementInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+
+  return obj;
+}
+
+/**
+ * 查询交易所保证金率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeMarginRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 查询交易所调整保证金率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryExchangeMarginRateAdjustField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 查询汇率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 源币种 */
+  SetNodeObjectString(isolate, obj, KEY_FROM_CURRENCY_ID, data->FromCurrencyID);
+  /* 目标币种 */
+  SetNodeObjectString(isolate, obj, KEY_TO_CURRENCY_ID, data->ToCurrencyID);
+
+  return obj;
+}
+
+/**
+ * 查询货币质押流水
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncFundMortgageField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 货币质押流水号 */
+  SetNodeObjectString(isolate, obj, KEY_MORTGAGE_SEQ_NO, data->MortgageSeqNo);
+
+  return obj;
+}
+
+/**
+ * 查询报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryHisOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+
+  return obj;
+}
+
+/**
+ * 当前期权合约最小保证金
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrMiniMarginField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 单位（手）期权合约最小保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_MIN_MARGIN, data->MinMargin);
+  /* 取值方式 */
+  SetNodeObjectChar(isolate, obj, KEY_VALUE_METHOD, data->ValueMethod);
+  /* 是否跟随交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 当前期权合约保证金调整系数
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcOptionInstrMarginAdjustField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_SSHORT_MARGIN_RATIO_BY_MONEY,
+                      data->SShortMarginRatioByMoney);
+  /* 投机空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_SSHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->SShortMarginRatioByVolume);
+  /* 保值空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_HSHORT_MARGIN_RATIO_BY_MONEY,
+                      data->HShortMarginRatioByMoney);
+  /* 保值空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_HSHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->HShortMarginRatioByVolume);
+  /* 套利空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASHORT_MARGIN_RATIO_BY_MONEY,
+                      data->AShortMarginRatioByMoney);
+  /* 套利空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->AShortMarginRatioByVolume);
+  /* 是否跟随交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 做市商空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_MSHORT_MARGIN_RATIO_BY_MONEY,
+                      data->MShortMarginRatioByMoney);
+  /* 做市商空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_MSHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->MShortMarginRatioByVolume);
+
+  return obj;
+}
+
+/**
+ * 当前期权合约手续费的详细内容
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 执行手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_MONEY,
+                      data->StrikeRatioByMoney);
+  /* 执行手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_VOLUME,
+                      data->StrikeRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 期权交易成本
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrTradeCostField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 期权合约保证金不变部分 */
+  SetNodeObjectDouble(isolate, obj, KEY_FIXED_MARGIN, data->FixedMargin);
+  /* 期权合约最小保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_MINI_MARGIN, data->MiniMargin);
+  /* 期权合约权利金 */
+  SetNodeObjectDouble(isolate, obj, KEY_ROYALTY, data->Royalty);
+  /* 交易所期权合约保证金不变部分 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_FIXED_MARGIN,
+                      data->ExchFixedMargin);
+  /* 交易所期权合约最小保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_MINI_MARGIN, data->ExchMiniMargin);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 期权交易成本查询
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryOptionInstrTradeCostField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 期权合约报价 */
+  SetNodeObjectDouble(isolate, obj, KEY_INPUT_PRICE, data->InputPrice);
+  /* 标的价格,填0则用昨结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_UNDERLYING_PRICE,
+                      data->UnderlyingPrice);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 期权手续费率查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 股指现货指数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcIndexPriceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 指数现货收盘价 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PRICE, data->ClosePrice);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 输入的执行宣告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 保留头寸申请的持仓方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 期权行权后是否保留期货头寸的标记 */
+  SetNodeObjectChar(isolate, obj, KEY_RESERVE_POSITION_FLAG,
+                    data->ReservePositionFlag);
+  /* 期权行权后生成的头寸是否自动平仓 */
+  SetNodeObjectChar(isolate, obj, KEY_CLOSE_FLAG, data->CloseFlag);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 输入执行宣告操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 执行宣告操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_EXEC_ORDER_ACTION_REF,
+                   data->ExecOrderActionRef);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 执行宣告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 保留头寸申请的持仓方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 期权行权后是否保留期货头寸的标记 */
+  SetNodeObjectChar(isolate, obj, KEY_RESERVE_POSITION_FLAG,
+                    data->ReservePositionFlag);
+  /* 期权行权后生成的头寸是否自动平仓 */
+  SetNodeObjectChar(isolate, obj, KEY_CLOSE_FLAG, data->CloseFlag);
+  /* 本地执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_LOCAL_ID,
+                      data->ExecOrderLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 执行宣告提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 执行结果 */
+  SetNodeObjectChar(isolate, obj, KEY_EXEC_RESULT, data->ExecResult);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司报单编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_EXEC_ORDER_SEQ,
+                   data->BrokerExecOrderSeq);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 执行宣告操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 执行宣告操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_EXEC_ORDER_ACTION_REF,
+                   data->ExecOrderActionRef);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_LOCAL_ID,
+                      data->ExecOrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 执行宣告查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 交易所执行宣告信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 保留头寸申请的持仓方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 期权行权后是否保留期货头寸的标记 */
+  SetNodeObjectChar(isolate, obj, KEY_RESERVE_POSITION_FLAG,
+                    data->ReservePositionFlag);
+  /* 期权行权后生成的头寸是否自动平仓 */
+  SetNodeObjectChar(isolate, obj, KEY_CLOSE_FLAG, data->CloseFlag);
+  /* 本地执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_LOCAL_ID,
+                      data->ExecOrderLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 执行宣告提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 执行结果 */
+  SetNodeObjectChar(isolate, obj, KEY_EXEC_RESULT, data->ExecResult);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所执行宣告查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 执行宣告操作查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所执行宣告操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_LOCAL_ID,
+                      data->ExecOrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所执行宣告操作查询
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryExchangeExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 错误执行宣告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 保留头寸申请的持仓方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 期权行权后是否保留期货头寸的标记 */
+  SetNodeObjectChar(isolate, obj, KEY_RESERVE_POSITION_FLAG,
+                    data->ReservePositionFlag);
+  /* 期权行权后生成的头寸是否自动平仓 */
+  SetNodeObjectChar(isolate, obj, KEY_CLOSE_FLAG, data->CloseFlag);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询错误执行宣告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrExecOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 错误执行宣告操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 执行宣告操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_EXEC_ORDER_ACTION_REF,
+                   data->ExecOrderActionRef);
+  /* 执行宣告引用 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_REF, data->ExecOrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询错误执行宣告操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrExecOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 投资者期权合约交易权限
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcOptionInstrTradingRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 交易权限 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADING_RIGHT, data->TradingRight);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 查询期权合约交易权限
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryOptionInstrTradingRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 输入的询价
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputForQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 询价引用 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_REF, data->ForQuoteRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 询价
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 询价引用 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_REF, data->ForQuoteRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 本地询价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_LOCAL_ID,
+                      data->ForQuoteLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 询价状态 */
+  SetNodeObjectChar(isolate, obj, KEY_FOR_QUOTE_STATUS, data->ForQuoteStatus);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司询价编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_FOR_QUTO_SEQ,
+                   data->BrokerForQutoSeq);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 询价查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryForQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 交易所询价信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeForQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 本地询价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_LOCAL_ID,
+                      data->ForQuoteLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 询价状态 */
+  SetNodeObjectChar(isolate, obj, KEY_FOR_QUOTE_STATUS, data->ForQuoteStatus);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 交易所询价查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeForQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 输入的报价
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报价引用 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_REF, data->QuoteRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 卖价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE, data->AskPrice);
+  /* 买价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE, data->BidPrice);
+  /* 卖数量 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME, data->AskVolume);
+  /* 买数量 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME, data->BidVolume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 卖开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_OFFSET_FLAG, data->AskOffsetFlag);
+  /* 买开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_OFFSET_FLAG, data->BidOffsetFlag);
+  /* 卖投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_HEDGE_FLAG, data->AskHedgeFlag);
+  /* 买投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_HEDGE_FLAG, data->BidHedgeFlag);
+  /* 衍生卖报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ASK_ORDER_REF, data->AskOrderRef);
+  /* 衍生买报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_BID_ORDER_REF, data->BidOrderRef);
+  /* 应价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_SYS_ID, data->ForQuoteSysID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 输入报价操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputQuoteActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报价操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_QUOTE_ACTION_REF, data->QuoteActionRef);
+  /* 报价引用 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_REF, data->QuoteRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报价操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 报价
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报价引用 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_REF, data->QuoteRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 卖价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE, data->AskPrice);
+  /* 买价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE, data->BidPrice);
+  /* 卖数量 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME, data->AskVolume);
+  /* 买数量 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME, data->BidVolume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 卖开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_OFFSET_FLAG, data->AskOffsetFlag);
+  /* 买开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_OFFSET_FLAG, data->BidOffsetFlag);
+  /* 卖投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_HEDGE_FLAG, data->AskHedgeFlag);
+  /* 买投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_HEDGE_FLAG, data->BidHedgeFlag);
+  /* 本地报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_LOCAL_ID, data->QuoteLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报价提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 报价提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 报价状态 */
+  SetNodeObjectChar(isolate, obj, KEY_QUOTE_STATUS, data->QuoteStatus);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 卖方报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ASK_ORDER_SYS_ID, data->AskOrderSysID);
+  /* 买方报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_BID_ORDER_SYS_ID, data->BidOrderSysID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司报价编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_QUOTE_SEQ, data->BrokerQuoteSeq);
+  /* 衍生卖报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ASK_ORDER_REF, data->AskOrderRef);
+  /* 衍生买报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_BID_ORDER_REF, data->BidOrderRef);
+  /* 应价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_SYS_ID, data->ForQuoteSysID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 报价操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQuoteActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报价操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_QUOTE_ACTION_REF, data->QuoteActionRef);
+  /* 报价引用 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_REF, data->QuoteRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报价操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_LOCAL_ID, data->QuoteLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 报价查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 交易所报价信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 卖价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE, data->AskPrice);
+  /* 买价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE, data->BidPrice);
+  /* 卖数量 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME, data->AskVolume);
+  /* 买数量 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME, data->BidVolume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 卖开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_OFFSET_FLAG, data->AskOffsetFlag);
+  /* 买开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_OFFSET_FLAG, data->BidOffsetFlag);
+  /* 卖投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ASK_HEDGE_FLAG, data->AskHedgeFlag);
+  /* 买投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BID_HEDGE_FLAG, data->BidHedgeFlag);
+  /* 本地报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_LOCAL_ID, data->QuoteLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报价提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 报价提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 报价状态 */
+  SetNodeObjectChar(isolate, obj, KEY_QUOTE_STATUS, data->QuoteStatus);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 卖方报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ASK_ORDER_SYS_ID, data->AskOrderSysID);
+  /* 买方报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_BID_ORDER_SYS_ID, data->BidOrderSysID);
+  /* 应价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_SYS_ID, data->ForQuoteSysID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所报价查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeQuoteField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 报价操作查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryQuoteActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所报价操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeQuoteActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报价操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_SYS_ID, data->QuoteSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报价编号 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_LOCAL_ID, data->QuoteLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 交易所报价操作查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeQuoteActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 期权合约delta值
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrDeltaField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* Delta值 */
+  SetNodeObjectDouble(isolate, obj, KEY_DELTA, data->Delta);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 发给做市商的询价请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteRspField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 询价编号 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_SYS_ID, data->ForQuoteSysID);
+  /* 询价时间 */
+  SetNodeObjectString(isolate, obj, KEY_FOR_QUOTE_TIME, data->ForQuoteTime);
+  /* 业务日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_ACTION_DAY, data->ActionDay);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 当前期权合约执行偏移值的详细内容
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStrikeOffsetField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 执行偏移值 */
+  SetNodeObjectDouble(isolate, obj, KEY_OFFSET, data->Offset);
+  /* 行权偏移类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_TYPE, data->OffsetType);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 期权执行偏移值查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStrikeOffsetField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 录入锁定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputLockField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 锁定引用 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_REF, data->LockRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 锁定类型 */
+  SetNodeObjectChar(isolate, obj, KEY_LOCK_TYPE, data->LockType);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 锁定
+ */
+Local<Object> NewNodeObject(Isolate *isolate, const CThostFtdcLockField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 锁定引用 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_REF, data->LockRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 锁定类型 */
+  SetNodeObjectChar(isolate, obj, KEY_LOCK_TYPE, data->LockType);
+  /* 本地锁定编号 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_LOCAL_ID, data->LockLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 执行宣告提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 锁定编号 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_SYS_ID, data->LockSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 锁定状态 */
+  SetNodeObjectChar(isolate, obj, KEY_LOCK_STATUS, data->LockStatus);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司报单编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_LOCK_SEQ, data->BrokerLockSeq);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 查询锁定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLockField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 锁定编号 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_SYS_ID, data->LockSysID);
+  /* 开始时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_START,
+                      data->InsertTimeStart);
+  /* 结束时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME_END, data->InsertTimeEnd);
+
+  return obj;
+}
+
+/**
+ * 锁定证券仓位
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLockPositionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 冻结数量 */
+  SetNodeObjectInt(isolate, obj, KEY_FROZEN_VOLUME, data->FrozenVolume);
+
+  return obj;
+}
+
+/**
+ * 查询锁定证券仓位
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLockPositionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 当前ETF期权合约手续费的详细内容
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcETFOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 执行手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_MONEY,
+                      data->StrikeRatioByMoney);
+  /* 执行手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_VOLUME,
+                      data->StrikeRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 持仓方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+
+  return obj;
+}
+
+/**
+ * ETF期权手续费率查询
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryETFOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 输入的持仓冻结
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcPosiFreezeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 冻结原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FREEZE_REASON_TYPE,
+                    data->FreezeReasonType);
+  /* 冻结类型 */
+  SetNodeObjectChar(isolate, obj, KEY_FREEZE_TYPE, data->FreezeType);
+
+  return obj;
+}
+
+/**
+ * 查询锁定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeLockField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 交易所锁定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeLockField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 锁定类型 */
+  SetNodeObjectChar(isolate, obj, KEY_LOCK_TYPE, data->LockType);
+  /* 本地锁定编号 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_LOCAL_ID, data->LockLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 执行宣告提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 锁定编号 */
+  SetNodeObjectString(isolate, obj, KEY_LOCK_SYS_ID, data->LockSysID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 锁定状态 */
+  SetNodeObjectChar(isolate, obj, KEY_LOCK_STATUS, data->LockStatus);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所操作错误
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeExecOrderActionErrorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_SYS_ID,
+                      data->ExecOrderSysID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地执行宣告编号 */
+  SetNodeObjectString(isolate, obj, KEY_EXEC_ORDER_LOCAL_ID,
+                      data->ExecOrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 输入批量报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputBatchOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 批量报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBatchOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 交易所批量报单操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeBatchOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 查询批量报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBatchOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 多头数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_LONG_VOLUME, data->LongVolume);
+  /* 当日多头开仓数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+  /* 多头持仓金额限制,不再使用 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT, data->LongAmount);
+  /* 总数量冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME_FROZEN,
+                   data->TotalVolumeFrozen);
+  /* 多头数量冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_LONG_VOLUME_FROZEN,
+                   data->LongVolumeFrozen);
+  /* 当日开仓数量冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME_FROZEN,
+                   data->OpenVolumeFrozen);
+  /* 多头持仓金额冻结,不再使用 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT_FROZEN,
+                      data->LongAmountFrozen);
+
+  return obj;
+}
+
+/**
+ * 查询投资者持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitPosiField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerLimitPosiField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 多头数量限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_VOLUME, data->LongVolume);
+  /* 总数量冻结 */
+  SetNodeObjectDouble(isolate, obj, KEY_TOTAL_VOLUME_FROZEN,
+                      data->TotalVolumeFrozen);
+  /* 多头数量冻结 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_VOLUME_FROZEN,
+                      data->LongVolumeFrozen);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerLimitPosiField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者证券持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiSField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 当日开仓数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+  /* 总数量冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME_FROZEN,
+                   data->TotalVolumeFrozen);
+  /* 当日开仓数量冻结 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME_FROZEN,
+                   data->OpenVolumeFrozen);
+
+  return obj;
+}
+
+/**
+ * 查询投资者证券持仓限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitPosiSField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者持仓限制参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 多头数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_LONG_VOLUME, data->LongVolume);
+  /* 当日开仓数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+  /* 多头持仓金额限制,不再使用 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT, data->LongAmount);
+
+  return obj;
+}
+
+/**
+ * 经纪公司持仓限制参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerLimitPosiParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 多头数量限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_VOLUME, data->LongVolume);
+
+  return obj;
+}
+
+/**
+ * 投资者证券持仓限制参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiParamSField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 总数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_VOLUME, data->TotalVolume);
+  /* 当日开仓数量限制 */
+  SetNodeObjectInt(isolate, obj, KEY_OPEN_VOLUME, data->OpenVolume);
+
+  return obj;
+}
+
+/**
+ * 输入证券处置操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInputStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 证券处置操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_STOCK_DISPOSAL_ACTION_REF,
+                   data->StockDisposalActionRef);
+  /* 证券处置引用 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_REF,
+                      data->StockDisposalRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 证券处置操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 证券处置操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_STOCK_DISPOSAL_ACTION_REF,
+                   data->StockDisposalActionRef);
+  /* 证券处置引用 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_REF,
+                      data->StockDisposalRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_LOCAL_ID,
+                      data->StockDisposalLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 证券处置操作查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所证券处置操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_LOCAL_ID,
+                      data->StockDisposalLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 执行类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_TYPE, data->ActionType);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 错误证券处置操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryExchangeStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询错误证券处置操作
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryErrStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 交易所证券处置操作错误
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcExchangeStockDisposalActionErrorField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_LOCAL_ID,
+                      data->StockDisposalLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 错误证券处置操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrStockDisposalActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 证券处置操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_STOCK_DISPOSAL_ACTION_REF,
+                   data->StockDisposalActionRef);
+  /* 证券处置引用 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_REF,
+                      data->StockDisposalRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 投资者分级
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorLevelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资者分级类型 */
+  SetNodeObjectChar(isolate, obj, KEY_LEVEL_TYPE, data->LevelType);
+
+  return obj;
+}
+
+/**
+ * 组合合约安全系数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombInstrumentGuardField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /*  */
+  SetNodeObjectDouble(isolate, obj, KEY_GUARANT_RATIO, data->GuarantRatio);
+
+  return obj;
+}
+
+/**
+ * 组合合约安全系数查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombInstrumentGuardField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 输入的申请组合
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputCombActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 组合引用 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_ACTION_REF, data->CombActionRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 组合指令方向 */
+  SetNodeObjectChar(isolate, obj, KEY_COMB_DIRECTION, data->CombDirection);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 申请组合
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 组合引用 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_ACTION_REF, data->CombActionRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 组合指令方向 */
+  SetNodeObjectChar(isolate, obj, KEY_COMB_DIRECTION, data->CombDirection);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 本地申请组合编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 组合状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_STATUS, data->ActionStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 组合编号 */
+  SetNodeObjectString(isolate, obj, KEY_COM_TRADE_ID, data->ComTradeID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 申请组合查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所申请组合信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeCombActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 组合指令方向 */
+  SetNodeObjectChar(isolate, obj, KEY_COMB_DIRECTION, data->CombDirection);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 本地申请组合编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 组合状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_STATUS, data->ActionStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 组合编号 */
+  SetNodeObjectString(isolate, obj, KEY_COM_TRADE_ID, data->ComTradeID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 交易所申请组合查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeCombActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 产品报价汇率
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductExchRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 报价币种类型 */
+  SetNodeObjectString(isolate, obj, KEY_QUOTE_CURRENCY_ID,
+                      data->QuoteCurrencyID);
+  /* 汇率 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCHANGE_RATE, data->ExchangeRate);
+
+  return obj;
+}
+
+/**
+ * 产品报价汇率查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductExchRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+
+  return obj;
+}
+
+/**
+ * 输入的指定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputDesignateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 指定登记引用 */
+  SetNodeObjectString(isolate, obj, KEY_DESIGNATE_REF, data->DesignateRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 指定方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DESIGNATE_TYPE, data->DesignateType);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 指定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDesignateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 指定登记引用 */
+  SetNodeObjectString(isolate, obj, KEY_DESIGNATE_REF, data->DesignateRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 指定方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DESIGNATE_TYPE, data->DesignateType);
+  /* 本地指定编号 */
+  SetNodeObjectString(isolate, obj, KEY_DESIGNATE_LOCAL_ID,
+                      data->DesignateLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 指定状态 */
+  SetNodeObjectChar(isolate, obj, KEY_DESIGNATE_STATUS, data->DesignateStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 申请指定
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryDesignateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所指定信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeDesignateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 指定方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DESIGNATE_TYPE, data->DesignateType);
+  /* 本地指定编号 */
+  SetNodeObjectString(isolate, obj, KEY_DESIGNATE_LOCAL_ID,
+                      data->DesignateLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 指定状态 */
+  SetNodeObjectChar(isolate, obj, KEY_DESIGNATE_STATUS, data->DesignateStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+
+  return obj;
+}
+
+/**
+ * 输入的证券处置
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputStockDisposalField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 证券处置登记引用 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_REF,
+                      data->StockDisposalRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 证券处置方向 */
+  SetNodeObjectChar(isolate, obj, KEY_STOCK_DISPOSAL_TYPE,
+                    data->StockDisposalType);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 证券处置
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStockDisposalField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 证券处置登记引用 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_REF,
+                      data->StockDisposalRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 证券处置方向 */
+  SetNodeObjectChar(isolate, obj, KEY_STOCK_DISPOSAL_TYPE,
+                    data->StockDisposalType);
+  /* 本地证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_LOCAL_ID,
+                      data->StockDisposalLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 证券处置状态 */
+  SetNodeObjectChar(isolate, obj, KEY_STOCK_DISPOSAL_STATUS,
+                    data->StockDisposalStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+
+  return obj;
+}
+
+/**
+ * 申请证券处置
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStockDisposalField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所证券处置信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeStockDisposalField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 证券处置方向 */
+  SetNodeObjectChar(isolate, obj, KEY_STOCK_DISPOSAL_TYPE,
+                    data->StockDisposalType);
+  /* 本地证券处置编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_LOCAL_ID,
+                      data->StockDisposalLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 证券处置状态 */
+  SetNodeObjectChar(isolate, obj, KEY_STOCK_DISPOSAL_STATUS,
+                    data->StockDisposalStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 插入时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 证券处置操作编号 */
+  SetNodeObjectString(isolate, obj, KEY_STOCK_DISPOSAL_SYS_ID,
+                      data->StockDisposalSysID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+
+  return obj;
+}
+
+/**
+ * 查询投资者分级
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorLevelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询询价价差参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryForQuoteParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 询价价差参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 最新价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LAST_PRICE, data->LastPrice);
+  /* 价差 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE_INTERVAL, data->PriceInterval);
+
+  return obj;
+}
+
+/**
+ * 查询行权冻结
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecFreezeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 行权冻结
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecFreezeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 标的合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 持仓多空方向 */
+  SetNodeObjectChar(isolate, obj, KEY_POSI_DIRECTION, data->PosiDirection);
+  /* 期权类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OPTIONS_TYPE, data->OptionsType);
+  /* 冻结的数量_单位股 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 冻结金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_AMOUNT, data->FrozenAmount);
+
+  return obj;
+}
+
+/**
+ * 当前做市商期权合约手续费的详细内容
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMMOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 执行手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_MONEY,
+                      data->StrikeRatioByMoney);
+  /* 执行手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_STRIKE_RATIO_BY_VOLUME,
+                      data->StrikeRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 做市商期权手续费率查询
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryMMOptionInstrCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 做市商合约手续费率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcMMInstrumentCommissionRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 开仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_MONEY,
+                      data->OpenRatioByMoney);
+  /* 开仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_RATIO_BY_VOLUME,
+                      data->OpenRatioByVolume);
+  /* 平仓手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_MONEY,
+                      data->CloseRatioByMoney);
+  /* 平仓手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_RATIO_BY_VOLUME,
+                      data->CloseRatioByVolume);
+  /* 平今手续费率 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_MONEY,
+                      data->CloseTodayRatioByMoney);
+  /* 平今手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_TODAY_RATIO_BY_VOLUME,
+                      data->CloseTodayRatioByVolume);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询做市商合约手续费率
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryMMInstrumentCommissionRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 当前报单手续费的详细内容
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInstrumentOrderCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 报单手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_ORDER_COMM_BY_VOLUME,
+                      data->OrderCommByVolume);
+  /* 撤单手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_ORDER_ACTION_COMM_BY_VOLUME,
+                      data->OrderActionCommByVolume);
+
+  return obj;
+}
+
+/**
+ * 报单手续费率查询
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentOrderCommRateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者金额限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitAmountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 多头持仓金额限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT, data->LongAmount);
+  /* 多头持仓金额冻结 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT_FROZEN,
+                      data->LongAmountFrozen);
+
+  return obj;
+}
+
+/**
+ * 查询投资者金额限制
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitAmountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者金额限制参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitAmountParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 多头持仓金额限制 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_AMOUNT, data->LongAmount);
+
+  return obj;
+}
+
+/**
+ * 当前期权合约保证金保障系数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrMarginGuardField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_SSHORT_MARGIN_RATIO_BY_MONEY,
+                      data->SShortMarginRatioByMoney);
+  /* 投机空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_SSHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->SShortMarginRatioByVolume);
+  /* 保值空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_HSHORT_MARGIN_RATIO_BY_MONEY,
+                      data->HShortMarginRatioByMoney);
+  /* 保值空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_HSHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->HShortMarginRatioByVolume);
+  /* 套利空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASHORT_MARGIN_RATIO_BY_MONEY,
+                      data->AShortMarginRatioByMoney);
+  /* 套利空头保证金调整系数 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASHORT_MARGIN_RATIO_BY_VOLUME,
+                      data->AShortMarginRatioByVolume);
+  /* 是否跟随交易所收取 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_RELATIVE, data->IsRelative);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 市场行情
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 最新价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LAST_PRICE, data->LastPrice);
+  /* 上次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_SETTLEMENT_PRICE,
+                      data->PreSettlementPrice);
+  /* 昨收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_CLOSE_PRICE, data->PreClosePrice);
+  /* 昨持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_OPEN_INTEREST,
+                      data->PreOpenInterest);
+  /* 今开盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_PRICE, data->OpenPrice);
+  /* 最高价 */
+  SetNodeObjectDouble(isolate, obj, KEY_HIGHEST_PRICE, data->HighestPrice);
+  /* 最低价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWEST_PRICE, data->LowestPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 成交金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TURNOVER, data->Turnover);
+  /* 持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_INTEREST, data->OpenInterest);
+  /* 今收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PRICE, data->ClosePrice);
+  /* 本次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 涨停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_UPPER_LIMIT_PRICE,
+                      data->UpperLimitPrice);
+  /* 跌停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWER_LIMIT_PRICE,
+                      data->LowerLimitPrice);
+  /* 昨虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_DELTA, data->PreDelta);
+  /* 今虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_DELTA, data->CurrDelta);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 最后修改毫秒 */
+  SetNodeObjectInt(isolate, obj, KEY_UPDATE_MILLISEC, data->UpdateMillisec);
+  /* 业务日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_ACTION_DAY, data->ActionDay);
+
+  return obj;
+}
+
+/**
+ * 行情基础属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBaseField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 上次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_SETTLEMENT_PRICE,
+                      data->PreSettlementPrice);
+  /* 昨收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_CLOSE_PRICE, data->PreClosePrice);
+  /* 昨持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_OPEN_INTEREST,
+                      data->PreOpenInterest);
+  /* 昨虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_DELTA, data->PreDelta);
+
+  return obj;
+}
+
+/**
+ * 行情静态属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataStaticField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 今开盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_PRICE, data->OpenPrice);
+  /* 最高价 */
+  SetNodeObjectDouble(isolate, obj, KEY_HIGHEST_PRICE, data->HighestPrice);
+  /* 最低价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWEST_PRICE, data->LowestPrice);
+  /* 今收盘 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PRICE, data->ClosePrice);
+  /* 涨停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_UPPER_LIMIT_PRICE,
+                      data->UpperLimitPrice);
+  /* 跌停板价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LOWER_LIMIT_PRICE,
+                      data->LowerLimitPrice);
+  /* 本次结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 今虚实度 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_DELTA, data->CurrDelta);
+
+  return obj;
+}
+
+/**
+ * 行情最新成交属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataLastMatchField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 最新价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LAST_PRICE, data->LastPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 成交金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TURNOVER, data->Turnover);
+  /* 持仓量 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_INTEREST, data->OpenInterest);
+
+  return obj;
+}
+
+/**
+ * 行情最优价属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBestPriceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 申买价一 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE1, data->BidPrice1);
+  /* 申买量一 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME1, data->BidVolume1);
+  /* 申卖价一 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE1, data->AskPrice1);
+  /* 申卖量一 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME1, data->AskVolume1);
+
+  return obj;
+}
+
+/**
+ * 行情申买二、三属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBid23Field *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 申买价二 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE2, data->BidPrice2);
+  /* 申买量二 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME2, data->BidVolume2);
+  /* 申买价三 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE3, data->BidPrice3);
+  /* 申买量三 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME3, data->BidVolume3);
+
+  return obj;
+}
+
+/**
+ * 行情申卖二、三属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAsk23Field *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 申卖价二 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE2, data->AskPrice2);
+  /* 申卖量二 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME2, data->AskVolume2);
+  /* 申卖价三 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE3, data->AskPrice3);
+  /* 申卖量三 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME3, data->AskVolume3);
+
+  return obj;
+}
+
+/**
+ * 行情申买四、五属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBid45Field *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 申买价四 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE4, data->BidPrice4);
+  /* 申买量四 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME4, data->BidVolume4);
+  /* 申买价五 */
+  SetNodeObjectDouble(isolate, obj, KEY_BID_PRICE5, data->BidPrice5);
+  /* 申买量五 */
+  SetNodeObjectInt(isolate, obj, KEY_BID_VOLUME5, data->BidVolume5);
+
+  return obj;
+}
+
+/**
+ * 行情申卖四、五属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAsk45Field *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 申卖价四 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE4, data->AskPrice4);
+  /* 申卖量四 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME4, data->AskVolume4);
+  /* 申卖价五 */
+  SetNodeObjectDouble(isolate, obj, KEY_ASK_PRICE5, data->AskPrice5);
+  /* 申卖量五 */
+  SetNodeObjectInt(isolate, obj, KEY_ASK_VOLUME5, data->AskVolume5);
+
+  return obj;
+}
+
+/**
+ * 行情更新时间属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataUpdateTimeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 最后修改毫秒 */
+  SetNodeObjectInt(isolate, obj, KEY_UPDATE_MILLISEC, data->UpdateMillisec);
+  /* 业务日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_ACTION_DAY, data->ActionDay);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 行情交易所代码属性
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataExchangeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 指定的合约
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSpecificInstrumentField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 合约状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 结算组代码 */
+  SetNodeObjectString(isolate, obj, KEY_SETTLEMENT_GROUP_ID,
+                      data->SettlementGroupID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 合约交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_INSTRUMENT_STATUS,
+                    data->InstrumentStatus);
+  /* 交易阶段编号 */
+  SetNodeObjectInt(isolate, obj, KEY_TRADING_SEGMENT_SN,
+                   data->TradingSegmentSN);
+  /* 进入本状态时间 */
+  SetNodeObjectString(isolate, obj, KEY_ENTER_TIME, data->EnterTime);
+  /* 进入本状态原因 */
+  SetNodeObjectChar(isolate, obj, KEY_ENTER_REASON, data->EnterReason);
+
+  return obj;
+}
+
+/**
+ * 查询合约状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInstrumentStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+
+  return obj;
+}
+
+/**
+ * 投资者账户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 浮动盈亏算法
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcPositionProfitAlgorithmField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 盈亏算法 */
+  SetNodeObjectChar(isolate, obj, KEY_ALGORITHM, data->Algorithm);
+  /* 备注 */
+  SetNodeObjectString(isolate, obj, KEY_MEMO, data->Memo);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 会员资金折扣
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDiscountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 资金折扣比例 */
+  SetNodeObjectDouble(isolate, obj, KEY_DISCOUNT, data->Discount);
+
+  return obj;
+}
+
+/**
+ * 查询转帐银行
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTransferBankField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+
+  return obj;
+}
+
+/**
+ * 转帐银行
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferBankField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+  /* 银行名称 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_NAME, data->BankName);
+  /* 是否活跃 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_ACTIVE, data->IsActive);
+
+  return obj;
+}
+
+/**
+ * 查询投资者持仓明细
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInvestorPositionDetailField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者持仓明细
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorPositionDetailField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 买卖 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 开仓日期 */
+  SetNodeObjectString(isolate, obj, KEY_OPEN_DATE, data->OpenDate);
+  /* 成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_ID, data->TradeID);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+  /* 开仓价 */
+  SetNodeObjectDouble(isolate, obj, KEY_OPEN_PRICE, data->OpenPrice);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 成交类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADE_TYPE, data->TradeType);
+  /* 组合合约代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_INSTRUMENT_ID,
+                      data->CombInstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 逐日盯市平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_DATE,
+                      data->CloseProfitByDate);
+  /* 逐笔对冲平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT_BY_TRADE,
+                      data->CloseProfitByTrade);
+  /* 逐日盯市持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT_BY_DATE,
+                      data->PositionProfitByDate);
+  /* 逐笔对冲持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT_BY_TRADE,
+                      data->PositionProfitByTrade);
+  /* 投资者保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN, data->Margin);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_MARGIN, data->ExchMargin);
+  /* 保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_MONEY,
+                      data->MarginRateByMoney);
+  /* 保证金率(按手数) */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_VOLUME,
+                      data->MarginRateByVolume);
+  /* 昨结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_LAST_SETTLEMENT_PRICE,
+                      data->LastSettlementPrice);
+  /* 结算价 */
+  SetNodeObjectDouble(isolate, obj, KEY_SETTLEMENT_PRICE,
+                      data->SettlementPrice);
+  /* 平仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_CLOSE_VOLUME, data->CloseVolume);
+  /* 平仓金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_AMOUNT, data->CloseAmount);
+
+  return obj;
+}
+
+/**
+ * 资金账户口令域
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountPasswordField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 交易所行情报盘机
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMDTraderOfferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所交易员连接状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRADER_CONNECT_STATUS,
+                    data->TraderConnectStatus);
+  /* 发出连接请求的日期 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_REQUEST_DATE,
+                      data->ConnectRequestDate);
+  /* 发出连接请求的时间 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_REQUEST_TIME,
+                      data->ConnectRequestTime);
+  /* 上次报告日期 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_DATE, data->LastReportDate);
+  /* 上次报告时间 */
+  SetNodeObjectString(isolate, obj, KEY_LAST_REPORT_TIME, data->LastReportTime);
+  /* 完成连接日期 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_DATE, data->ConnectDate);
+  /* 完成连接时间 */
+  SetNodeObjectString(isolate, obj, KEY_CONNECT_TIME, data->ConnectTime);
+  /* 启动日期 */
+  SetNodeObjectString(isolate, obj, KEY_START_DATE, data->StartDate);
+  /* 启动时间 */
+  SetNodeObjectString(isolate, obj, KEY_START_TIME, data->StartTime);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 本席位最大成交编号 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_TRADE_ID, data->MaxTradeID);
+  /* 本席位最大报单备拷 */
+  SetNodeObjectString(isolate, obj, KEY_MAX_ORDER_MESSAGE_REFERENCE,
+                      data->MaxOrderMessageReference);
+  /* 业务类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BIZ_TYPE, data->BizType);
+
+  return obj;
+}
+
+/**
+ * 查询行情报盘机
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryMDTraderOfferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+
+  return obj;
+}
+
+/**
+ * 查询客户通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryNoticeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 客户通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNoticeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 消息正文 */
+  SetNodeObjectString(isolate, obj, KEY_CONTENT, data->Content);
+  /* 经纪公司通知内容序列号 */
+  SetNodeObjectString(isolate, obj, KEY_SEQUENCE_LABEL, data->SequenceLabel);
+
+  return obj;
+}
+
+/**
+ * 用户权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 客户权限类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_RIGHT_TYPE, data->UserRightType);
+  /* 是否禁止 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_FORBIDDEN, data->IsForbidden);
+
+  return obj;
+}
+
+/**
+ * 查询结算信息确认域
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQrySettlementInfoConfirmField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 装载结算信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoadSettlementInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司可提资金算法表
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcBrokerWithdrawAlgorithmField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 可提资金算法 */
+  SetNodeObjectChar(isolate, obj, KEY_WITHDRAW_ALGORITHM,
+                    data->WithdrawAlgorithm);
+  /* 资金使用率 */
+  SetNodeObjectDouble(isolate, obj, KEY_USING_RATIO, data->UsingRatio);
+  /* 可提是否包含平仓盈利 */
+  SetNodeObjectChar(isolate, obj, KEY_INCLUDE_CLOSE_PROFIT,
+                    data->IncludeCloseProfit);
+  /* 本日无仓且无成交客户是否受可提比例限制 */
+  SetNodeObjectChar(isolate, obj, KEY_ALL_WITHOUT_TRADE, data->AllWithoutTrade);
+  /* 可用是否包含平仓盈利 */
+  SetNodeObjectChar(isolate, obj, KEY_AVAIL_INCLUDE_CLOSE_PROFIT,
+                    data->AvailIncludeCloseProfit);
+  /* 是否启用用户事件 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_BROKER_USER_EVENT,
+                   data->IsBrokerUserEvent);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 货币质押比率 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_RATIO,
+                      data->FundMortgageRatio);
+  /* 权益算法 */
+  SetNodeObjectChar(isolate, obj, KEY_BALANCE_ALGORITHM,
+                    data->BalanceAlgorithm);
+
+  return obj;
+}
+
+/**
+ * 资金账户口令变更域
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcTradingAccountPasswordUpdateV1Field *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 原来的口令 */
+  SetNodeObjectString(isolate, obj, KEY_OLD_PASSWORD, data->OldPassword);
+  /* 新的口令 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_PASSWORD, data->NewPassword);
+
+  return obj;
+}
+
+/**
+ * 资金账户口令变更域
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTradingAccountPasswordUpdateField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 原来的口令 */
+  SetNodeObjectString(isolate, obj, KEY_OLD_PASSWORD, data->OldPassword);
+  /* 新的口令 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_PASSWORD, data->NewPassword);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 查询组合合约分腿
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombinationLegField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 组合合约代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_INSTRUMENT_ID,
+                      data->CombInstrumentID);
+  /* 单腿编号 */
+  SetNodeObjectInt(isolate, obj, KEY_LEG_ID, data->LegID);
+  /* 单腿合约代码 */
+  SetNodeObjectString(isolate, obj, KEY_LEG_INSTRUMENT_ID,
+                      data->LegInstrumentID);
+
+  return obj;
+}
+
+/**
+ * 查询组合合约分腿
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+
+  return obj;
+}
+
+/**
+ * 组合交易合约的单腿
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombinationLegField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 组合合约代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_INSTRUMENT_ID,
+                      data->CombInstrumentID);
+  /* 单腿编号 */
+  SetNodeObjectInt(isolate, obj, KEY_LEG_ID, data->LegID);
+  /* 单腿合约代码 */
+  SetNodeObjectString(isolate, obj, KEY_LEG_INSTRUMENT_ID,
+                      data->LegInstrumentID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 单腿乘数 */
+  SetNodeObjectInt(isolate, obj, KEY_LEG_MULTIPLE, data->LegMultiple);
+  /* 派生层数 */
+  SetNodeObjectInt(isolate, obj, KEY_IMPLY_LEVEL, data->ImplyLevel);
+
+  return obj;
+}
+
+/**
+ * 数据同步状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncStatusField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 数据同步状态 */
+  SetNodeObjectChar(isolate, obj, KEY_DATA_SYNC_STATUS, data->DataSyncStatus);
+
+  return obj;
+}
+
+/**
+ * 查询联系人
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLinkManField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 联系人
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLinkManField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 联系人类型 */
+  SetNodeObjectChar(isolate, obj, KEY_PERSON_TYPE, data->PersonType);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_IDENTIFIED_CARD_TYPE,
+                    data->IdentifiedCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 名称 */
+  SetNodeObjectString(isolate, obj, KEY_PERSON_NAME, data->PersonName);
+  /* 联系电话 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 通讯地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮政编码 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 优先级 */
+  SetNodeObjectInt(isolate, obj, KEY_PRIORITY, data->Priority);
+  /* 开户邮政编码 */
+  SetNodeObjectString(isolate, obj, KEY_UOAZIP_CODE, data->UOAZipCode);
+  /* 全称 */
+  SetNodeObjectString(isolate, obj, KEY_PERSON_FULL_NAME, data->PersonFullName);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司用户事件
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserEventField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户事件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_EVENT_TYPE, data->UserEventType);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司用户事件
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserEventField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 用户事件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_EVENT_TYPE, data->UserEventType);
+  /* 用户事件序号 */
+  SetNodeObjectInt(isolate, obj, KEY_EVENT_SEQUENCE_NO, data->EventSequenceNo);
+  /* 事件发生日期 */
+  SetNodeObjectString(isolate, obj, KEY_EVENT_DATE, data->EventDate);
+  /* 事件发生时间 */
+  SetNodeObjectString(isolate, obj, KEY_EVENT_TIME, data->EventTime);
+  /* 用户事件信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_EVENT_INFO, data->UserEventInfo);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询签约银行请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryContractBankField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+
+  return obj;
+}
+
+/**
+ * 查询签约银行响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcContractBankField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分中心代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRCH_ID, data->BankBrchID);
+  /* 银行名称 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_NAME, data->BankName);
+
+  return obj;
+}
+
+/**
+ * 投资者组合持仓明细
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcInvestorPositionCombineDetailField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 开仓日期 */
+  SetNodeObjectString(isolate, obj, KEY_OPEN_DATE, data->OpenDate);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 组合编号 */
+  SetNodeObjectString(isolate, obj, KEY_COM_TRADE_ID, data->ComTradeID);
+  /* 撮合编号 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_ID, data->TradeID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 买卖 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 持仓量 */
+  SetNodeObjectInt(isolate, obj, KEY_TOTAL_AMT, data->TotalAmt);
+  /* 投资者保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN, data->Margin);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_MARGIN, data->ExchMargin);
+  /* 保证金率 */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_MONEY,
+                      data->MarginRateByMoney);
+  /* 保证金率(按手数) */
+  SetNodeObjectDouble(isolate, obj, KEY_MARGIN_RATE_BY_VOLUME,
+                      data->MarginRateByVolume);
+  /* 单腿编号 */
+  SetNodeObjectInt(isolate, obj, KEY_LEG_ID, data->LegID);
+  /* 单腿乘数 */
+  SetNodeObjectInt(isolate, obj, KEY_LEG_MULTIPLE, data->LegMultiple);
+  /* 组合持仓合约编码 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_INSTRUMENT_ID,
+                      data->CombInstrumentID);
+  /* 成交组号 */
+  SetNodeObjectInt(isolate, obj, KEY_TRADE_GROUP_ID, data->TradeGroupID);
+
+  return obj;
+}
+
+/**
+ * 预埋单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcParkedOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 用户强评标志 */
+  SetNodeObjectInt(isolate, obj, KEY_USER_FORCE_CLOSE, data->UserForceClose);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 预埋报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_PARKED_ORDER_ID, data->ParkedOrderID);
+  /* 用户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_TYPE, data->UserType);
+  /* 预埋单状态 */
+  SetNodeObjectChar(isolate, obj, KEY_STATUS, data->Status);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 互换单标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_SWAP_ORDER, data->IsSwapOrder);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 输入预埋单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcParkedOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量变化 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_CHANGE, data->VolumeChange);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 预埋撤单单编号 */
+  SetNodeObjectString(isolate, obj, KEY_PARKED_ORDER_ACTION_ID,
+                      data->ParkedOrderActionID);
+  /* 用户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_USER_TYPE, data->UserType);
+  /* 预埋撤单状态 */
+  SetNodeObjectChar(isolate, obj, KEY_STATUS, data->Status);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 查询预埋单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryParkedOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询预埋撤单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryParkedOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 删除预埋单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRemoveParkedOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 预埋报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_PARKED_ORDER_ID, data->ParkedOrderID);
+
+  return obj;
+}
+
+/**
+ * 删除预埋撤单
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcRemoveParkedOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 预埋撤单编号 */
+  SetNodeObjectString(isolate, obj, KEY_PARKED_ORDER_ACTION_ID,
+                      data->ParkedOrderActionID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司可提资金算法表
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInvestorWithdrawAlgorithmField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 可提资金比例 */
+  SetNodeObjectDouble(isolate, obj, KEY_USING_RATIO, data->UsingRatio);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 货币质押比率 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUND_MORTGAGE_RATIO,
+                      data->FundMortgageRatio);
+
+  return obj;
+}
+
+/**
+ * 查询组合持仓明细
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryInvestorPositionCombineDetailField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 组合持仓合约编码 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_INSTRUMENT_ID,
+                      data->CombInstrumentID);
+
+  return obj;
+}
+
+/**
+ * 成交均价
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAveragePriceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 当日均价 */
+  SetNodeObjectDouble(isolate, obj, KEY_AVERAGE_PRICE, data->AveragePrice);
+
+  return obj;
+}
+
+/**
+ * 校验投资者密码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyInvestorPasswordField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+
+  return obj;
+}
+
+/**
+ * 用户IP
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserIPField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* IP地址掩码 */
+  SetNodeObjectString(isolate, obj, KEY_IPMASK, data->IPMask);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 用户事件通知信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingNoticeInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 发送时间 */
+  SetNodeObjectString(isolate, obj, KEY_SEND_TIME, data->SendTime);
+  /* 消息正文 */
+  SetNodeObjectString(isolate, obj, KEY_FIELD_CONTENT, data->FieldContent);
+  /* 序列系列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_SERIES, data->SequenceSeries);
+  /* 序列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+
+  return obj;
+}
+
+/**
+ * 用户事件通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingNoticeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者范围 */
+  SetNodeObjectChar(isolate, obj, KEY_INVESTOR_RANGE, data->InvestorRange);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 序列系列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_SERIES, data->SequenceSeries);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 发送时间 */
+  SetNodeObjectString(isolate, obj, KEY_SEND_TIME, data->SendTime);
+  /* 序列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 消息正文 */
+  SetNodeObjectString(isolate, obj, KEY_FIELD_CONTENT, data->FieldContent);
+
+  return obj;
+}
+
+/**
+ * 查询交易事件通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingNoticeField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 查询错误报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 错误报单
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 用户强评标志 */
+  SetNodeObjectInt(isolate, obj, KEY_USER_FORCE_CLOSE, data->UserForceClose);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 互换单标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_SWAP_ORDER, data->IsSwapOrder);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易编码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 查询错误报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrorConditionalOrderField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 报单价格条件 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_PRICE_TYPE, data->OrderPriceType);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 组合开平标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_OFFSET_FLAG, data->CombOffsetFlag);
+  /* 组合投机套保标志 */
+  SetNodeObjectString(isolate, obj, KEY_COMB_HEDGE_FLAG, data->CombHedgeFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL_ORIGINAL,
+                   data->VolumeTotalOriginal);
+  /* 有效期类型 */
+  SetNodeObjectChar(isolate, obj, KEY_TIME_CONDITION, data->TimeCondition);
+  /* GTD日期 */
+  SetNodeObjectString(isolate, obj, KEY_GTDDATE, data->GTDDate);
+  /* 成交量类型 */
+  SetNodeObjectChar(isolate, obj, KEY_VOLUME_CONDITION, data->VolumeCondition);
+  /* 最小成交量 */
+  SetNodeObjectInt(isolate, obj, KEY_MIN_VOLUME, data->MinVolume);
+  /* 触发条件 */
+  SetNodeObjectChar(isolate, obj, KEY_CONTINGENT_CONDITION,
+                    data->ContingentCondition);
+  /* 止损价 */
+  SetNodeObjectDouble(isolate, obj, KEY_STOP_PRICE, data->StopPrice);
+  /* 强平原因 */
+  SetNodeObjectChar(isolate, obj, KEY_FORCE_CLOSE_REASON,
+                    data->ForceCloseReason);
+  /* 自动挂起标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_AUTO_SUSPEND, data->IsAutoSuspend);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 合约在交易所的代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_INST_ID,
+                              data->ExchangeInstID);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 报单提交状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SUBMIT_STATUS,
+                    data->OrderSubmitStatus);
+  /* 报单提示序号 */
+  SetNodeObjectInt(isolate, obj, KEY_NOTIFY_SEQUENCE, data->NotifySequence);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 报单来源 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_SOURCE, data->OrderSource);
+  /* 报单状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_STATUS, data->OrderStatus);
+  /* 报单类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_TYPE, data->OrderType);
+  /* 今成交数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TRADED, data->VolumeTraded);
+  /* 剩余数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_TOTAL, data->VolumeTotal);
+  /* 报单日期 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_DATE, data->InsertDate);
+  /* 委托时间 */
+  SetNodeObjectString(isolate, obj, KEY_INSERT_TIME, data->InsertTime);
+  /* 激活时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TIME, data->ActiveTime);
+  /* 挂起时间 */
+  SetNodeObjectString(isolate, obj, KEY_SUSPEND_TIME, data->SuspendTime);
+  /* 最后修改时间 */
+  SetNodeObjectString(isolate, obj, KEY_UPDATE_TIME, data->UpdateTime);
+  /* 撤销时间 */
+  SetNodeObjectString(isolate, obj, KEY_CANCEL_TIME, data->CancelTime);
+  /* 最后修改交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_TRADER_ID, data->ActiveTraderID);
+  /* 结算会员编号 */
+  SetNodeObjectString(isolate, obj, KEY_CLEARING_PART_ID, data->ClearingPartID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 用户端产品信息 */
+  SetNodeObjectString(isolate, obj, KEY_USER_PRODUCT_INFO,
+                      data->UserProductInfo);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 用户强评标志 */
+  SetNodeObjectInt(isolate, obj, KEY_USER_FORCE_CLOSE, data->UserForceClose);
+  /* 操作用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_ACTIVE_USER_ID, data->ActiveUserID);
+  /* 经纪公司报单编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BROKER_ORDER_SEQ, data->BrokerOrderSeq);
+  /* 相关报单 */
+  SetNodeObjectString(isolate, obj, KEY_RELATIVE_ORDER_SYS_ID,
+                      data->RelativeOrderSysID);
+  /* 郑商所成交数量 */
+  SetNodeObjectInt(isolate, obj, KEY_ZCETOTAL_TRADED_VOLUME,
+                   data->ZCETotalTradedVolume);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 互换单标志 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_SWAP_ORDER, data->IsSwapOrder);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* 资金账号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+
+  return obj;
+}
+
+/**
+ * 查询错误报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 错误报单操作
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrOrderActionField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 报单操作引用 */
+  SetNodeObjectInt(isolate, obj, KEY_ORDER_ACTION_REF, data->OrderActionRef);
+  /* 报单引用 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_REF, data->OrderRef);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 前置编号 */
+  SetNodeObjectInt(isolate, obj, KEY_FRONT_ID, data->FrontID);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_SYS_ID, data->OrderSysID);
+  /* 操作标志 */
+  SetNodeObjectChar(isolate, obj, KEY_ACTION_FLAG, data->ActionFlag);
+  /* 价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_LIMIT_PRICE, data->LimitPrice);
+  /* 数量变化 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME_CHANGE, data->VolumeChange);
+  /* 操作日期 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_DATE, data->ActionDate);
+  /* 操作时间 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_TIME, data->ActionTime);
+  /* 交易所交易员代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADER_ID, data->TraderID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 本地报单编号 */
+  SetNodeObjectString(isolate, obj, KEY_ORDER_LOCAL_ID, data->OrderLocalID);
+  /* 操作本地编号 */
+  SetNodeObjectString(isolate, obj, KEY_ACTION_LOCAL_ID, data->ActionLocalID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 客户代码 */
+  SetNodeObjectString(isolate, obj, KEY_CLIENT_ID, data->ClientID);
+  /* 业务单元 */
+  SetNodeObjectString(isolate, obj, KEY_BUSINESS_UNIT, data->BusinessUnit);
+  /* 报单操作状态 */
+  SetNodeObjectChar(isolate, obj, KEY_ORDER_ACTION_STATUS,
+                    data->OrderActionStatus);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 状态信息 */
+  SetNodeObjectString(isolate, obj, KEY_STATUS_MSG, data->StatusMsg);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 营业部编号 */
+  SetNodeObjectString(isolate, obj, KEY_BRANCH_ID, data->BranchID);
+  /* 投资单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_INVEST_UNIT_ID, data->InvestUnitID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+  /* Mac地址 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_ADDRESS, data->MacAddress);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询交易所状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeSequenceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 交易所状态
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeSequenceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 序号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 合约交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MARKET_STATUS, data->MarketStatus);
+
+  return obj;
+}
+
+/**
+ * 根据价格查询最大报单数量
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQueryMaxOrderVolumeWithPriceField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 开平标志 */
+  SetNodeObjectChar(isolate, obj, KEY_OFFSET_FLAG, data->OffsetFlag);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 最大允许报单数量 */
+  SetNodeObjectInt(isolate, obj, KEY_MAX_VOLUME, data->MaxVolume);
+  /* 报单价格 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRICE, data->Price);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司交易参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerTradingParamsField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司交易参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerTradingParamsField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 保证金价格类型 */
+  SetNodeObjectChar(isolate, obj, KEY_MARGIN_PRICE_TYPE, data->MarginPriceType);
+  /* 盈亏算法 */
+  SetNodeObjectChar(isolate, obj, KEY_ALGORITHM, data->Algorithm);
+  /* 可用是否包含平仓盈利 */
+  SetNodeObjectChar(isolate, obj, KEY_AVAIL_INCLUDE_CLOSE_PROFIT,
+                    data->AvailIncludeCloseProfit);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 期权权利金价格类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OPTION_ROYALTY_PRICE_TYPE,
+                    data->OptionRoyaltyPriceType);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司交易算法
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerTradingAlgosField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司交易算法
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerTradingAlgosField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 持仓处理算法编号 */
+  SetNodeObjectChar(isolate, obj, KEY_HANDLE_POSITION_ALGO_ID,
+                    data->HandlePositionAlgoID);
+  /* 寻找保证金率算法编号 */
+  SetNodeObjectChar(isolate, obj, KEY_FIND_MARGIN_RATE_ALGO_ID,
+                    data->FindMarginRateAlgoID);
+  /* 资金处理算法编号 */
+  SetNodeObjectChar(isolate, obj, KEY_HANDLE_TRADING_ACCOUNT_ALGO_ID,
+                    data->HandleTradingAccountAlgoID);
+
+  return obj;
+}
+
+/**
+ * 查询经纪公司资金
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQueryBrokerDepositField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 经纪公司资金
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerDepositField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 会员代码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 上次结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_PRE_BALANCE, data->PreBalance);
+  /* 当前保证金总额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CURR_MARGIN, data->CurrMargin);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 期货结算准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_BALANCE, data->Balance);
+  /* 入金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_DEPOSIT, data->Deposit);
+  /* 出金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_WITHDRAW, data->Withdraw);
+  /* 可提资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_AVAILABLE, data->Available);
+  /* 基本准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE, data->Reserve);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+
+  return obj;
+}
+
+/**
+ * 查询保证金监管系统经纪公司密钥
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCFMMCBrokerKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+
+  return obj;
+}
+
+/**
+ * 保证金监管系统经纪公司密钥
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCFMMCBrokerKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 经纪公司统一编码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 密钥生成日期 */
+  SetNodeObjectString(isolate, obj, KEY_CREATE_DATE, data->CreateDate);
+  /* 密钥生成时间 */
+  SetNodeObjectString(isolate, obj, KEY_CREATE_TIME, data->CreateTime);
+  /* 密钥编号 */
+  SetNodeObjectInt(isolate, obj, KEY_KEY_ID, data->KeyID);
+  /* 动态密钥 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENT_KEY, data->CurrentKey);
+  /* 动态密钥类型 */
+  SetNodeObjectChar(isolate, obj, KEY_KEY_KIND, data->KeyKind);
+
+  return obj;
+}
+
+/**
+ * 保证金监管系统经纪公司资金账户密钥
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCFMMCTradingAccountKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 经纪公司统一编码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 密钥编号 */
+  SetNodeObjectInt(isolate, obj, KEY_KEY_ID, data->KeyID);
+  /* 动态密钥 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENT_KEY, data->CurrentKey);
+
+  return obj;
+}
+
+/**
+ * 请求查询保证金监管系统经纪公司资金账户密钥
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryCFMMCTradingAccountKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 用户动态令牌参数
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserOTPParamField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 动态令牌提供商 */
+  SetNodeObjectString(isolate, obj, KEY_OTPVENDORS_ID, data->OTPVendorsID);
+  /* 动态令牌序列号 */
+  SetNodeObjectString(isolate, obj, KEY_SERIAL_NUMBER, data->SerialNumber);
+  /* 令牌密钥 */
+  SetNodeObjectString(isolate, obj, KEY_AUTH_KEY, data->AuthKey);
+  /* 漂移值 */
+  SetNodeObjectInt(isolate, obj, KEY_LAST_DRIFT, data->LastDrift);
+  /* 成功值 */
+  SetNodeObjectInt(isolate, obj, KEY_LAST_SUCCESS, data->LastSuccess);
+  /* 动态令牌类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OTPTYPE, data->OTPType);
+
+  return obj;
+}
+
+/**
+ * 手工同步用户动态令牌
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcManualSyncBrokerUserOTPField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 动态令牌类型 */
+  SetNodeObjectChar(isolate, obj, KEY_OTPTYPE, data->OTPType);
+  /* 第一个动态密码 */
+  SetNodeObjectString(isolate, obj, KEY_FIRST_OTP, data->FirstOTP);
+  /* 第二个动态密码 */
+  SetNodeObjectString(isolate, obj, KEY_SECOND_OTP, data->SecondOTP);
+
+  return obj;
+}
+
+/**
+ * 投资者手续费率模板
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCommRateModelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 手续费率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMM_MODEL_ID, data->CommModelID);
+  /* 模板名称 */
+  SetNodeObjectString(isolate, obj, KEY_COMM_MODEL_NAME, data->CommModelName);
+
+  return obj;
+}
+
+/**
+ * 请求查询投资者手续费率模板
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCommRateModelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 手续费率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_COMM_MODEL_ID, data->CommModelID);
+
+  return obj;
+}
+
+/**
+ * 投资者保证金率模板
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarginModelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 保证金率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_MARGIN_MODEL_ID, data->MarginModelID);
+  /* 模板名称 */
+  SetNodeObjectString(isolate, obj, KEY_MARGIN_MODEL_NAME,
+                      data->MarginModelName);
+
+  return obj;
+}
+
+/**
+ * 请求查询投资者保证金率模板
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryMarginModelField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 保证金率模板代码 */
+  SetNodeObjectString(isolate, obj, KEY_MARGIN_MODEL_ID, data->MarginModelID);
+
+  return obj;
+}
+
+/**
+ * 仓单折抵信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcEWarrantOffsetField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+  /* 买卖方向 */
+  SetNodeObjectChar(isolate, obj, KEY_DIRECTION, data->Direction);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+  /* 数量 */
+  SetNodeObjectInt(isolate, obj, KEY_VOLUME, data->Volume);
+
+  return obj;
+}
+
+/**
+ * 查询仓单折抵信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryEWarrantOffsetField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 合约代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INSTRUMENT_ID,
+                              data->InstrumentID);
+
+  return obj;
+}
+
+/**
+ * 查询投资者品种/跨品种保证金
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryInvestorProductGroupMarginField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 品种/跨品种标示 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_GROUP_ID, data->ProductGroupID);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 投资者品种/跨品种保证金
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInvestorProductGroupMarginField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 品种/跨品种标示 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_GROUP_ID, data->ProductGroupID);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 结算编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SETTLEMENT_ID, data->SettlementID);
+  /* 冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_MARGIN, data->FrozenMargin);
+  /* 多头冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_FROZEN_MARGIN,
+                      data->LongFrozenMargin);
+  /* 空头冻结的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_FROZEN_MARGIN,
+                      data->ShortFrozenMargin);
+  /* 占用的保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_USE_MARGIN, data->UseMargin);
+  /* 多头保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_USE_MARGIN, data->LongUseMargin);
+  /* 空头保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_USE_MARGIN, data->ShortUseMargin);
+  /* 交易所保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_MARGIN, data->ExchMargin);
+  /* 交易所多头保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_EXCH_MARGIN, data->LongExchMargin);
+  /* 交易所空头保证金 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_EXCH_MARGIN,
+                      data->ShortExchMargin);
+  /* 平仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_CLOSE_PROFIT, data->CloseProfit);
+  /* 冻结的手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_COMMISSION,
+                      data->FrozenCommission);
+  /* 手续费 */
+  SetNodeObjectDouble(isolate, obj, KEY_COMMISSION, data->Commission);
+  /* 冻结的资金 */
+  SetNodeObjectDouble(isolate, obj, KEY_FROZEN_CASH, data->FrozenCash);
+  /* 资金差额 */
+  SetNodeObjectDouble(isolate, obj, KEY_CASH_IN, data->CashIn);
+  /* 持仓盈亏 */
+  SetNodeObjectDouble(isolate, obj, KEY_POSITION_PROFIT, data->PositionProfit);
+  /* 折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_OFFSET_AMOUNT, data->OffsetAmount);
+  /* 多头折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_OFFSET_AMOUNT,
+                      data->LongOffsetAmount);
+  /* 空头折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_OFFSET_AMOUNT,
+                      data->ShortOffsetAmount);
+  /* 交易所折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_EXCH_OFFSET_AMOUNT,
+                      data->ExchOffsetAmount);
+  /* 交易所多头折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_LONG_EXCH_OFFSET_AMOUNT,
+                      data->LongExchOffsetAmount);
+  /* 交易所空头折抵总金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_SHORT_EXCH_OFFSET_AMOUNT,
+                      data->ShortExchOffsetAmount);
+  /* 投机套保标志 */
+  SetNodeObjectChar(isolate, obj, KEY_HEDGE_FLAG, data->HedgeFlag);
+
+  return obj;
+}
+
+/**
+ * 查询监控中心用户令牌
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQueryCFMMCTradingAccountTokenField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+
+  return obj;
+}
+
+/**
+ * 监控中心用户令牌
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcCFMMCTradingAccountTokenField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 经纪公司统一编码 */
+  SetNodeObjectString(isolate, obj, KEY_PARTICIPANT_ID, data->ParticipantID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 密钥编号 */
+  SetNodeObjectInt(isolate, obj, KEY_KEY_ID, data->KeyID);
+  /* 动态令牌 */
+  SetNodeObjectString(isolate, obj, KEY_TOKEN, data->Token);
+
+  return obj;
+}
+
+/**
+ * 投资者指令权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstructionRightField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 指令权限类型 */
+  SetNodeObjectChar(isolate, obj, KEY_INSTRUCTION_RIGHT,
+                    data->InstructionRight);
+  /* 是否禁止 */
+  SetNodeObjectInt(isolate, obj, KEY_IS_FORBIDDEN, data->IsForbidden);
+
+  return obj;
+}
+
+/**
+ * 查询产品组
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductGroupField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+
+  return obj;
+}
+
+/**
+ * 投资者品种/跨品种保证金产品组
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductGroupField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 产品代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_ID, data->ProductID);
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 产品组代码 */
+  SetNodeObjectString(isolate, obj, KEY_PRODUCT_GROUP_ID, data->ProductGroupID);
+
+  return obj;
+}
+
+/**
+ * 交易所公告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBulletinField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 交易日 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 公告编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BULLETIN_ID, data->BulletinID);
+  /* 序列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 公告类型 */
+  SetNodeObjectString(isolate, obj, KEY_NEWS_TYPE, data->NewsType);
+  /* 紧急程度 */
+  SetNodeObjectChar(isolate, obj, KEY_NEWS_URGENCY, data->NewsUrgency);
+  /* 发送时间 */
+  SetNodeObjectString(isolate, obj, KEY_SEND_TIME, data->SendTime);
+  /* 消息摘要 */
+  SetNodeObjectString(isolate, obj, KEY_ABSTRACT, data->Abstract);
+  /* 消息来源 */
+  SetNodeObjectString(isolate, obj, KEY_COME_FROM, data->ComeFrom);
+  /* 消息正文 */
+  SetNodeObjectString(isolate, obj, KEY_CONTENT, data->Content);
+  /* WEB地址 */
+  SetNodeObjectString(isolate, obj, KEY_URLLINK, data->URLLink);
+  /* 市场代码 */
+  SetNodeObjectString(isolate, obj, KEY_MARKET_ID, data->MarketID);
+
+  return obj;
+}
+
+/**
+ * 查询交易所公告
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBulletinField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易所代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_EXCHANGE_ID, data->ExchangeID);
+  /* 公告编号 */
+  SetNodeObjectInt(isolate, obj, KEY_BULLETIN_ID, data->BulletinID);
+  /* 序列号 */
+  SetNodeObjectInt(isolate, obj, KEY_SEQUENCE_NO, data->SequenceNo);
+  /* 公告类型 */
+  SetNodeObjectString(isolate, obj, KEY_NEWS_TYPE, data->NewsType);
+  /* 紧急程度 */
+  SetNodeObjectChar(isolate, obj, KEY_NEWS_URGENCY, data->NewsUrgency);
+
+  return obj;
+}
+
+/**
+ * 转帐开户请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqOpenAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 汇钞标志 */
+  SetNodeObjectChar(isolate, obj, KEY_CASH_EXCHANGE_CODE,
+                    data->CashExchangeCode);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 转帐销户请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqCancelAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 汇钞标志 */
+  SetNodeObjectChar(isolate, obj, KEY_CASH_EXCHANGE_CODE,
+                    data->CashExchangeCode);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * 变更银行账户请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqChangeAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 新银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_BANK_ACCOUNT, data->NewBankAccount);
+  /* 新银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_BANK_PASS_WORD,
+                      data->NewBankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+
+  return obj;
+}
+
+/**
+ * 转账请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqTransferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 期货可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUTURE_FETCH_AMOUNT,
+                      data->FutureFetchAmount);
+  /* 费用支付标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FEE_PAY_FLAG, data->FeePayFlag);
+  /* 应收客户费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 应收期货公司费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_BROKER_FEE, data->BrokerFee);
+  /* 发送方给接收方的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 转账交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRANSFER_STATUS, data->TransferStatus);
+
+  return obj;
+}
+
+/**
+ * 银行发起银行资金转期货响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspTransferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 期货可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUTURE_FETCH_AMOUNT,
+                      data->FutureFetchAmount);
+  /* 费用支付标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FEE_PAY_FLAG, data->FeePayFlag);
+  /* 应收客户费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 应收期货公司费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_BROKER_FEE, data->BrokerFee);
+  /* 发送方给接收方的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 转账交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRANSFER_STATUS, data->TransferStatus);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 冲正请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqRepealField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 冲正时间间隔 */
+  SetNodeObjectInt(isolate, obj, KEY_REPEAL_TIME_INTERVAL,
+                   data->RepealTimeInterval);
+  /* 已经冲正次数 */
+  SetNodeObjectInt(isolate, obj, KEY_REPEALED_TIMES, data->RepealedTimes);
+  /* 银行冲正标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_REPEAL_FLAG, data->BankRepealFlag);
+  /* 期商冲正标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BROKER_REPEAL_FLAG,
+                    data->BrokerRepealFlag);
+  /* 被冲正平台流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_REPEAL_SERIAL,
+                   data->PlateRepealSerial);
+  /* 被冲正银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_REPEAL_SERIAL,
+                      data->BankRepealSerial);
+  /* 被冲正期货流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_REPEAL_SERIAL,
+                   data->FutureRepealSerial);
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 期货可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUTURE_FETCH_AMOUNT,
+                      data->FutureFetchAmount);
+  /* 费用支付标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FEE_PAY_FLAG, data->FeePayFlag);
+  /* 应收客户费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 应收期货公司费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_BROKER_FEE, data->BrokerFee);
+  /* 发送方给接收方的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 转账交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRANSFER_STATUS, data->TransferStatus);
+
+  return obj;
+}
+
+/**
+ * 冲正响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspRepealField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 冲正时间间隔 */
+  SetNodeObjectInt(isolate, obj, KEY_REPEAL_TIME_INTERVAL,
+                   data->RepealTimeInterval);
+  /* 已经冲正次数 */
+  SetNodeObjectInt(isolate, obj, KEY_REPEALED_TIMES, data->RepealedTimes);
+  /* 银行冲正标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_REPEAL_FLAG, data->BankRepealFlag);
+  /* 期商冲正标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BROKER_REPEAL_FLAG,
+                    data->BrokerRepealFlag);
+  /* 被冲正平台流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_REPEAL_SERIAL,
+                   data->PlateRepealSerial);
+  /* 被冲正银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_REPEAL_SERIAL,
+                      data->BankRepealSerial);
+  /* 被冲正期货流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_REPEAL_SERIAL,
+                   data->FutureRepealSerial);
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 期货可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_FUTURE_FETCH_AMOUNT,
+                      data->FutureFetchAmount);
+  /* 费用支付标志 */
+  SetNodeObjectChar(isolate, obj, KEY_FEE_PAY_FLAG, data->FeePayFlag);
+  /* 应收客户费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 应收期货公司费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_BROKER_FEE, data->BrokerFee);
+  /* 发送方给接收方的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 转账交易状态 */
+  SetNodeObjectChar(isolate, obj, KEY_TRANSFER_STATUS, data->TransferStatus);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询账户信息请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqQueryAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+
+  return obj;
+}
+
+/**
+ * 查询账户信息响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspQueryAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 银行可用金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_BANK_USE_AMOUNT, data->BankUseAmount);
+  /* 银行可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_BANK_FETCH_AMOUNT,
+                      data->BankFetchAmount);
+
+  return obj;
+}
+
+/**
+ * 期商签到签退
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFutureSignIOField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+
+  return obj;
+}
+
+/**
+ * 期商签到响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspFutureSignInField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* PIN密钥 */
+  SetNodeObjectString(isolate, obj, KEY_PIN_KEY, data->PinKey);
+  /* MAC密钥 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_KEY, data->MacKey);
+
+  return obj;
+}
+
+/**
+ * 期商签退请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqFutureSignOutField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+
+  return obj;
+}
+
+/**
+ * 期商签退响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspFutureSignOutField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询指定流水号的交易结果请求
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcReqQueryTradeResultBySerialField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_REFERENCE, data->Reference);
+  /* 本流水号发布者的机构类型 */
+  SetNodeObjectChar(isolate, obj, KEY_REFRENCE_ISSURE_TYPE,
+                    data->RefrenceIssureType);
+  /* 本流水号发布者机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_REFRENCE_ISSURE, data->RefrenceIssure);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+
+  return obj;
+}
+
+/**
+ * 查询指定流水号的交易结果响应
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcRspQueryTradeResultBySerialField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* 流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_REFERENCE, data->Reference);
+  /* 本流水号发布者的机构类型 */
+  SetNodeObjectChar(isolate, obj, KEY_REFRENCE_ISSURE_TYPE,
+                    data->RefrenceIssureType);
+  /* 本流水号发布者机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_REFRENCE_ISSURE, data->RefrenceIssure);
+  /* 原始返回代码 */
+  SetNodeObjectString(isolate, obj, KEY_ORIGIN_RETURN_CODE,
+                      data->OriginReturnCode);
+  /* 原始返回码描述 */
+  SetNodeObjectString(isolate, obj, KEY_ORIGIN_DESCR_INFO_FOR_RETURN_CODE,
+                      data->OriginDescrInfoForReturnCode);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 转帐金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+
+  return obj;
+}
+
+/**
+ * 日终文件就绪请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqDayEndFileReadyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 文件业务功能 */
+  SetNodeObjectChar(isolate, obj, KEY_FILE_BUSINESS_CODE,
+                    data->FileBusinessCode);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+
+  return obj;
+}
+
+/**
+ * 返回结果
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReturnResultField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 返回代码 */
+  SetNodeObjectString(isolate, obj, KEY_RETURN_CODE, data->ReturnCode);
+  /* 返回码描述 */
+  SetNodeObjectString(isolate, obj, KEY_DESCR_INFO_FOR_RETURN_CODE,
+                      data->DescrInfoForReturnCode);
+
+  return obj;
+}
+
+/**
+ * 验证期货资金密码
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyFuturePasswordField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 验证客户信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyCustInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+
+  return obj;
+}
+
+/**
+ * 验证期货资金密码和客户信息
+ */
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcVerifyFuturePasswordAndCustInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 验证期货资金密码和客户信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDepositResultInformField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 出入金流水号，该流水号为银期报盘返回的流水号 */
+  SetNodeObjectString(isolate, obj, KEY_DEPOSIT_SEQ_NO, data->DepositSeqNo);
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 入金金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_DEPOSIT, data->Deposit);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 返回代码 */
+  SetNodeObjectString(isolate, obj, KEY_RETURN_CODE, data->ReturnCode);
+  /* 返回码描述 */
+  SetNodeObjectString(isolate, obj, KEY_DESCR_INFO_FOR_RETURN_CODE,
+                      data->DescrInfoForReturnCode);
+
+  return obj;
+}
+
+/**
+ * 交易核心向银期报盘发出密钥同步请求
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqSyncKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易核心给银期报盘的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+
+  return obj;
+}
+
+/**
+ * 交易核心向银期报盘发出密钥同步响应
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspSyncKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易核心给银期报盘的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 查询账户信息通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyQueryAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 银行可用金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_BANK_USE_AMOUNT, data->BankUseAmount);
+  /* 银行可取金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_BANK_FETCH_AMOUNT,
+                      data->BankFetchAmount);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 银期转账交易流水表
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferSerialField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 平台流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 交易发起方日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 交易代码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 会话编号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 期货公司编码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 期货公司帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_FUTURE_ACC_TYPE, data->FutureAccType);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 投资者代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_INVESTOR_ID, data->InvestorID);
+  /* 期货公司流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_FUTURE_SERIAL, data->FutureSerial);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 交易金额 */
+  SetNodeObjectDouble(isolate, obj, KEY_TRADE_AMOUNT, data->TradeAmount);
+  /* 应收客户费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_CUST_FEE, data->CustFee);
+  /* 应收期货公司费用 */
+  SetNodeObjectDouble(isolate, obj, KEY_BROKER_FEE, data->BrokerFee);
+  /* 有效标志 */
+  SetNodeObjectChar(isolate, obj, KEY_AVAILABILITY_FLAG,
+                    data->AvailabilityFlag);
+  /* 操作员 */
+  SetNodeObjectString(isolate, obj, KEY_OPERATOR_CODE, data->OperatorCode);
+  /* 新银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_NEW_ACCOUNT, data->BankNewAccount);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 请求查询转帐流水
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTransferSerialField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 期商签到通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyFutureSignInField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+  /* PIN密钥 */
+  SetNodeObjectString(isolate, obj, KEY_PIN_KEY, data->PinKey);
+  /* MAC密钥 */
+  SetNodeObjectString(isolate, obj, KEY_MAC_KEY, data->MacKey);
+
+  return obj;
+}
+
+/**
+ * 期商签退通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyFutureSignOutField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 交易核心向银期报盘发出密钥同步处理结果的通知
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifySyncKeyField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易核心给银期报盘的消息 */
+  SetNodeObjectString(isolate, obj, KEY_MESSAGE, data->Message);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 请求编号 */
+  SetNodeObjectInt(isolate, obj, KEY_REQUEST_ID, data->RequestID);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 请求查询银期签约关系
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryAccountregisterField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 客户开销户信息表
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcAccountregisterField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DAY, data->TradeDay);
+  /* 银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 期货公司编码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期货公司分支机构编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 开销户类别 */
+  SetNodeObjectChar(isolate, obj, KEY_OPEN_OR_DESTROY, data->OpenOrDestroy);
+  /* 签约日期 */
+  SetNodeObjectString(isolate, obj, KEY_REG_DATE, data->RegDate);
+  /* 解约日期 */
+  SetNodeObjectString(isolate, obj, KEY_OUT_DATE, data->OutDate);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+
+  return obj;
+}
+
+/**
+ * 银期开户信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOpenAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 汇钞标志 */
+  SetNodeObjectChar(isolate, obj, KEY_CASH_EXCHANGE_CODE,
+                    data->CashExchangeCode);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 银期销户信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCancelAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 汇钞标志 */
+  SetNodeObjectChar(isolate, obj, KEY_CASH_EXCHANGE_CODE,
+                    data->CashExchangeCode);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 渠道标志 */
+  SetNodeObjectString(isolate, obj, KEY_DEVICE_ID, data->DeviceID);
+  /* 期货单位帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_SECU_ACC_TYPE,
+                    data->BankSecuAccType);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 期货单位帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SECU_ACC, data->BankSecuAcc);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易柜员 */
+  SetNodeObjectString(isolate, obj, KEY_OPER_NO, data->OperNo);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 用户标识 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 银期变更银行账号信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcChangeAccountField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 业务功能码 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_CODE, data->TradeCode);
+  /* 银行代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ID, data->BankID);
+  /* 银行分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_BRANCH_ID, data->BankBranchID);
+  /* 期商代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 期商分支机构代码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_BRANCH_ID, data->BrokerBranchID);
+  /* 交易日期 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_DATE, data->TradeDate);
+  /* 交易时间 */
+  SetNodeObjectString(isolate, obj, KEY_TRADE_TIME, data->TradeTime);
+  /* 银行流水号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_SERIAL, data->BankSerial);
+  /* 交易系统日期 */
+  SetNodeObjectInternedString(isolate, obj, KEY_TRADING_DAY, data->TradingDay);
+  /* 银期平台消息流水号 */
+  SetNodeObjectInt(isolate, obj, KEY_PLATE_SERIAL, data->PlateSerial);
+  /* 最后分片标志 */
+  SetNodeObjectChar(isolate, obj, KEY_LAST_FRAGMENT, data->LastFragment);
+  /* 会话号 */
+  SetNodeObjectInt(isolate, obj, KEY_SESSION_ID, data->SessionID);
+  /* 客户姓名 */
+  SetNodeObjectString(isolate, obj, KEY_CUSTOMER_NAME, data->CustomerName);
+  /* 证件类型 */
+  SetNodeObjectChar(isolate, obj, KEY_ID_CARD_TYPE, data->IdCardType);
+  /* 证件号码 */
+  SetNodeObjectString(isolate, obj, KEY_IDENTIFIED_CARD_NO,
+                      data->IdentifiedCardNo);
+  /* 性别 */
+  SetNodeObjectChar(isolate, obj, KEY_GENDER, data->Gender);
+  /* 国家代码 */
+  SetNodeObjectString(isolate, obj, KEY_COUNTRY_CODE, data->CountryCode);
+  /* 客户类型 */
+  SetNodeObjectChar(isolate, obj, KEY_CUST_TYPE, data->CustType);
+  /* 地址 */
+  SetNodeObjectString(isolate, obj, KEY_ADDRESS, data->Address);
+  /* 邮编 */
+  SetNodeObjectString(isolate, obj, KEY_ZIP_CODE, data->ZipCode);
+  /* 电话号码 */
+  SetNodeObjectString(isolate, obj, KEY_TELEPHONE, data->Telephone);
+  /* 手机 */
+  SetNodeObjectString(isolate, obj, KEY_MOBILE_PHONE, data->MobilePhone);
+  /* 传真 */
+  SetNodeObjectString(isolate, obj, KEY_FAX, data->Fax);
+  /* 电子邮件 */
+  SetNodeObjectString(isolate, obj, KEY_EMAIL, data->EMail);
+  /* 资金账户状态 */
+  SetNodeObjectChar(isolate, obj, KEY_MONEY_ACCOUNT_STATUS,
+                    data->MoneyAccountStatus);
+  /* 银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_ACCOUNT, data->BankAccount);
+  /* 银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_BANK_PASS_WORD, data->BankPassWord);
+  /* 新银行帐号 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_BANK_ACCOUNT, data->NewBankAccount);
+  /* 新银行密码 */
+  SetNodeObjectString(isolate, obj, KEY_NEW_BANK_PASS_WORD,
+                      data->NewBankPassWord);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 期货密码 */
+  SetNodeObjectString(isolate, obj, KEY_PASSWORD, data->Password);
+  /* 银行帐号类型 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_ACC_TYPE, data->BankAccType);
+  /* 安装编号 */
+  SetNodeObjectInt(isolate, obj, KEY_INSTALL_ID, data->InstallID);
+  /* 验证客户证件号码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_VERIFY_CERT_NO_FLAG,
+                    data->VerifyCertNoFlag);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 期货公司银行编码 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_IDBY_BANK, data->BrokerIDByBank);
+  /* 银行密码标志 */
+  SetNodeObjectChar(isolate, obj, KEY_BANK_PWD_FLAG, data->BankPwdFlag);
+  /* 期货资金密码核对标志 */
+  SetNodeObjectChar(isolate, obj, KEY_SECU_PWD_FLAG, data->SecuPwdFlag);
+  /* 交易ID */
+  SetNodeObjectInt(isolate, obj, KEY_TID, data->TID);
+  /* 摘要 */
+  SetNodeObjectString(isolate, obj, KEY_DIGEST, data->Digest);
+  /* 错误代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ERROR_ID, data->ErrorID);
+  /* 错误信息 */
+  SetNodeObjectString(isolate, obj, KEY_ERROR_MSG, data->ErrorMsg);
+
+  return obj;
+}
+
+/**
+ * 二级代理操作员银期权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSecAgentACIDMapField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+  /* 境外中介机构资金帐号 */
+  SetNodeObjectString(isolate, obj, KEY_BROKER_SEC_AGENT_ID,
+                      data->BrokerSecAgentID);
+
+  return obj;
+}
+
+/**
+ * 二级代理操作员银期权限查询
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySecAgentACIDMapField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 资金账户 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 币种 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * 灾备中心交易权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserRightsAssignField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 应用单元代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 交易中心代码 */
+  SetNodeObjectInt(isolate, obj, KEY_DRIDENTITY_ID, data->DRIdentityID);
+
+  return obj;
+}
+
+/**
+ * 经济公司是否有在本标示的交易权限
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserRightAssignField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 应用单元代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 交易中心代码 */
+  SetNodeObjectInt(isolate, obj, KEY_DRIDENTITY_ID, data->DRIdentityID);
+  /* 能否交易 */
+  SetNodeObjectInt(isolate, obj, KEY_TRADEABLE, data->Tradeable);
+
+  return obj;
+}
+
+/**
+ * 灾备交易转换报文
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDRTransferField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 原交易中心代码 */
+  SetNodeObjectInt(isolate, obj, KEY_ORIG_DRIDENTITY_ID,
+                   data->OrigDRIdentityID);
+  /* 目标交易中心代码 */
+  SetNodeObjectInt(isolate, obj, KEY_DEST_DRIDENTITY_ID,
+                   data->DestDRIdentityID);
+  /* 原应用单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_ORIG_BROKER_ID, data->OrigBrokerID);
+  /* 目标易用单元代码 */
+  SetNodeObjectString(isolate, obj, KEY_DEST_BROKER_ID, data->DestBrokerID);
+
+  return obj;
+}
+
+/**
+ * Fens用户信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFensUserInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* 登录模式 */
+  SetNodeObjectChar(isolate, obj, KEY_LOGIN_MODE, data->LoginMode);
+
+  return obj;
+}
+
+/**
+ * 当前银期所属交易中心
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCurrTransferIdentityField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 交易中心代码 */
+  SetNodeObjectInt(isolate, obj, KEY_IDENTITY_ID, data->IdentityID);
+
+  return obj;
+}
+
+/**
+ * 禁止登录用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoginForbiddenUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+  /* IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_IPADDRESS, data->IPAddress);
+
+  return obj;
+}
+
+/**
+ * 查询禁止登录用户
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLoginForbiddenUserField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 用户代码 */
+  SetNodeObjectString(isolate, obj, KEY_USER_ID, data->UserID);
+
+  return obj;
+}
+
+/**
+ * UDP组播组信息
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMulticastGroupInfoField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 组播组IP地址 */
+  SetNodeObjectString(isolate, obj, KEY_GROUP_IP, data->GroupIP);
+  /* 组播组IP端口 */
+  SetNodeObjectInt(isolate, obj, KEY_GROUP_PORT, data->GroupPort);
+  /* 源地址 */
+  SetNodeObjectString(isolate, obj, KEY_SOURCE_IP, data->SourceIP);
+
+  return obj;
+}
+
+/**
+ * 资金账户基本准备金
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountReserveField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* 经纪公司代码 */
+  SetNodeObjectInternedString(isolate, obj, KEY_BROKER_ID, data->BrokerID);
+  /* 投资者帐号 */
+  SetNodeObjectString(isolate, obj, KEY_ACCOUNT_ID, data->AccountID);
+  /* 基本准备金 */
+  SetNodeObjectDouble(isolate, obj, KEY_RESERVE, data->Reserve);
+  /* 币种代码 */
+  SetNodeObjectString(isolate, obj, KEY_CURRENCY_ID, data->CurrencyID);
+
+  return obj;
+}
+
+/**
+ * DBF记录
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDBFRecordField *data) {
+  Local<Object> obj = Object::New(isolate);
+  if (!data) {
+    return obj;
+  }
+
+  /* DBF命令类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFCOMD_TYPE, data->DBFComdType);
+  /* DBF时间类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFCOM_TIME, data->DBFComTime);
+  /* DBF原始流水号类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFOCOM_NO, data->DBFOComNo);
+  /* DBF流水号类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFCOM_NO, data->DBFComNo);
+  /* DBF字段类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_NAME1, data->DBFFdName1);
+  /* DBF字段内容类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_CONTENT1, data->DBFFdContent1);
+  /* DBF字段类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_NAME2, data->DBFFdName2);
+  /* DBF字段内容类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_CONTENT2, data->DBFFdContent2);
+  /* DBF字段类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_NAME3, data->DBFFdName3);
+  /* DBF字段内容类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_CONTENT3, data->DBFFdContent3);
+  /* DBF字段类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_NAME4, data->DBFFdName4);
+  /* DBF字段内容类型 */
+  SetNodeObjectString(isolate, obj, KEY_DBFFD_CONTENT4, data->DBFFdContent4);
+
+  return obj;
+}
+
+} /* namespace node_ctp */
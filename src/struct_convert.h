@@ -0,0 +1,1441 @@
+#ifndef STRUCT_CONVERT_H
+#define STRUCT_CONVERT_H
+
+#include <node.h>
+#include <cstddef>
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+#include "intern_table.h"
+
+/* 此文件中代码使用misc/code_creater生成, 不要手动修改 */
+
+namespace node_ctp {
+
+using namespace v8;
+
+/**
+ * Node层对象属性名, 由CTP结构体的全部字段名去重生成
+ */
+enum ObjectKey {
+  KEY_ABANDON_FROZEN = 0,
+  KEY_ABSTRACT = 1,
+  KEY_ACCOUNT_ID = 2,
+  KEY_ACTION_DATE = 3,
+  KEY_ACTION_DAY = 4,
+  KEY_ACTION_FLAG = 5,
+  KEY_ACTION_LOCAL_ID = 6,
+  KEY_ACTION_STATUS = 7,
+  KEY_ACTION_TIME = 8,
+  KEY_ACTION_TYPE = 9,
+  KEY_ACTIVE_TIME = 10,
+  KEY_ACTIVE_TRADER_ID = 11,
+  KEY_ACTIVE_USER_ID = 12,
+  KEY_ADDRESS = 13,
+  KEY_ALGORITHM = 14,
+  KEY_ALL_WITHOUT_TRADE = 15,
+  KEY_ASHORT_MARGIN_RATIO_BY_MONEY = 16,
+  KEY_ASHORT_MARGIN_RATIO_BY_VOLUME = 17,
+  KEY_ASK_HEDGE_FLAG = 18,
+  KEY_ASK_OFFSET_FLAG = 19,
+  KEY_ASK_ORDER_REF = 20,
+  KEY_ASK_ORDER_SYS_ID = 21,
+  KEY_ASK_PRICE = 22,
+  KEY_ASK_PRICE1 = 23,
+  KEY_ASK_PRICE2 = 24,
+  KEY_ASK_PRICE3 = 25,
+  KEY_ASK_PRICE4 = 26,
+  KEY_ASK_PRICE5 = 27,
+  KEY_ASK_VOLUME = 28,
+  KEY_ASK_VOLUME1 = 29,
+  KEY_ASK_VOLUME2 = 30,
+  KEY_ASK_VOLUME3 = 31,
+  KEY_ASK_VOLUME4 = 32,
+  KEY_ASK_VOLUME5 = 33,
+  KEY_AUTH_CODE = 34,
+  KEY_AUTH_INFO = 35,
+  KEY_AUTH_KEY = 36,
+  KEY_AVAILABILITY_FLAG = 37,
+  KEY_AVAILABLE = 38,
+  KEY_AVAIL_INCLUDE_CLOSE_PROFIT = 39,
+  KEY_AVERAGE_PRICE = 40,
+  KEY_BALANCE = 41,
+  KEY_BALANCE_ALGORITHM = 42,
+  KEY_BANK_ACCOUNT = 43,
+  KEY_BANK_ACC_TYPE = 44,
+  KEY_BANK_BRANCH_ID = 45,
+  KEY_BANK_BRCH_ID = 46,
+  KEY_BANK_FETCH_AMOUNT = 47,
+  KEY_BANK_ID = 48,
+  KEY_BANK_NAME = 49,
+  KEY_BANK_NEW_ACCOUNT = 50,
+  KEY_BANK_PASS_WORD = 51,
+  KEY_BANK_PWD_FLAG = 52,
+  KEY_BANK_REPEAL_FLAG = 53,
+  KEY_BANK_REPEAL_SERIAL = 54,
+  KEY_BANK_SECU_ACC = 55,
+  KEY_BANK_SECU_ACC_TYPE = 56,
+  KEY_BANK_SERIAL = 57,
+  KEY_BANK_USE_AMOUNT = 58,
+  KEY_BID_HEDGE_FLAG = 59,
+  KEY_BID_OFFSET_FLAG = 60,
+  KEY_BID_ORDER_REF = 61,
+  KEY_BID_ORDER_SYS_ID = 62,
+  KEY_BID_PRICE = 63,
+  KEY_BID_PRICE1 = 64,
+  KEY_BID_PRICE2 = 65,
+  KEY_BID_PRICE3 = 66,
+  KEY_BID_PRICE4 = 67,
+  KEY_BID_PRICE5 = 68,
+  KEY_BID_VOLUME = 69,
+  KEY_BID_VOLUME1 = 70,
+  KEY_BID_VOLUME2 = 71,
+  KEY_BID_VOLUME3 = 72,
+  KEY_BID_VOLUME4 = 73,
+  KEY_BID_VOLUME5 = 74,
+  KEY_BIZ_TYPE = 75,
+  KEY_BRANCH_ID = 76,
+  KEY_BROKER_ABBR = 77,
+  KEY_BROKER_BRANCH_ID = 78,
+  KEY_BROKER_EXEC_ORDER_SEQ = 79,
+  KEY_BROKER_FEE = 80,
+  KEY_BROKER_FOR_QUTO_SEQ = 81,
+  KEY_BROKER_FUNCTION_CODE = 82,
+  KEY_BROKER_ID = 83,
+  KEY_BROKER_IDBY_BANK = 84,
+  KEY_BROKER_LOCK_SEQ = 85,
+  KEY_BROKER_NAME = 86,
+  KEY_BROKER_ORDER_SEQ = 87,
+  KEY_BROKER_QUOTE_SEQ = 88,
+  KEY_BROKER_REPEAL_FLAG = 89,
+  KEY_BROKER_SEC_AGENT_ID = 90,
+  KEY_BULLETIN_ID = 91,
+  KEY_BUSINESS_UNIT = 92,
+  KEY_CANCEL_TIME = 93,
+  KEY_CASH_EXCHANGE_CODE = 94,
+  KEY_CASH_IN = 95,
+  KEY_CERT_CODE = 96,
+  KEY_CLEARING_PART_ID = 97,
+  KEY_CLIENT_ID = 98,
+  KEY_CLIENT_IDTYPE = 99,
+  KEY_CLIENT_IPADDRESS = 100,
+  KEY_CLOSE_AMOUNT = 101,
+  KEY_CLOSE_DEAL_TYPE = 102,
+  KEY_CLOSE_FLAG = 103,
+  KEY_CLOSE_PRICE = 104,
+  KEY_CLOSE_PROFIT = 105,
+  KEY_CLOSE_PROFIT_BY_DATE = 106,
+  KEY_CLOSE_PROFIT_BY_TRADE = 107,
+  KEY_CLOSE_RATIO_BY_MONEY = 108,
+  KEY_CLOSE_RATIO_BY_VOLUME = 109,
+  KEY_CLOSE_TODAY_RATIO_BY_MONEY = 110,
+  KEY_CLOSE_TODAY_RATIO_BY_VOLUME = 111,
+  KEY_CLOSE_VOLUME = 112,
+  KEY_COMBINATION_TYPE = 113,
+  KEY_COMB_ACTION_REF = 114,
+  KEY_COMB_DIRECTION = 115,
+  KEY_COMB_HEDGE_FLAG = 116,
+  KEY_COMB_INSTRUMENT_ID = 117,
+  KEY_COMB_LONG_FROZEN = 118,
+  KEY_COMB_OFFSET_FLAG = 119,
+  KEY_COMB_POSITION = 120,
+  KEY_COMB_SHORT_FROZEN = 121,
+  KEY_COME_FROM = 122,
+  KEY_COMMISSION = 123,
+  KEY_COMM_MODEL_ID = 124,
+  KEY_COMM_MODEL_NAME = 125,
+  KEY_COMM_PHASE_NO = 126,
+  KEY_COM_TRADE_ID = 127,
+  KEY_CONFIRM_DATE = 128,
+  KEY_CONFIRM_TIME = 129,
+  KEY_CONNECT_DATE = 130,
+  KEY_CONNECT_REQUEST_DATE = 131,
+  KEY_CONNECT_REQUEST_TIME = 132,
+  KEY_CONNECT_TIME = 133,
+  KEY_CONTENT = 134,
+  KEY_CONTINGENT_CONDITION = 135,
+  KEY_COUNTRY_CODE = 136,
+  KEY_CREATE_DATE = 137,
+  KEY_CREATE_TIME = 138,
+  KEY_CREDIT = 139,
+  KEY_CURRENCY_CODE = 140,
+  KEY_CURRENCY_ID = 141,
+  KEY_CURRENT_KEY = 142,
+  KEY_CURR_DATE = 143,
+  KEY_CURR_DELTA = 144,
+  KEY_CURR_MARGIN = 145,
+  KEY_CURR_MILLISEC = 146,
+  KEY_CURR_TIME = 147,
+  KEY_CUSTOMER_NAME = 148,
+  KEY_CUST_FEE = 149,
+  KEY_CUST_TYPE = 150,
+  KEY_CZCETIME = 151,
+  KEY_DATA_SYNC_STATUS = 152,
+  KEY_DBFCOMD_TYPE = 153,
+  KEY_DBFCOM_NO = 154,
+  KEY_DBFCOM_TIME = 155,
+  KEY_DBFFD_CONTENT1 = 156,
+  KEY_DBFFD_CONTENT2 = 157,
+  KEY_DBFFD_CONTENT3 = 158,
+  KEY_DBFFD_CONTENT4 = 159,
+  KEY_DBFFD_NAME1 = 160,
+  KEY_DBFFD_NAME2 = 161,
+  KEY_DBFFD_NAME3 = 162,
+  KEY_DBFFD_NAME4 = 163,
+  KEY_DBFOCOM_NO = 164,
+  KEY_DCETIME = 165,
+  KEY_DELIVERY_MARGIN = 166,
+  KEY_DELIVERY_MONTH = 167,
+  KEY_DELIVERY_YEAR = 168,
+  KEY_DELTA = 169,
+  KEY_DEPOSIT = 170,
+  KEY_DEPOSIT_SEQ_NO = 171,
+  KEY_DESCR_INFO_FOR_RETURN_CODE = 172,
+  KEY_DESIGNATE_LOCAL_ID = 173,
+  KEY_DESIGNATE_REF = 174,
+  KEY_DESIGNATE_STATUS = 175,
+  KEY_DESIGNATE_TYPE = 176,
+  KEY_DEST_BROKER_ID = 177,
+  KEY_DEST_DRIDENTITY_ID = 178,
+  KEY_DEVICE_ID = 179,
+  KEY_DIGEST = 180,
+  KEY_DIRECTION = 181,
+  KEY_DISCOUNT = 182,
+  KEY_DRIDENTITY_ID = 183,
+  KEY_EMAIL = 184,
+  KEY_END_DELIV_DATE = 185,
+  KEY_ENTER_REASON = 186,
+  KEY_ENTER_TIME = 187,
+  KEY_ERROR_ID = 188,
+  KEY_ERROR_MSG = 189,
+  KEY_EVENT_DATE = 190,
+  KEY_EVENT_SEQUENCE_NO = 191,
+  KEY_EVENT_TIME = 192,
+  KEY_EXCHANGE_DELIVERY_MARGIN = 193,
+  KEY_EXCHANGE_ID = 194,
+  KEY_EXCHANGE_INST_ID = 195,
+  KEY_EXCHANGE_MARGIN = 196,
+  KEY_EXCHANGE_NAME = 197,
+  KEY_EXCHANGE_PRODUCT_ID = 198,
+  KEY_EXCHANGE_PROPERTY = 199,
+  KEY_EXCHANGE_RATE = 200,
+  KEY_EXCH_FIXED_MARGIN = 201,
+  KEY_EXCH_LONG_MARGIN_RATIO_BY_MONEY = 202,
+  KEY_EXCH_LONG_MARGIN_RATIO_BY_VOLUME = 203,
+  KEY_EXCH_MARGIN = 204,
+  KEY_EXCH_MINI_MARGIN = 205,
+  KEY_EXCH_OFFSET_AMOUNT = 206,
+  KEY_EXCH_SHORT_MARGIN_RATIO_BY_MONEY = 207,
+  KEY_EXCH_SHORT_MARGIN_RATIO_BY_VOLUME = 208,
+  KEY_EXEC_ORDER_ACTION_REF = 209,
+  KEY_EXEC_ORDER_LOCAL_ID = 210,
+  KEY_EXEC_ORDER_REF = 211,
+  KEY_EXEC_ORDER_SYS_ID = 212,
+  KEY_EXEC_RESULT = 213,
+  KEY_EXPIRE_DATE = 214,
+  KEY_FAX = 215,
+  KEY_FEE_PAY_FLAG = 216,
+  KEY_FETCH_AMT = 217,
+  KEY_FFEXTIME = 218,
+  KEY_FIELD_CONTENT = 219,
+  KEY_FILE_BUSINESS_CODE = 220,
+  KEY_FIND_MARGIN_RATE_ALGO_ID = 221,
+  KEY_FIRST_OTP = 222,
+  KEY_FIXED_MARGIN = 223,
+  KEY_FLAG = 224,
+  KEY_FORCE_CLOSE_REASON = 225,
+  KEY_FOR_QUOTE_LOCAL_ID = 226,
+  KEY_FOR_QUOTE_REF = 227,
+  KEY_FOR_QUOTE_STATUS = 228,
+  KEY_FOR_QUOTE_SYS_ID = 229,
+  KEY_FOR_QUOTE_TIME = 230,
+  KEY_FREEZE_REASON_TYPE = 231,
+  KEY_FREEZE_TYPE = 232,
+  KEY_FROM_CURRENCY_ID = 233,
+  KEY_FROM_CURRENCY_UNIT = 234,
+  KEY_FRONT_ID = 235,
+  KEY_FROZEN_AMOUNT = 236,
+  KEY_FROZEN_CASH = 237,
+  KEY_FROZEN_COMMISSION = 238,
+  KEY_FROZEN_MARGIN = 239,
+  KEY_FROZEN_VOLUME = 240,
+  KEY_FUNCTION_CODE = 241,
+  KEY_FUND_MORTGAGE_AVAILABLE = 242,
+  KEY_FUND_MORTGAGE_IN = 243,
+  KEY_FUND_MORTGAGE_OUT = 244,
+  KEY_FUND_MORTGAGE_RATIO = 245,
+  KEY_FUTURE_ACCOUNT = 246,
+  KEY_FUTURE_ACC_PWD = 247,
+  KEY_FUTURE_ACC_TYPE = 248,
+  KEY_FUTURE_FETCH_AMOUNT = 249,
+  KEY_FUTURE_ID = 250,
+  KEY_FUTURE_PWD_FLAG = 251,
+  KEY_FUTURE_REPEAL_SERIAL = 252,
+  KEY_FUTURE_SERIAL = 253,
+  KEY_GENDER = 254,
+  KEY_GROUP_IP = 255,
+  KEY_GROUP_PORT = 256,
+  KEY_GTDDATE = 257,
+  KEY_GUARANT_RATIO = 258,
+  KEY_HANDLE_POSITION_ALGO_ID = 259,
+  KEY_HANDLE_TRADING_ACCOUNT_ALGO_ID = 260,
+  KEY_HEDGE_FLAG = 261,
+  KEY_HIGHEST_PRICE = 262,
+  KEY_HSHORT_MARGIN_RATIO_BY_MONEY = 263,
+  KEY_HSHORT_MARGIN_RATIO_BY_VOLUME = 264,
+  KEY_IDENTIFIED_CARD_NO = 265,
+  KEY_IDENTIFIED_CARD_TYPE = 266,
+  KEY_IDENTITY_ID = 267,
+  KEY_ID_CARD_TYPE = 268,
+  KEY_IMPLY_LEVEL = 269,
+  KEY_INCLUDE_CLOSE_PROFIT = 270,
+  KEY_INETIME = 271,
+  KEY_INPUT_PRICE = 272,
+  KEY_INSERT_DATE = 273,
+  KEY_INSERT_TIME = 274,
+  KEY_INSERT_TIME_END = 275,
+  KEY_INSERT_TIME_START = 276,
+  KEY_INSTALL_COUNT = 277,
+  KEY_INSTALL_ID = 278,
+  KEY_INSTRUCTION_RIGHT = 279,
+  KEY_INSTRUMENT_CODE = 280,
+  KEY_INSTRUMENT_ID = 281,
+  KEY_INSTRUMENT_NAME = 282,
+  KEY_INSTRUMENT_STATUS = 283,
+  KEY_INST_LIFE_PHASE = 284,
+  KEY_INTEREST = 285,
+  KEY_INTEREST_BASE = 286,
+  KEY_INTERFACE_PRODUCT_INFO = 287,
+  KEY_INVESTOR_GROUP_ID = 288,
+  KEY_INVESTOR_GROUP_NAME = 289,
+  KEY_INVESTOR_ID = 290,
+  KEY_INVESTOR_NAME = 291,
+  KEY_INVESTOR_RANGE = 292,
+  KEY_INVEST_UNIT_ID = 293,
+  KEY_IPADDRESS = 294,
+  KEY_IPMASK = 295,
+  KEY_IS_ACTIVE = 296,
+  KEY_IS_AUTO_SUSPEND = 297,
+  KEY_IS_BROKER_USER_EVENT = 298,
+  KEY_IS_FORBIDDEN = 299,
+  KEY_IS_FORCE = 300,
+  KEY_IS_RELATIVE = 301,
+  KEY_IS_RESULT = 302,
+  KEY_IS_SWAP_ORDER = 303,
+  KEY_IS_TRADING = 304,
+  KEY_IS_USING_OTP = 305,
+  KEY_KEY_ID = 306,
+  KEY_KEY_KIND = 307,
+  KEY_LAST_DRIFT = 308,
+  KEY_LAST_FRAGMENT = 309,
+  KEY_LAST_PRICE = 310,
+  KEY_LAST_REPORT_DATE = 311,
+  KEY_LAST_REPORT_TIME = 312,
+  KEY_LAST_SETTLEMENT_PRICE = 313,
+  KEY_LAST_SUCCESS = 314,
+  KEY_LEG_ID = 315,
+  KEY_LEG_INSTRUMENT_ID = 316,
+  KEY_LEG_MULTIPLE = 317,
+  KEY_LEVEL_TYPE = 318,
+  KEY_LIMIT_PRICE = 319,
+  KEY_LOCK_LOCAL_ID = 320,
+  KEY_LOCK_REF = 321,
+  KEY_LOCK_STATUS = 322,
+  KEY_LOCK_SYS_ID = 323,
+  KEY_LOCK_TYPE = 324,
+  KEY_LOGIN_DATE = 325,
+  KEY_LOGIN_MODE = 326,
+  KEY_LOGIN_REMARK = 327,
+  KEY_LOGIN_TIME = 328,
+  KEY_LONG_AMOUNT = 329,
+  KEY_LONG_AMOUNT_FROZEN = 330,
+  KEY_LONG_EXCH_MARGIN = 331,
+  KEY_LONG_EXCH_OFFSET_AMOUNT = 332,
+  KEY_LONG_FROZEN = 333,
+  KEY_LONG_FROZEN_AMOUNT = 334,
+  KEY_LONG_FROZEN_MARGIN = 335,
+  KEY_LONG_MARGIN_RATIO = 336,
+  KEY_LONG_MARGIN_RATIO_BY_MONEY = 337,
+  KEY_LONG_MARGIN_RATIO_BY_VOLUME = 338,
+  KEY_LONG_OFFSET_AMOUNT = 339,
+  KEY_LONG_USE_MARGIN = 340,
+  KEY_LONG_VOLUME = 341,
+  KEY_LONG_VOLUME_FROZEN = 342,
+  KEY_LOWER_LIMIT_PRICE = 343,
+  KEY_LOWEST_PRICE = 344,
+  KEY_MAC_ADDRESS = 345,
+  KEY_MAC_KEY = 346,
+  KEY_MARGIN = 347,
+  KEY_MARGIN_MODEL_ID = 348,
+  KEY_MARGIN_MODEL_NAME = 349,
+  KEY_MARGIN_PRICE_TYPE = 350,
+  KEY_MARGIN_RATE_BY_MONEY = 351,
+  KEY_MARGIN_RATE_BY_VOLUME = 352,
+  KEY_MARKET_ID = 353,
+  KEY_MARKET_STATUS = 354,
+  KEY_MAX_LIMIT_ORDER_VOLUME = 355,
+  KEY_MAX_MARGIN_SIDE_ALGORITHM = 356,
+  KEY_MAX_MARKET_ORDER_VOLUME = 357,
+  KEY_MAX_ORDER_MESSAGE_REFERENCE = 358,
+  KEY_MAX_ORDER_REF = 359,
+  KEY_MAX_TRADE_ID = 360,
+  KEY_MAX_VOLUME = 361,
+  KEY_MEMO = 362,
+  KEY_MESSAGE = 363,
+  KEY_MINI_MARGIN = 364,
+  KEY_MIN_BUY_VOLUME = 365,
+  KEY_MIN_LIMIT_ORDER_VOLUME = 366,
+  KEY_MIN_MARGIN = 367,
+  KEY_MIN_MARKET_ORDER_VOLUME = 368,
+  KEY_MIN_SELL_VOLUME = 369,
+  KEY_MIN_VOLUME = 370,
+  KEY_MOBILE = 371,
+  KEY_MOBILE_PHONE = 372,
+  KEY_MONEY_ACCOUNT_STATUS = 373,
+  KEY_MORTGAGE = 374,
+  KEY_MORTGAGEABLE_FUND = 375,
+  KEY_MORTGAGE_AMOUNT = 376,
+  KEY_MORTGAGE_FUND_USE_RANGE = 377,
+  KEY_MORTGAGE_SEQ_NO = 378,
+  KEY_MSHORT_MARGIN_RATIO_BY_MONEY = 379,
+  KEY_MSHORT_MARGIN_RATIO_BY_VOLUME = 380,
+  KEY_NEWS_TYPE = 381,
+  KEY_NEWS_URGENCY = 382,
+  KEY_NEW_BANK_ACCOUNT = 383,
+  KEY_NEW_BANK_PASS_WORD = 384,
+  KEY_NEW_PASSWORD = 385,
+  KEY_NOTIFY_SEQUENCE = 386,
+  KEY_NO_LONG_MARGIN_RATIO_BY_MONEY = 387,
+  KEY_NO_LONG_MARGIN_RATIO_BY_VOLUME = 388,
+  KEY_NO_SHORT_MARGIN_RATIO_BY_MONEY = 389,
+  KEY_NO_SHORT_MARGIN_RATIO_BY_VOLUME = 390,
+  KEY_OFFSET = 391,
+  KEY_OFFSET_AMOUNT = 392,
+  KEY_OFFSET_FLAG = 393,
+  KEY_OFFSET_TYPE = 394,
+  KEY_OLD_PASSWORD = 395,
+  KEY_ONE_TIME_PASSWORD = 396,
+  KEY_OPEN_AMOUNT = 397,
+  KEY_OPEN_COST = 398,
+  KEY_OPEN_DATE = 399,
+  KEY_OPEN_INTEREST = 400,
+  KEY_OPEN_OR_DESTROY = 401,
+  KEY_OPEN_PRICE = 402,
+  KEY_OPEN_RATIO_BY_MONEY = 403,
+  KEY_OPEN_RATIO_BY_VOLUME = 404,
+  KEY_OPEN_VOLUME = 405,
+  KEY_OPEN_VOLUME_FROZEN = 406,
+  KEY_OPERATOR_CODE = 407,
+  KEY_OPER_NO = 408,
+  KEY_OPTIONS_TYPE = 409,
+  KEY_OPTION_ROYALTY_PRICE_TYPE = 410,
+  KEY_ORDER_ACTION_COMM_BY_VOLUME = 411,
+  KEY_ORDER_ACTION_REF = 412,
+  KEY_ORDER_ACTION_STATUS = 413,
+  KEY_ORDER_COMM_BY_VOLUME = 414,
+  KEY_ORDER_LOCAL_ID = 415,
+  KEY_ORDER_PRICE_TYPE = 416,
+  KEY_ORDER_REF = 417,
+  KEY_ORDER_SOURCE = 418,
+  KEY_ORDER_STATUS = 419,
+  KEY_ORDER_SUBMIT_STATUS = 420,
+  KEY_ORDER_SYS_ID = 421,
+  KEY_ORDER_TYPE = 422,
+  KEY_ORIGIN_DESCR_INFO_FOR_RETURN_CODE = 423,
+  KEY_ORIGIN_RETURN_CODE = 424,
+  KEY_ORIG_BROKER_ID = 425,
+  KEY_ORIG_DRIDENTITY_ID = 426,
+  KEY_OTPTYPE = 427,
+  KEY_OTPVENDORS_ID = 428,
+  KEY_OUT_DATE = 429,
+  KEY_PARKED_ORDER_ACTION_ID = 430,
+  KEY_PARKED_ORDER_ID = 431,
+  KEY_PARTICIPANT_ID = 432,
+  KEY_PASSWORD = 433,
+  KEY_PERSON_FULL_NAME = 434,
+  KEY_PERSON_NAME = 435,
+  KEY_PERSON_TYPE = 436,
+  KEY_PIN_KEY = 437,
+  KEY_PLATE_REPEAL_SERIAL = 438,
+  KEY_PLATE_SERIAL = 439,
+  KEY_POSITION = 440,
+  KEY_POSITION_COST = 441,
+  KEY_POSITION_DATE = 442,
+  KEY_POSITION_DATE_TYPE = 443,
+  KEY_POSITION_PROFIT = 444,
+  KEY_POSITION_PROFIT_BY_DATE = 445,
+  KEY_POSITION_PROFIT_BY_TRADE = 446,
+  KEY_POSITION_TYPE = 447,
+  KEY_POSI_DIRECTION = 448,
+  KEY_PRE_BALANCE = 449,
+  KEY_PRE_CLOSE_PRICE = 450,
+  KEY_PRE_CREDIT = 451,
+  KEY_PRE_DELTA = 452,
+  KEY_PRE_DEPOSIT = 453,
+  KEY_PRE_FUND_MORTGAGE_IN = 454,
+  KEY_PRE_FUND_MORTGAGE_OUT = 455,
+  KEY_PRE_MARGIN = 456,
+  KEY_PRE_MORTGAGE = 457,
+  KEY_PRE_OPEN_INTEREST = 458,
+  KEY_PRE_SETTLEMENT_PRICE = 459,
+  KEY_PRICE = 460,
+  KEY_PRICE_INTERVAL = 461,
+  KEY_PRICE_SOURCE = 462,
+  KEY_PRICE_TICK = 463,
+  KEY_PRIORITY = 464,
+  KEY_PRODUCT_CLASS = 465,
+  KEY_PRODUCT_GROUP_ID = 466,
+  KEY_PRODUCT_ID = 467,
+  KEY_PRODUCT_NAME = 468,
+  KEY_PROTOCOL_INFO = 469,
+  KEY_QUOTE_ACTION_REF = 470,
+  KEY_QUOTE_CURRENCY_ID = 471,
+  KEY_QUOTE_LOCAL_ID = 472,
+  KEY_QUOTE_REF = 473,
+  KEY_QUOTE_STATUS = 474,
+  KEY_QUOTE_SYS_ID = 475,
+  KEY_RECORD_NUM = 476,
+  KEY_REFERENCE = 477,
+  KEY_REFRENCE_ISSURE = 478,
+  KEY_REFRENCE_ISSURE_TYPE = 479,
+  KEY_REG_DATE = 480,
+  KEY_RELATIVE_ORDER_SYS_ID = 481,
+  KEY_REPEALED_TIMES = 482,
+  KEY_REPEAL_TIME_INTERVAL = 483,
+  KEY_REQUEST_ID = 484,
+  KEY_RESERVE = 485,
+  KEY_RESERVE_BALANCE = 486,
+  KEY_RESERVE_POSITION_FLAG = 487,
+  KEY_RETURN_CODE = 488,
+  KEY_RET_CODE = 489,
+  KEY_RET_INFO = 490,
+  KEY_ROYALTY = 491,
+  KEY_SECOND_OTP = 492,
+  KEY_SECU_PWD_FLAG = 493,
+  KEY_SEND_TIME = 494,
+  KEY_SEQUENCE_LABEL = 495,
+  KEY_SEQUENCE_NO = 496,
+  KEY_SEQUENCE_SERIES = 497,
+  KEY_SERIAL_NUMBER = 498,
+  KEY_SESSION_ID = 499,
+  KEY_SETTLEMENT_GROUP_ID = 500,
+  KEY_SETTLEMENT_ID = 501,
+  KEY_SETTLEMENT_PRICE = 502,
+  KEY_SHFETIME = 503,
+  KEY_SHORT_EXCH_MARGIN = 504,
+  KEY_SHORT_EXCH_OFFSET_AMOUNT = 505,
+  KEY_SHORT_FROZEN = 506,
+  KEY_SHORT_FROZEN_AMOUNT = 507,
+  KEY_SHORT_FROZEN_MARGIN = 508,
+  KEY_SHORT_MARGIN_RATIO = 509,
+  KEY_SHORT_MARGIN_RATIO_BY_MONEY = 510,
+  KEY_SHORT_MARGIN_RATIO_BY_VOLUME = 511,
+  KEY_SHORT_OFFSET_AMOUNT = 512,
+  KEY_SHORT_USE_MARGIN = 513,
+  KEY_SOURCE_IP = 514,
+  KEY_SPEC_PRODUCT_CLOSE_PROFIT = 515,
+  KEY_SPEC_PRODUCT_COMMISSION = 516,
+  KEY_SPEC_PRODUCT_EXCHANGE_MARGIN = 517,
+  KEY_SPEC_PRODUCT_FROZEN_COMMISSION = 518,
+  KEY_SPEC_PRODUCT_FROZEN_MARGIN = 519,
+  KEY_SPEC_PRODUCT_MARGIN = 520,
+  KEY_SPEC_PRODUCT_POSITION_PROFIT = 521,
+  KEY_SPEC_PRODUCT_POSITION_PROFIT_BY_ALG = 522,
+  KEY_SSHORT_MARGIN_RATIO_BY_MONEY = 523,
+  KEY_SSHORT_MARGIN_RATIO_BY_VOLUME = 524,
+  KEY_START_DATE = 525,
+  KEY_START_DELIV_DATE = 526,
+  KEY_START_TIME = 527,
+  KEY_STATUS = 528,
+  KEY_STATUS_MSG = 529,
+  KEY_STOCK_DISPOSAL_ACTION_REF = 530,
+  KEY_STOCK_DISPOSAL_LOCAL_ID = 531,
+  KEY_STOCK_DISPOSAL_REF = 532,
+  KEY_STOCK_DISPOSAL_STATUS = 533,
+  KEY_STOCK_DISPOSAL_SYS_ID = 534,
+  KEY_STOCK_DISPOSAL_TYPE = 535,
+  KEY_STOP_PRICE = 536,
+  KEY_STRIKE_FROZEN = 537,
+  KEY_STRIKE_FROZEN_AMOUNT = 538,
+  KEY_STRIKE_PRICE = 539,
+  KEY_STRIKE_RATIO_BY_MONEY = 540,
+  KEY_STRIKE_RATIO_BY_VOLUME = 541,
+  KEY_SUSPEND_TIME = 542,
+  KEY_SYSTEM_ID = 543,
+  KEY_SYSTEM_NAME = 544,
+  KEY_TELEPHONE = 545,
+  KEY_TID = 546,
+  KEY_TIME_CONDITION = 547,
+  KEY_TODAY_POSITION = 548,
+  KEY_TOKEN = 549,
+  KEY_TOTAL_AMT = 550,
+  KEY_TOTAL_VOLUME = 551,
+  KEY_TOTAL_VOLUME_FROZEN = 552,
+  KEY_TO_CURRENCY_ID = 553,
+  KEY_TRADEABLE = 554,
+  KEY_TRADER_CONNECT_STATUS = 555,
+  KEY_TRADER_ID = 556,
+  KEY_TRADE_AMOUNT = 557,
+  KEY_TRADE_AMT = 558,
+  KEY_TRADE_CODE = 559,
+  KEY_TRADE_CURRENCY_ID = 560,
+  KEY_TRADE_DATE = 561,
+  KEY_TRADE_DAY = 562,
+  KEY_TRADE_GROUP_ID = 563,
+  KEY_TRADE_ID = 564,
+  KEY_TRADE_SERIAL = 565,
+  KEY_TRADE_SOURCE = 566,
+  KEY_TRADE_TIME = 567,
+  KEY_TRADE_TIME_END = 568,
+  KEY_TRADE_TIME_START = 569,
+  KEY_TRADE_TYPE = 570,
+  KEY_TRADING_DAY = 571,
+  KEY_TRADING_RIGHT = 572,
+  KEY_TRADING_ROLE = 573,
+  KEY_TRADING_SEGMENT_SN = 574,
+  KEY_TRANSFER_STATUS = 575,
+  KEY_TURNOVER = 576,
+  KEY_TX_AMOUNT = 577,
+  KEY_UNDERLYING_INSTR_ID = 578,
+  KEY_UNDERLYING_MULTIPLE = 579,
+  KEY_UNDERLYING_PRICE = 580,
+  KEY_UOAZIP_CODE = 581,
+  KEY_UPDATE_MILLISEC = 582,
+  KEY_UPDATE_TIME = 583,
+  KEY_UPPER_LIMIT_PRICE = 584,
+  KEY_URLLINK = 585,
+  KEY_USER_EVENT_INFO = 586,
+  KEY_USER_EVENT_TYPE = 587,
+  KEY_USER_FORCE_CLOSE = 588,
+  KEY_USER_ID = 589,
+  KEY_USER_NAME = 590,
+  KEY_USER_PRODUCT_INFO = 591,
+  KEY_USER_RIGHT_TYPE = 592,
+  KEY_USER_TYPE = 593,
+  KEY_USE_AMT = 594,
+  KEY_USE_MARGIN = 595,
+  KEY_USING_RATIO = 596,
+  KEY_VALUE_METHOD = 597,
+  KEY_VERIFY_CERT_NO_FLAG = 598,
+  KEY_VERSION = 599,
+  KEY_VOLUME = 600,
+  KEY_VOLUME_CHANGE = 601,
+  KEY_VOLUME_CONDITION = 602,
+  KEY_VOLUME_MULTIPLE = 603,
+  KEY_VOLUME_TOTAL = 604,
+  KEY_VOLUME_TOTAL_ORIGINAL = 605,
+  KEY_VOLUME_TRADED = 606,
+  KEY_WITHDRAW = 607,
+  KEY_WITHDRAW_ALGORITHM = 608,
+  KEY_WITHDRAW_QUOTA = 609,
+  KEY_YD_POSITION = 610,
+  KEY_YD_STRIKE_FROZEN = 611,
+  KEY_ZCETOTAL_TRADED_VOLUME = 612,
+  KEY_ZIP_CODE = 613,
+  KEY_COUNT = 614,
+};
+
+/**
+ * 创建属性名字符串, 每个线程(Isolate)加载模块时调用一次
+ * @remark 属性名使用内部化字符串并常驻, 转换时不再重复创建.
+ * 属性名及字符串驻留表按线程保存, 主线程与各个worker线程互不影响
+ */
+void InitObjectKeys(Isolate *isolate);
+
+/**
+ * 释放当前线程的属性名字符串及驻留的字符串, 在Isolate销毁前调用
+ */
+void ReleaseObjectKeys();
+
+/**
+ * 读取属性名字符串
+ */
+Local<String> GetObjectKey(Isolate *isolate, ObjectKey key);
+
+/**
+ * 读取属性名
+ */
+const char *GetObjectKeyName(ObjectKey key);
+
+/**
+ * 读取当前线程的字符串驻留表
+ */
+StringInternTable &GetInternTable();
+
+/**
+ * 字段投影中的字段类型
+ */
+enum FieldType {
+  FIELD_STRING = 0,
+  FIELD_INTERNED_STRING = 1,
+  FIELD_CHAR = 2,
+  FIELD_INT = 3,
+  FIELD_DOUBLE = 4,
+};
+
+/**
+ * 无效价格的处理方式, CTP以DBL_MAX填充没有取值的价格字段
+ */
+enum InvalidDoubleMode {
+  /* 保留DBL_MAX */
+  INVALID_DOUBLE_KEEP = 0,
+  /* 转换为NaN */
+  INVALID_DOUBLE_NAN = 1,
+  /* 不设置该属性 */
+  INVALID_DOUBLE_SKIP = 2,
+};
+
+/**
+ * 字段投影中的字段描述
+ */
+struct FieldInfo {
+  ObjectKey key;
+  FieldType type;
+  /* 字段在结构体中的偏移与长度 */
+  uint32_t offset;
+  uint32_t size;
+};
+
+/**
+ * 结构体的全部字段描述, 按结构体中的声明顺序排列
+ */
+struct FieldTable {
+  const FieldInfo *fields;
+  size_t count;
+};
+
+/**
+ * 读取支持按字段投影转换的结构体字段表
+ * @remark 参数仅用于按类型选择重载, 可传NULL
+ */
+FieldTable GetFieldTable(const CThostFtdcDepthMarketDataField *);
+FieldTable GetFieldTable(const CThostFtdcOrderField *);
+FieldTable GetFieldTable(const CThostFtdcTradeField *);
+
+/**
+ * 按字段投影转换CTP结构体->Node层对象
+ * @param fields 需要转换的字段, 由GetFieldTable返回的字段描述中选出
+ * @param invalid 值为DBL_MAX的浮点字段的处理方式
+ */
+Local<Object> NewNodeObject(Isolate *isolate, const void *data,
+                            const FieldInfo *fields, size_t count,
+                            InvalidDoubleMode invalid = INVALID_DOUBLE_KEEP);
+
+/**
+ * CTP结构体->Node层对象
+ * @remark data为NULL时返回空对象, 同一结构体转换出的对象属性顺序固定,
+ * 共享相同的隐藏类
+ */
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDisseminationField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqUserLoginField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspUserLoginField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserLogoutField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForceUserLogoutField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqAuthenticateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspAuthenticateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcAuthenticationInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferHeaderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferBankToFutureReqField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferBankToFutureRspField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferFutureToBankReqField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferFutureToBankRspField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryBankReqField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryBankRspField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryDetailReqField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferQryDetailRspField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTraderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingCodeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcPartBrokerField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSuperUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSuperUserFunctionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorGroupField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorPositionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentMarginRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInstrumentCommissionRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDepthMarketDataField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentTradingRightField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserPasswordField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserFunctionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTraderOfferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementInfoField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInstrumentMarginRateAdjustField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeMarginRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeMarginRateAdjustField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementRefField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCurrentTimeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCommPhaseField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoginInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLogoutAllField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFrontStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserPasswordUpdateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate, const CThostFtdcOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeOrderField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeOrderInsertErrorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeOrderActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeOrderActionErrorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeTradeField *data);
+Local<Object> NewNodeObject(Isolate *isolate, const CThostFtdcTradeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserSessionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQueryMaxOrderVolumeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSettlementInfoConfirmField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncDepositField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncFundMortgageField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerSyncField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingInvestorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingTradingCodeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingInvestorGroupField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingTradingAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncingInvestorPositionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcSyncingInstrumentMarginRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcSyncingInstrumentCommissionRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcSyncingInstrumentTradingRightField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorPositionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingCodeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorGroupField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInstrumentMarginRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentCommissionRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentTradingRightField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTraderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySuperUserFunctionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryUserSessionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryPartBrokerField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryFrontStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySuperUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInstrumentField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryDepthMarketDataField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserFunctionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTraderOfferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncDepositField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySettlementInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeMarginRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryExchangeMarginRateAdjustField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncFundMortgageField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryHisOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrMiniMarginField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrMarginAdjustField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrTradeCostField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOptionInstrTradeCostField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcIndexPriceField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeExecOrderActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryExchangeExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrExecOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrExecOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrTradingRightField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryOptionInstrTradingRightField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputForQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryForQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeForQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeForQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputQuoteActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate, const CThostFtdcQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQuoteActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeQuoteField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryQuoteActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeQuoteActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeQuoteActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrDeltaField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteRspField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStrikeOffsetField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStrikeOffsetField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputLockField *data);
+Local<Object> NewNodeObject(Isolate *isolate, const CThostFtdcLockField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLockField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLockPositionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLockPositionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcETFOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryETFOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcPosiFreezeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeLockField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeLockField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeExecOrderActionErrorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputBatchOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBatchOrderActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeBatchOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBatchOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitPosiField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerLimitPosiField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerLimitPosiField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiSField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitPosiSField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerLimitPosiParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitPosiParamSField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInputStockDisposalActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStockDisposalActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStockDisposalActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcExchangeStockDisposalActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryExchangeStockDisposalActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryErrStockDisposalActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcExchangeStockDisposalActionErrorField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrStockDisposalActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorLevelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombInstrumentGuardField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombInstrumentGuardField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputCombActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeCombActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeCombActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductExchRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductExchRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputDesignateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDesignateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryDesignateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeDesignateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInputStockDisposalField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcStockDisposalField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryStockDisposalField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeStockDisposalField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInvestorLevelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryForQuoteParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcForQuoteParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExecFreezeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExecFreezeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMMOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryMMOptionInstrCommRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcMMInstrumentCommissionRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryMMInstrumentCommissionRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentOrderCommRateField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInstrumentOrderCommRateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitAmountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLimitAmountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLimitAmountParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOptionInstrMarginGuardField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBaseField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataStaticField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataLastMatchField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBestPriceField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBid23Field *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAsk23Field *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataBid45Field *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAsk45Field *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataUpdateTimeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataExchangeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSpecificInstrumentField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstrumentStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryInstrumentStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcPositionProfitAlgorithmField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDiscountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTransferBankField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferBankField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInvestorPositionDetailField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInvestorPositionDetailField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountPasswordField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMDTraderOfferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryMDTraderOfferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryNoticeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNoticeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserRightField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQrySettlementInfoConfirmField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoadSettlementInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerWithdrawAlgorithmField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcTradingAccountPasswordUpdateV1Field *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcTradingAccountPasswordUpdateField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCombinationLegField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySyncStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCombinationLegField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSyncStatusField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLinkManField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLinkManField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerUserEventField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserEventField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryContractBankField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcContractBankField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInvestorPositionCombineDetailField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcParkedOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcParkedOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryParkedOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryParkedOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRemoveParkedOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRemoveParkedOrderActionField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInvestorWithdrawAlgorithmField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcQryInvestorPositionCombineDetailField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarketDataAveragePriceField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyInvestorPasswordField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserIPField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingNoticeInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingNoticeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTradingNoticeField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrorConditionalOrderField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryErrOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcErrOrderActionField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryExchangeSequenceField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcExchangeSequenceField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQueryMaxOrderVolumeWithPriceField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerTradingParamsField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerTradingParamsField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBrokerTradingAlgosField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerTradingAlgosField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQueryBrokerDepositField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerDepositField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCFMMCBrokerKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCFMMCBrokerKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCFMMCTradingAccountKeyField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryCFMMCTradingAccountKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserOTPParamField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcManualSyncBrokerUserOTPField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCommRateModelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryCommRateModelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMarginModelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryMarginModelField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcEWarrantOffsetField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryEWarrantOffsetField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQryInvestorProductGroupMarginField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcInvestorProductGroupMarginField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcQueryCFMMCTradingAccountTokenField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcCFMMCTradingAccountTokenField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcInstructionRightField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryProductGroupField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcProductGroupField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBulletinField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryBulletinField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqOpenAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqCancelAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqChangeAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqTransferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspTransferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqRepealField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspRepealField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqQueryAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspQueryAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFutureSignIOField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspFutureSignInField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqFutureSignOutField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspFutureSignOutField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcReqQueryTradeResultBySerialField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate, const CThostFtdcRspQueryTradeResultBySerialField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqDayEndFileReadyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReturnResultField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyFuturePasswordField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcVerifyCustInfoField *data);
+Local<Object> NewNodeObject(
+    Isolate *isolate,
+    const CThostFtdcVerifyFuturePasswordAndCustInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDepositResultInformField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcReqSyncKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcRspSyncKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyQueryAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTransferSerialField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryTransferSerialField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyFutureSignInField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifyFutureSignOutField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcNotifySyncKeyField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryAccountregisterField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcAccountregisterField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcOpenAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCancelAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcChangeAccountField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcSecAgentACIDMapField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQrySecAgentACIDMapField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcUserRightsAssignField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcBrokerUserRightAssignField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDRTransferField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcFensUserInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcCurrTransferIdentityField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcLoginForbiddenUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcQryLoginForbiddenUserField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcMulticastGroupInfoField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcTradingAccountReserveField *data);
+Local<Object> NewNodeObject(Isolate *isolate,
+                            const CThostFtdcDBFRecordField *data);
+
+} /* namespace node_ctp */
+
+#endif /* STRUCT_CONVERT_H */
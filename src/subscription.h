@@ -0,0 +1,293 @@
+#ifndef SUBSCRIPTION_H
+#define SUBSCRIPTION_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "histogram.h"
+
+/**
+ * 此文件中定义行情订阅集合的管理
+ */
+
+namespace node_ctp {
+
+using std::deque;
+using std::string;
+using std::unordered_map;
+using std::unordered_set;
+using std::vector;
+
+/**
+ * 合约订阅状态
+ */
+enum SubscriptionState {
+  /* 等待发送订阅请求 */
+  SUBSCRIPTION_PENDING,
+  /* 已发送订阅请求, 尚未收到应答 */
+  SUBSCRIPTION_SENT,
+  /* 订阅成功 */
+  SUBSCRIPTION_ACTIVE,
+  /* 订阅应答返回错误 */
+  SUBSCRIPTION_FAILED
+};
+
+/**
+ * 单个合约的订阅信息
+ */
+struct SubscriptionEntry {
+  SubscriptionState state;
+
+  /* 计算首条行情延迟的起点: 连接建立或加入订阅集合的时间 */
+  uint64_t since;
+
+  /* 本次连接收到的首条行情时间, 未收到时为0 */
+  uint64_t first_tick;
+};
+
+/**
+ * 行情订阅集合
+ * @remark 保存Node层期望订阅的合约, 变更时与当前集合比较, 只发送差异部分.
+ * 订阅/退订请求排队后按块取出, 由调用方控制发送频率. 断线后全部合约回到
+ * 等待状态, 登录成功后重新排队订阅. 同时统计从连接建立(或加入集合)到收到
+ * 首条行情的时间. 仅可在主线程中使用
+ */
+class SubscriptionSet {
+ public:
+  SubscriptionSet() : logged_in_(false) {}
+
+  SubscriptionSet(const SubscriptionSet &) = delete;
+  SubscriptionSet &operator=(const SubscriptionSet &) = delete;
+
+  /**
+   * 加入订阅集合
+   * @param now 当前时间(纳秒)
+   * @return 新加入的合约个数
+   */
+  uint32_t Add(const vector<string> &instruments, uint64_t now) {
+    uint32_t added = 0;
+    for (size_t i = 0; i < instruments.size(); ++i) {
+      const string &id = instruments[i];
+      if (entries_.count(id)) {
+        continue;
+      }
+      ++added;
+
+      /* 退订请求尚未发送时直接撤销, 服务端仍保持订阅 */
+      if (unsubscribing_.erase(id)) {
+        SubscriptionEntry &entry = entries_[id];
+        entry.state = SUBSCRIPTION_SENT;
+        entry.since = now;
+        entry.first_tick = 0;
+        continue;
+      }
+
+      SubscriptionEntry &entry = entries_[id];
+      entry.state = SUBSCRIPTION_PENDING;
+      entry.since = now;
+      entry.first_tick = 0;
+      if (logged_in_) {
+        subscribe_queue_.push_back(id);
+      }
+    }
+    return added;
+  }
+
+  /**
+   * 移出订阅集合
+   * @return 移出的合约个数
+   */
+  uint32_t Remove(const vector<string> &instruments) {
+    uint32_t removed = 0;
+    for (size_t i = 0; i < instruments.size(); ++i) {
+      removed += Erase(instruments[i]);
+    }
+    return removed;
+  }
+
+  /**
+   * 替换订阅集合
+   * @param added 新加入的合约个数
+   * @param removed 移出的合约个数
+   */
+  void Set(const vector<string> &instruments, uint64_t now, uint32_t &added,
+           uint32_t &removed) {
+    unordered_set<string> wanted(instruments.begin(), instruments.end());
+    vector<string> stale;
+    for (unordered_map<string, SubscriptionEntry>::iterator it =
+             entries_.begin();
+         it != entries_.end(); ++it) {
+      if (!wanted.count(it->first)) {
+        stale.push_back(it->first);
+      }
+    }
+    removed = Remove(stale);
+    added = Add(instruments, now);
+  }
+
+  /**
+   * 连接建立, 重新开始统计首条行情延迟
+   */
+  void OnConnected(uint64_t time) {
+    for (unordered_map<string, SubscriptionEntry>::iterator it =
+             entries_.begin();
+         it != entries_.end(); ++it) {
+      it->second.since = time;
+      it->second.first_tick = 0;
+    }
+  }
+
+  /**
+   * 连接断开, 服务端不保留订阅, 全部合约回到等待状态
+   */
+  void OnDisconnected() {
+    logged_in_ = false;
+    subscribe_queue_.clear();
+    unsubscribe_queue_.clear();
+    unsubscribing_.clear();
+    for (unordered_map<string, SubscriptionEntry>::iterator it =
+             entries_.begin();
+         it != entries_.end(); ++it) {
+      it->second.state = SUBSCRIPTION_PENDING;
+    }
+  }
+
+  /**
+   * 登录成功, 全部等待中的合约排队订阅
+   */
+  void OnLogin() {
+    logged_in_ = true;
+    subscribe_queue_.clear();
+    for (unordered_map<string, SubscriptionEntry>::iterator it =
+             entries_.begin();
+         it != entries_.end(); ++it) {
+      if (it->second.state != SUBSCRIPTION_ACTIVE) {
+        it->second.state = SUBSCRIPTION_PENDING;
+        subscribe_queue_.push_back(it->first);
+      }
+    }
+  }
+
+  /**
+   * 订阅应答
+   */
+  void OnSubscribed(const char *instrument, bool success) {
+    unordered_map<string, SubscriptionEntry>::iterator it =
+        entries_.find(instrument);
+    if (it != entries_.end() && it->second.state == SUBSCRIPTION_SENT) {
+      it->second.state = success ? SUBSCRIPTION_ACTIVE : SUBSCRIPTION_FAILED;
+    }
+  }
+
+  /**
+   * 收到行情, 记录本次连接的首条行情延迟
+   * @param time SPI线程收到行情的时间
+   */
+  void OnTick(const char *instrument, uint64_t time) {
+    unordered_map<string, SubscriptionEntry>::iterator it =
+        entries_.find(instrument);
+    if (it == entries_.end() || it->second.first_tick) {
+      return;
+    }
+    SubscriptionEntry &entry = it->second;
+    entry.first_tick = time;
+    /* 未收到订阅应答前的行情同样说明订阅已生效 */
+    if (entry.state == SUBSCRIPTION_SENT) {
+      entry.state = SUBSCRIPTION_ACTIVE;
+    }
+    if (time > entry.since) {
+      first_tick_latency_.Record(time - entry.since);
+    }
+  }
+
+  /**
+   * 取出下一块待发送的请求, 退订优先
+   * @param max 单块最多合约个数
+   * @return 取出的合约个数, 为0时没有待发送的请求
+   */
+  size_t NextChunk(size_t max, vector<string> &unsubscribe,
+                   vector<string> &subscribe) {
+    unsubscribe.clear();
+    subscribe.clear();
+    if (!logged_in_) {
+      return 0;
+    }
+
+    while (!unsubscribe_queue_.empty() && unsubscribe.size() < max) {
+      string id = unsubscribe_queue_.front();
+      unsubscribe_queue_.pop_front();
+      if (unsubscribing_.erase(id)) {
+        unsubscribe.push_back(id);
+      }
+    }
+
+    /* 同一合约可能在队列中出现多次, 按状态跳过已发送的 */
+    while (!subscribe_queue_.empty() &&
+           unsubscribe.size() + subscribe.size() < max) {
+      string id = subscribe_queue_.front();
+      subscribe_queue_.pop_front();
+      unordered_map<string, SubscriptionEntry>::iterator it = entries_.find(id);
+      if (it != entries_.end() && it->second.state == SUBSCRIPTION_PENDING) {
+        it->second.state = SUBSCRIPTION_SENT;
+        subscribe.push_back(id);
+      }
+    }
+    return unsubscribe.size() + subscribe.size();
+  }
+
+  /**
+   * 是否有待发送的请求
+   */
+  bool Pending() const {
+    return logged_in_ &&
+           (!subscribe_queue_.empty() || !unsubscribe_queue_.empty());
+  }
+
+  bool LoggedIn() const { return logged_in_; }
+
+  const unordered_map<string, SubscriptionEntry> &Entries() const {
+    return entries_;
+  }
+
+  const Histogram &FirstTickLatency() const { return first_tick_latency_; }
+
+  void ResetLatency() { first_tick_latency_.Reset(); }
+
+ private:
+  uint32_t Erase(const string &id) {
+    unordered_map<string, SubscriptionEntry>::iterator it = entries_.find(id);
+    if (it == entries_.end()) {
+      return 0;
+    }
+    /* 尚未发送订阅请求的合约无需退订 */
+    if (logged_in_ && it->second.state != SUBSCRIPTION_PENDING &&
+        unsubscribing_.insert(id).second) {
+      unsubscribe_queue_.push_back(id);
+    }
+    entries_.erase(it);
+    return 1;
+  }
+
+ private:
+  unordered_map<string, SubscriptionEntry> entries_;
+
+  /* 待发送的订阅/退订请求 */
+  deque<string> subscribe_queue_;
+  deque<string> unsubscribe_queue_;
+
+  /* 已移出集合但退订请求尚未发送的合约 */
+  unordered_set<string> unsubscribing_;
+
+  /* 是否已登录, 登录前只记录订阅集合 */
+  bool logged_in_;
+
+  /* 连接建立(或加入集合)->首条行情 */
+  Histogram first_tick_latency_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* SUBSCRIPTION_H */
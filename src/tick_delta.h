@@ -0,0 +1,159 @@
+#ifndef TICK_DELTA_H
+#define TICK_DELTA_H
+
+#include <cstdint>
+#include <cstring>
+#include "ThostFtdcUserApiStruct.h"
+
+/**
+ * 此文件中定义深度行情累计值->逐笔增量的换算
+ */
+
+namespace node_ctp {
+
+/**
+ * 相邻两条行情之间的增量
+ */
+struct TickDelta {
+  /* 成交量增量 */
+  int32_t LastVolume;
+
+  /* 成交金额增量 */
+  double LastTurnover;
+
+  /* 持仓量变化, 可为负数 */
+  double OIChange;
+};
+
+/**
+ * 按合约保存上一条行情累计值的连续表
+ * @remark 深度行情中的Volume/Turnover/OpenInterest为交易日累计值, 每条行情
+ * 与同一合约的上一条行情相减得到增量. 合约的第一条行情及表满后的新合约增量为0;
+ * 交易日切换时成交量/成交金额从0开始累计, 持仓量与PreOpenInterest相比;
+ * 累计值回退时增量为0并以新值为基准. 使用开放寻址的连续数组, 只增不删.
+ * 非线程安全, 只能由一个线程使用
+ */
+class TickDeltaTable {
+ public:
+  explicit TickDeltaTable(uint32_t capacity) : size_(0), overflow_(0) {
+    /* 保持装载率不超过50%, 缩短探测距离 */
+    uint32_t n = 2;
+    while (n < capacity * 2 && n < (1u << 30)) {
+      n <<= 1;
+    }
+    capacity_ = capacity;
+    mask_ = n - 1;
+    slots_ = new Slot[n];
+  }
+
+  ~TickDeltaTable() { delete[] slots_; }
+
+  TickDeltaTable(const TickDeltaTable &) = delete;
+  TickDeltaTable &operator=(const TickDeltaTable &) = delete;
+
+  /**
+   * 计算行情相对同一合约上一条行情的增量, 并以该行情为新的基准
+   */
+  void Update(const CThostFtdcDepthMarketDataField *data, TickDelta &out) {
+    out.LastVolume = 0;
+    out.LastTurnover = 0;
+    out.OIChange = 0;
+
+    Slot *slot = Find(data->InstrumentID);
+    if (!slot) {
+      ++overflow_;
+      return;
+    }
+
+    if (!slot->used) {
+      slot->used = true;
+      ++size_;
+    } else if (strcmp(slot->trading_day, data->TradingDay) != 0) {
+      out.LastVolume = data->Volume;
+      out.LastTurnover = data->Turnover;
+      out.OIChange = data->OpenInterest - data->PreOpenInterest;
+    } else if (data->Volume >= slot->volume &&
+               data->Turnover >= slot->turnover) {
+      out.LastVolume = data->Volume - slot->volume;
+      out.LastTurnover = data->Turnover - slot->turnover;
+      out.OIChange = data->OpenInterest - slot->open_interest;
+    }
+
+    memcpy(slot->trading_day, data->TradingDay, sizeof(slot->trading_day));
+    slot->volume = data->Volume;
+    slot->turnover = data->Turnover;
+    slot->open_interest = data->OpenInterest;
+  }
+
+  uint32_t Size() const { return size_; }
+
+  uint32_t Capacity() const { return capacity_; }
+
+  /**
+   * 表满而未能计算增量的行情数
+   */
+  uint64_t Overflow() const { return overflow_; }
+
+ private:
+  struct Slot {
+    Slot() : used(false), volume(0), turnover(0), open_interest(0) {
+      memset(key, 0x0, sizeof(key));
+      memset(trading_day, 0x0, sizeof(trading_day));
+    }
+
+    bool used;
+    TThostFtdcInstrumentIDType key;
+    TThostFtdcDateType trading_day;
+    int32_t volume;
+    double turnover;
+    double open_interest;
+  };
+
+  static uint32_t Hash(const char *key) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261u;
+    for (; *key; ++key) {
+      hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+  }
+
+  /**
+   * 查找合约所在槽位, 未找到时返回可占用的空槽位
+   * @return 表满时返回NULL
+   */
+  Slot *Find(const char *instrument_id) {
+    TThostFtdcInstrumentIDType key;
+    strncpy(key, instrument_id, sizeof(key) - 1);
+    key[sizeof(key) - 1] = '\0';
+
+    uint32_t index = Hash(key) & mask_;
+    for (uint32_t i = 0; i <= mask_; ++i, index = (index + 1) & mask_) {
+      Slot &slot = slots_[index];
+      if (slot.used) {
+        if (strcmp(slot.key, key) == 0) {
+          return &slot;
+        }
+        continue;
+      }
+
+      if (size_ >= capacity_) {
+        return NULL;
+      }
+      memcpy(slot.key, key, sizeof(key));
+      return &slot;
+    }
+    return NULL;
+  }
+
+ private:
+  Slot *slots_;
+  uint32_t capacity_;
+  uint32_t mask_;
+  uint32_t size_;
+  uint64_t overflow_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* TICK_DELTA_H */
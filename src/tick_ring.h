@@ -0,0 +1,270 @@
+#ifndef TICK_RING_H
+#define TICK_RING_H
+
+#include <atomic>
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include "ThostFtdcUserApiStruct.h"
+#include "tick_delta.h"
+#include "tick_time.h"
+
+/**
+ * 此文件中定义零拷贝行情模式使用的环形缓冲区
+ * SPI线程直接将深度行情写为定长记录, Node层通过ArrayBuffer按需读取字段
+ * 记录布局需要与lib/tick.js中的TICK_LAYOUT保持一致
+ */
+
+namespace node_ctp {
+
+using std::atomic;
+
+/**
+ * 环形缓冲区头部, 占用缓冲区起始的64字节
+ */
+struct TickRingHeader {
+  /* 记录条数, 2的幂 */
+  uint32_t capacity;
+
+  /* 单条记录字节数 */
+  uint32_t record_size;
+
+  /* 写游标, 即已写入的记录总数(按uint32回绕) */
+  atomic<uint32_t> cursor;
+
+  uint32_t reserved[13];
+};
+
+/**
+ * 定长深度行情记录
+ * @remark 字符串字段以'\0'结尾, 价格/数量字段与CThostFtdcDepthMarketDataField一致
+ */
+struct TickRecord {
+  /* 记录序号(写游标+1), 为0时表示记录正在写入 */
+  uint32_t Seq;
+
+  /* 价格字段有效位, 按LastPrice起的声明顺序, 值为DBL_MAX时对应位为0 */
+  uint32_t Valid;
+
+  double LastPrice;
+  double PreSettlementPrice;
+  double PreClosePrice;
+  double PreOpenInterest;
+  double OpenPrice;
+  double HighestPrice;
+  double LowestPrice;
+  double Turnover;
+  double OpenInterest;
+  double ClosePrice;
+  double SettlementPrice;
+  double UpperLimitPrice;
+  double LowerLimitPrice;
+  double PreDelta;
+  double CurrDelta;
+  double AveragePrice;
+  double BidPrice[5];
+  double AskPrice[5];
+
+  int32_t Volume;
+  int32_t UpdateMillisec;
+  int32_t BidVolume[5];
+  int32_t AskVolume[5];
+
+  char TradingDay[12];
+  char ActionDay[12];
+  char UpdateTime[12];
+  char ExchangeID[12];
+  char InstrumentID[32];
+  char ExchangeInstID[32];
+
+  /* 行情时间的UTC毫秒时间戳, 由TradingDay/ActionDay/UpdateTime换算 */
+  double Timestamp;
+
+  /* 相对同一合约上一条行情的增量, 未开启deltas选项时为0 */
+  double LastTurnover;
+  double OIChange;
+  int32_t LastVolume;
+
+  uint32_t Reserved;
+};
+
+static_assert(sizeof(TickRingHeader) == 64, "TickRingHeader size mismatch");
+static_assert(sizeof(TickRecord) == 408, "TickRecord size mismatch");
+static_assert(offsetof(TickRecord, LastPrice) == 8, "TickRecord layout");
+static_assert(offsetof(TickRecord, Volume) == 216, "TickRecord layout");
+static_assert(offsetof(TickRecord, TradingDay) == 264, "TickRecord layout");
+static_assert(offsetof(TickRecord, InstrumentID) == 312, "TickRecord layout");
+static_assert(offsetof(TickRecord, Timestamp) == 376, "TickRecord layout");
+static_assert(offsetof(TickRecord, LastVolume) == 400, "TickRecord layout");
+
+/* 从LastPrice到AskPrice[4]连续存放的价格字段数 */
+const int kTickPriceCount = 26;
+
+static_assert(offsetof(TickRecord, LastPrice) +
+                      kTickPriceCount * sizeof(double) ==
+                  offsetof(TickRecord, Volume),
+              "TickRecord price fields");
+
+/**
+ * 单生产者环形缓冲区, 生产者为CTP的SPI线程
+ * @remark 缓冲区内存由调用者提供(Node层ArrayBuffer), 本类不负责释放
+ */
+class TickRing {
+ public:
+  static size_t ByteLength(uint32_t capacity) {
+    return sizeof(TickRingHeader) + sizeof(TickRecord) * capacity;
+  }
+
+  /**
+   * 将容量向上取整为2的幂
+   */
+  static uint32_t RoundCapacity(uint32_t capacity) {
+    uint32_t n = 1;
+    while (n < capacity && n < (1u << 30)) {
+      n <<= 1;
+    }
+    return n;
+  }
+
+  /**
+   * @param normalize 是否将值为DBL_MAX的价格字段写为NaN
+   * @param delta_capacity 计算逐笔增量时可容纳的合约数, 为0时不计算
+   */
+  TickRing(void *buffer, uint32_t capacity, bool normalize,
+           uint32_t delta_capacity)
+      : header_(static_cast<TickRingHeader *>(buffer)),
+        records_(reinterpret_cast<TickRecord *>(header_ + 1)),
+        mask_(capacity - 1),
+        cursor_(0),
+        normalize_(normalize),
+        deltas_(delta_capacity > 0 ? new TickDeltaTable(delta_capacity)
+                                   : NULL) {
+    header_->capacity = capacity;
+    header_->record_size = sizeof(TickRecord);
+    header_->cursor.store(0, std::memory_order_relaxed);
+  }
+
+  /**
+   * 写入一条深度行情, 仅可在SPI线程中调用
+   */
+  void Push(const CThostFtdcDepthMarketDataField *data) {
+    TickRecord *r = &records_[cursor_ & mask_];
+
+    /* 先清零序号, Node层读取时可据此判断记录是否被覆盖 */
+    __atomic_store_n(&r->Seq, 0, __ATOMIC_RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    r->LastPrice = data->LastPrice;
+    r->PreSettlementPrice = data->PreSettlementPrice;
+    r->PreClosePrice = data->PreClosePrice;
+    r->PreOpenInterest = data->PreOpenInterest;
+    r->OpenPrice = data->OpenPrice;
+    r->HighestPrice = data->HighestPrice;
+    r->LowestPrice = data->LowestPrice;
+    r->Turnover = data->Turnover;
+    r->OpenInterest = data->OpenInterest;
+    r->ClosePrice = data->ClosePrice;
+    r->SettlementPrice = data->SettlementPrice;
+    r->UpperLimitPrice = data->UpperLimitPrice;
+    r->LowerLimitPrice = data->LowerLimitPrice;
+    r->PreDelta = data->PreDelta;
+    r->CurrDelta = data->CurrDelta;
+    r->AveragePrice = data->AveragePrice;
+    r->BidPrice[0] = data->BidPrice1;
+    r->BidPrice[1] = data->BidPrice2;
+    r->BidPrice[2] = data->BidPrice3;
+    r->BidPrice[3] = data->BidPrice4;
+    r->BidPrice[4] = data->BidPrice5;
+    r->AskPrice[0] = data->AskPrice1;
+    r->AskPrice[1] = data->AskPrice2;
+    r->AskPrice[2] = data->AskPrice3;
+    r->AskPrice[3] = data->AskPrice4;
+    r->AskPrice[4] = data->AskPrice5;
+    r->Valid = CheckPrices(&r->LastPrice);
+
+    r->Volume = data->Volume;
+    r->UpdateMillisec = data->UpdateMillisec;
+    r->BidVolume[0] = data->BidVolume1;
+    r->BidVolume[1] = data->BidVolume2;
+    r->BidVolume[2] = data->BidVolume3;
+    r->BidVolume[3] = data->BidVolume4;
+    r->BidVolume[4] = data->BidVolume5;
+    r->AskVolume[0] = data->AskVolume1;
+    r->AskVolume[1] = data->AskVolume2;
+    r->AskVolume[2] = data->AskVolume3;
+    r->AskVolume[3] = data->AskVolume4;
+    r->AskVolume[4] = data->AskVolume5;
+
+    CopyString(r->TradingDay, data->TradingDay);
+    CopyString(r->ActionDay, data->ActionDay);
+    CopyString(r->UpdateTime, data->UpdateTime);
+    CopyString(r->ExchangeID, data->ExchangeID);
+    CopyString(r->InstrumentID, data->InstrumentID);
+    CopyString(r->ExchangeInstID, data->ExchangeInstID);
+    r->Timestamp = TickTimestamp(data);
+
+    TickDelta delta = {0, 0, 0};
+    if (deltas_) {
+      deltas_->Update(data, delta);
+    }
+    r->LastVolume = delta.LastVolume;
+    r->LastTurnover = delta.LastTurnover;
+    r->OIChange = delta.OIChange;
+    r->Reserved = 0;
+
+    ++cursor_;
+    __atomic_store_n(&r->Seq, cursor_, __ATOMIC_RELEASE);
+    header_->cursor.store(cursor_, std::memory_order_release);
+  }
+
+  /**
+   * 读取写游标, 可在任意线程中调用
+   */
+  uint32_t Cursor() const {
+    return header_->cursor.load(std::memory_order_acquire);
+  }
+
+ private:
+  /**
+   * 检查连续存放的价格字段
+   * @return 有效位
+   */
+  uint32_t CheckPrices(double *prices) const {
+    uint32_t valid = 0;
+    for (int i = 0; i < kTickPriceCount; ++i) {
+      if (prices[i] != DBL_MAX) {
+        valid |= 1u << i;
+      } else if (normalize_) {
+        prices[i] = std::numeric_limits<double>::quiet_NaN();
+      }
+    }
+    return valid;
+  }
+
+  template <size_t N, size_t M>
+  static void CopyString(char (&dst)[N], const char (&src)[M]) {
+    static_assert(N > M, "TickRecord string field too small");
+    memcpy(dst, src, M);
+    memset(dst + M - 1, 0x0, N - M + 1);
+  }
+
+ private:
+  TickRingHeader *header_;
+  TickRecord *records_;
+  uint32_t mask_;
+
+  /* 生产者本地游标 */
+  uint32_t cursor_;
+
+  bool normalize_;
+
+  /* 上一条行情的累计值, 仅SPI线程访问 */
+  std::unique_ptr<TickDeltaTable> deltas_;
+};
+
+} /* namespace node_ctp */
+
+#endif /* TICK_RING_H */
@@ -0,0 +1,125 @@
+#ifndef TICK_TIME_H
+#define TICK_TIME_H
+
+#include <cstdint>
+#include "ThostFtdcUserApiStruct.h"
+
+/**
+ * 此文件中定义深度行情时间->UTC毫秒时间戳的换算
+ */
+
+namespace node_ctp {
+
+/* 行情时间为中国标准时间(UTC+8) */
+const int64_t kChinaTimeOffsetMs = 8 * 3600 * 1000;
+
+/**
+ * 公历日期->距1970-01-01的天数
+ */
+inline int64_t DaysFromCivil(int year, int month, int day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yoe = year - era * 400;
+  int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe - 719468;
+}
+
+/**
+ * 解析YYYYMMDD格式的日期
+ * @param days 距1970-01-01的天数
+ */
+inline bool ParseTickDate(const char *str, int64_t &days) {
+  int value[8];
+  for (int i = 0; i < 8; ++i) {
+    if (str[i] < '0' || str[i] > '9') {
+      return false;
+    }
+    value[i] = str[i] - '0';
+  }
+  int year = value[0] * 1000 + value[1] * 100 + value[2] * 10 + value[3];
+  int month = value[4] * 10 + value[5];
+  int day = value[6] * 10 + value[7];
+  if (month < 1 || month > 12 || day < 1 || day > 31) {
+    return false;
+  }
+  days = DaysFromCivil(year, month, day);
+  return true;
+}
+
+/**
+ * 解析HH:MM:SS格式的时间
+ * @param seconds 距0点的秒数
+ */
+inline bool ParseTickTime(const char *str, int &seconds) {
+  static const int kDigits[] = {0, 1, 3, 4, 6, 7};
+  int value[6];
+  for (int i = 0; i < 6; ++i) {
+    char c = str[kDigits[i]];
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    value[i] = c - '0';
+  }
+  if (str[2] != ':' || str[5] != ':') {
+    return false;
+  }
+  int hour = value[0] * 10 + value[1];
+  int minute = value[2] * 10 + value[3];
+  int second = value[4] * 10 + value[5];
+  if (hour > 23 || minute > 59 || second > 60) {
+    return false;
+  }
+  seconds = hour * 3600 + minute * 60 + second;
+  return true;
+}
+
+/**
+ * 前一个工作日(跳过周六周日)
+ */
+inline int64_t PrevWeekday(int64_t days) {
+  /* 1970-01-01为周四, weekday为0时表示周日 */
+  int64_t weekday = ((days + 4) % 7 + 7) % 7;
+  return days - (weekday == 1 ? 3 : weekday == 0 ? 2 : 1);
+}
+
+/**
+ * 深度行情时间->UTC毫秒时间戳
+ * @return 日期或时间无法解析时返回0
+ * @remark 日盘使用ActionDay, ActionDay为空时使用TradingDay.
+ * 部分交易所夜盘的ActionDay与TradingDay相同, 并非自然日. 由于节假日前
+ * 不开夜盘, 夜盘总是位于TradingDay的前一个工作日晚间, 因此18点之后的
+ * 行情取前一个工作日, 0点至6点的行情取前一个工作日的次日
+ */
+inline double TickTimestamp(const CThostFtdcDepthMarketDataField *data) {
+  int seconds = 0;
+  if (!ParseTickTime(data->UpdateTime, seconds)) {
+    return 0;
+  }
+
+  int64_t action_day = 0;
+  int64_t trading_day = 0;
+  bool has_action_day = ParseTickDate(data->ActionDay, action_day);
+  bool has_trading_day = ParseTickDate(data->TradingDay, trading_day);
+
+  int hour = seconds / 3600;
+  bool night = hour >= 18 || hour < 6;
+  int64_t days = 0;
+  if (night && has_trading_day &&
+      (!has_action_day || action_day == trading_day)) {
+    days = PrevWeekday(trading_day) + (hour < 6 ? 1 : 0);
+  } else if (has_action_day) {
+    days = action_day;
+  } else if (has_trading_day) {
+    days = trading_day;
+  } else {
+    return 0;
+  }
+
+  return static_cast<double>((days * 86400 + seconds) * 1000 +
+                             data->UpdateMillisec - kChinaTimeOffsetMs);
+}
+
+} /* namespace node_ctp */
+
+#endif /* TICK_TIME_H */
@@ -0,0 +1,146 @@
+'use strict'
+
+/**
+ * C++层K线聚合: 周期边界, 成交量增量及正在聚合的K线
+ */
+
+const assert = require('assert')
+const { MockMd, writeTicks, chinaTime, waitFor, run } = require('./common')
+
+const DAY = '20180102'
+
+const TICKS = [
+  ['rb1805', '09:00:00', 0, 100, 10, 1000, 500],
+  ['cu1803', '09:00:05', 0, 500, 1, 5000, 80],
+  ['rb1805', '09:00:10', 0, 101, 12, 1202, 502],
+  ['rb1805', '09:00:59', 500, 99, 15, 1499, 503],
+  ['rb1805', '09:01:00', 0, 100, 20, 1999, 504],
+  ['rb1805', '09:01:30', 0, 102, 21, 2101, 505],
+  ['rb1805', '09:02:00', 0, 103, 25, 2513, 506],
+  ['cu1803', '09:02:05', 0, 501, 3, 15020, 81]
+].map(([id, time, millisec, price, volume, turnover, position]) => ({
+  TradingDay: DAY,
+  ActionDay: DAY,
+  InstrumentID: id,
+  UpdateTime: time,
+  UpdateMillisec: millisec,
+  LastPrice: price,
+  Volume: volume,
+  Turnover: turnover,
+  OpenInterest: position
+}))
+
+/* 每个合约的第一条行情只作为成交量基准, K线在下一个周期的首条行情到达时完成 */
+const CLOSED = [{
+  InstrumentID: 'rb1805',
+  TradingDay: DAY,
+  Interval: 60,
+  StartTime: chinaTime(DAY, '09:00:00'),
+  EndTime: chinaTime(DAY, '09:00:59', 500),
+  OpenPrice: 100,
+  HighestPrice: 101,
+  LowestPrice: 99,
+  ClosePrice: 99,
+  Volume: 5,
+  Turnover: 499,
+  OpenInterest: 503,
+  TickCount: 3,
+  Closed: true
+}, {
+  InstrumentID: 'rb1805',
+  TradingDay: DAY,
+  Interval: 60,
+  StartTime: chinaTime(DAY, '09:01:00'),
+  EndTime: chinaTime(DAY, '09:01:30'),
+  OpenPrice: 100,
+  HighestPrice: 102,
+  LowestPrice: 100,
+  ClosePrice: 102,
+  Volume: 6,
+  Turnover: 602,
+  OpenInterest: 505,
+  TickCount: 2,
+  Closed: true
+}, {
+  InstrumentID: 'cu1803',
+  TradingDay: DAY,
+  Interval: 60,
+  StartTime: chinaTime(DAY, '09:00:00'),
+  EndTime: chinaTime(DAY, '09:00:05'),
+  OpenPrice: 500,
+  HighestPrice: 500,
+  LowestPrice: 500,
+  ClosePrice: 500,
+  Volume: 0,
+  Turnover: 0,
+  OpenInterest: 80,
+  TickCount: 1,
+  Closed: true
+}]
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_bars.csv', TICKS)
+
+class BarMd extends MockMd {
+  constructor (options) {
+    super(['rb1805', 'cu1803'])
+    this.bars = []
+    this.enableBars([60], options)
+  }
+
+  onRtnBar (bars) {
+    this.bars.push(...bars)
+  }
+}
+
+function closedBars (md) {
+  return md.bars.filter((bar) => bar.Closed)
+}
+
+/**
+ * 只推送完成的K线, 不再回调onRtnDepthMarketData
+ */
+async function testClosed () {
+  const md = new BarMd({ capacity: 16 })
+  await md.start('/tmp/node_ctp_test_bars@')
+  await waitFor(() => closedBars(md).length === CLOSED.length, 5000,
+    'bars not closed')
+
+  assert.deepStrictEqual(md.bars, CLOSED)
+  assert.strictEqual(md.ticks.length, 0, 'ticks forwarded')
+  await md.exit()
+}
+
+/**
+ * 同时推送正在聚合的K线及逐条行情
+ */
+async function testUpdates () {
+  const md = new BarMd({ capacity: 16, updates: true, ticks: true })
+  await md.start('/tmp/node_ctp_test_bars_updates@')
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+  await waitFor(() => closedBars(md).length === CLOSED.length, 5000,
+    'bars not closed')
+
+  assert.deepStrictEqual(closedBars(md), CLOSED)
+
+  /* 最后一次变更通知为最后一条行情开始的K线 */
+  const open = md.bars.filter((bar) => !bar.Closed &&
+    bar.InstrumentID === 'rb1805').pop()
+  assert.strictEqual(open.StartTime, chinaTime(DAY, '09:02:00'))
+  assert.strictEqual(open.OpenPrice, 103)
+  assert.strictEqual(open.ClosePrice, 103)
+  assert.strictEqual(open.Volume, 4)
+  assert.strictEqual(open.TickCount, 1)
+  await md.exit()
+}
+
+async function main () {
+  await testClosed()
+  await testUpdates()
+  console.log('bars ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
@@ -0,0 +1,134 @@
+'use strict'
+
+/**
+ * 模拟前置机测试的公共函数, 需要先执行npm run build:mock链接模拟前置机
+ */
+
+const assert = require('assert')
+const fs = require('fs')
+const os = require('os')
+const path = require('path')
+const ctp = require('../lib/index')
+
+/* 模拟前置机不校验地址 */
+const MOCK_FRONT = 'tcp://127.0.0.1:0'
+
+function sleep (ms) {
+  return new Promise((resolve) => setTimeout(resolve, ms))
+}
+
+/**
+ * 轮询等待条件成立
+ * @param predicate 条件函数
+ * @param timeout 超时时间(毫秒), 超时后抛出异常
+ * @param message 超时时的错误信息
+ */
+async function waitFor (predicate, timeout = 5000, message = 'timeout') {
+  const deadline = Date.now() + timeout
+  while (!predicate()) {
+    if (Date.now() > deadline) {
+      throw new Error(message)
+    }
+    await sleep(10)
+  }
+}
+
+/**
+ * 确认已链接模拟前置机, 真实API会连接到外部前置机
+ */
+async function assertMock (api) {
+  assert.strictEqual(await api.getApiVersion(), 'mock',
+    '请先执行npm run build:mock链接模拟前置机')
+}
+
+/**
+ * 写入模拟前置机的行情回放文件(CTP_MOCK_MD_REPLAY), 首行为各行字段名的并集
+ * @param name 文件名, 写入系统临时目录
+ * @param ticks 行情对象数组
+ * @return 文件路径
+ */
+function writeTicks (name, ticks) {
+  let fields = []
+  for (let tick of ticks) {
+    for (let field of Object.keys(tick)) {
+      if (fields.indexOf(field) < 0) {
+        fields.push(field)
+      }
+    }
+  }
+  const lines = ticks.map((tick) => fields.map((field) =>
+    tick[field] === undefined ? '' : String(tick[field])).join(','))
+  const file = path.join(os.tmpdir(), name)
+  fs.writeFileSync(file, [fields.join(',')].concat(lines).join('\n') + '\n')
+  return file
+}
+
+/**
+ * 连接模拟前置机, 登录后订阅指定合约的行情实例
+ */
+class MockMd extends ctp.CtpMd {
+  /**
+   * @param instruments 登录后订阅的合约, 为空数组时不订阅
+   * @param options CtpMd构造函数的可选参数
+   */
+  constructor (instruments = [], options = {}) {
+    super(false, options)
+    this.instruments = instruments
+    this.ticks = []
+    this.loggedIn = 0
+  }
+
+  async start (flowPath) {
+    await this.createFtdcMdApi(flowPath)
+    await assertMock(this)
+    await this.registerFront(MOCK_FRONT)
+    await this.init()
+  }
+
+  async onFrontConnected () {
+    await this.reqUserLogin({}, 1)
+  }
+
+  async onRspUserLogin () {
+    this.loggedIn++
+    if (this.instruments.length) {
+      await this.subscribeMarketData(this.instruments)
+    }
+  }
+
+  onRtnDepthMarketData (data) {
+    this.ticks.push(data)
+  }
+}
+
+/**
+ * 行情时间(北京时间)->UTC毫秒时间戳
+ * @param day YYYYMMDD
+ * @param time HH:MM:SS
+ */
+function chinaTime (day, time, millisec = 0) {
+  const [hour, minute, second] = time.split(':').map(Number)
+  return Date.UTC(Number(day.slice(0, 4)), Number(day.slice(4, 6)) - 1,
+    Number(day.slice(6, 8)), hour - 8, minute, second, millisec)
+}
+
+/**
+ * 执行测试函数, 失败时输出错误并设置返回值
+ */
+function run (test) {
+  test().catch((err) => {
+    console.error(err.stack || err.message)
+    process.exitCode = 1
+  })
+}
+
+module.exports = {
+  MOCK_FRONT,
+  sleep,
+  waitFor,
+  assertMock,
+  writeTicks,
+  MockMd,
+  chinaTime,
+  run
+}
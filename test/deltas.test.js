@@ -0,0 +1,112 @@
+'use strict'
+
+/**
+ * 逐笔增量字段: 按合约相减, 累计值回退, 交易日切换及表满
+ */
+
+const assert = require('assert')
+const { MockMd, writeTicks, waitFor, run } = require('./common')
+
+/* [合约, 交易日, 成交量, 成交金额, 持仓量, 昨持仓量, 期望的LastVolume, LastTurnover, OIChange] */
+const CASES = [
+  /* 合约的第一条行情增量为0 */
+  ['rb1805', '20180102', 10, 1000, 500, 490, 0, 0, 0],
+  ['cu1803', '20180102', 1, 5000, 80, 80, 0, 0, 0],
+  ['rb1805', '20180102', 12, 1202, 502, 490, 2, 202, 2],
+  /* 累计值回退时增量为0, 并以新值为基准 */
+  ['rb1805', '20180102', 11, 1100, 501, 490, 0, 0, 0],
+  ['rb1805', '20180102', 15, 1500, 499, 490, 4, 400, -2],
+  /* 交易日切换后从0开始累计, 持仓量与昨持仓量相比 */
+  ['rb1805', '20180103', 3, 300, 495, 499, 3, 300, -4],
+  ['cu1803', '20180102', 3, 15020, 81, 80, 2, 10020, 1]
+]
+
+const TICKS = CASES.map(([id, day, volume, turnover, position, pre], i) => ({
+  TradingDay: day,
+  InstrumentID: id,
+  Volume: volume,
+  Turnover: turnover,
+  OpenInterest: position,
+  PreOpenInterest: pre,
+  UpdateTime: `09:00:0${i}`
+}))
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_deltas.csv', TICKS)
+
+class DeltaMd extends MockMd {
+  constructor (options, ring) {
+    super(['rb1805', 'cu1803'], options)
+    this.records = []
+    if (ring) {
+      this.enableTickRing(16)
+    }
+  }
+
+  onRtnDepthMarketDataRing (ring, begin, end) {
+    for (let i = begin; i !== end; i = (i + 1) >>> 0) {
+      this.records.push(ring.at(i).toObject())
+    }
+  }
+}
+
+/**
+ * @param overflow 超出表容量的合约, 增量始终为0
+ */
+function checkDeltas (ticks, overflow) {
+  assert.strictEqual(ticks.length, CASES.length)
+  ticks.forEach((tick, i) => {
+    const [id, , , , , , volume, turnover, position] = CASES[i]
+    assert.strictEqual(tick.InstrumentID, id)
+    const expected = id === overflow ? [0, 0, 0] : [volume, turnover, position]
+    assert.deepStrictEqual([tick.LastVolume, tick.LastTurnover, tick.OIChange],
+      expected, `tick ${i}`)
+  })
+}
+
+async function testObjects () {
+  const md = new DeltaMd({ deltas: true })
+  await md.start('/tmp/node_ctp_test_deltas@')
+  await waitFor(() => md.ticks.length === CASES.length, 5000,
+    'ticks not received')
+  checkDeltas(md.ticks)
+  await md.exit()
+}
+
+/**
+ * 零拷贝行情记录中同样填写增量, 表满后新合约的增量为0
+ */
+async function testRing () {
+  const md = new DeltaMd({ deltas: true, deltaCapacity: 1 }, true)
+  await md.start('/tmp/node_ctp_test_deltas_ring@')
+  await waitFor(() => md.records.length === CASES.length, 5000,
+    'ticks not received')
+  checkDeltas(md.records, 'cu1803')
+  await md.exit()
+}
+
+/**
+ * 未开启时不附加增量字段
+ */
+async function testDisabled () {
+  const md = new DeltaMd()
+  await md.start('/tmp/node_ctp_test_deltas_off@')
+  await waitFor(() => md.ticks.length === CASES.length, 5000,
+    'ticks not received')
+  for (let tick of md.ticks) {
+    assert.ok(!('LastVolume' in tick))
+    assert.ok(!('OIChange' in tick))
+  }
+  await md.exit()
+}
+
+async function main () {
+  await testObjects()
+  await testRing()
+  await testDisabled()
+  console.log('deltas ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
@@ -0,0 +1,109 @@
+'use strict'
+
+/**
+ * 深度行情字段投影及无效价格(DBL_MAX)的处理方式
+ */
+
+const assert = require('assert')
+const { MockMd, writeTicks, waitFor, run } = require('./common')
+
+const EVENT = 'RtnDepthMarketData'
+
+/* 回放文件中的空值为DBL_MAX, 与真实行情中的无效价格一致 */
+const TICKS = [{
+  TradingDay: '20180102',
+  InstrumentID: 'rb1805',
+  LastPrice: 3500,
+  Volume: 10,
+  ClosePrice: 3510,
+  BidPrice1: 3499,
+  UpdateTime: '09:00:00'
+}, {
+  TradingDay: '20180102',
+  InstrumentID: 'rb1805',
+  LastPrice: 3501,
+  Volume: 12,
+  UpdateTime: '09:00:01'
+}]
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_fields.csv', TICKS)
+
+async function receive (md, flowPath) {
+  await md.start(flowPath)
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+  await md.exit()
+  return md.ticks
+}
+
+/**
+ * 投影后只包含选中的字段, 按结构体中的声明顺序排列
+ */
+async function testProjection () {
+  const md = new MockMd(['rb1805'])
+  md.setFields(EVENT, ['Volume', 'LastPrice', 'InstrumentID'])
+
+  /* 未知字段抛出TypeError, 原有投影保持不变 */
+  assert.throws(() => md.setFields(EVENT, ['LastPrice', 'Unknown']),
+    (err) => err instanceof TypeError && /Unknown/.test(err.message))
+  assert.throws(() => md.setFields('RspUserLogin', ['UserID']), Error)
+
+  const ticks = await receive(md, '/tmp/node_ctp_test_fields@')
+  ticks.forEach((tick, i) => {
+    assert.deepStrictEqual(tick, {
+      InstrumentID: TICKS[i].InstrumentID,
+      LastPrice: TICKS[i].LastPrice,
+      Volume: TICKS[i].Volume
+    })
+    assert.deepStrictEqual(Object.keys(tick),
+      ['InstrumentID', 'LastPrice', 'Volume'])
+  })
+}
+
+/**
+ * 各处理方式下无效价格的取值, 有效价格不受影响
+ */
+async function testInvalidPrice () {
+  const cases = {
+    keep: (tick, key) => assert.strictEqual(tick[key], Number.MAX_VALUE),
+    nan: (tick, key) => assert.ok(Number.isNaN(tick[key]), `${key} not NaN`),
+    skip: (tick, key) => assert.ok(!(key in tick), `${key} not omitted`)
+  }
+
+  for (let mode of Object.keys(cases)) {
+    const md = new MockMd(['rb1805'], { invalidPrice: mode })
+    const ticks = await receive(md, `/tmp/node_ctp_test_fields_${mode}@`)
+
+    assert.strictEqual(ticks[0].ClosePrice, 3510, mode)
+    assert.strictEqual(ticks[0].BidPrice1, 3499, mode)
+    assert.strictEqual(ticks[1].LastPrice, 3501, mode)
+    cases[mode](ticks[1], 'ClosePrice')
+    cases[mode](ticks[1], 'BidPrice1')
+  }
+
+  assert.throws(() => new MockMd([], { invalidPrice: 'null' }), TypeError)
+}
+
+/**
+ * 投影与无效价格处理同时生效
+ */
+async function testProjectionSkip () {
+  const md = new MockMd(['rb1805'], { invalidPrice: 'skip' })
+  md.setFields(EVENT, ['InstrumentID', 'ClosePrice'])
+
+  const ticks = await receive(md, '/tmp/node_ctp_test_fields_projection@')
+  assert.deepStrictEqual(ticks[0], { InstrumentID: 'rb1805', ClosePrice: 3510 })
+  assert.deepStrictEqual(ticks[1], { InstrumentID: 'rb1805' })
+}
+
+async function main () {
+  await testProjection()
+  await testInvalidPrice()
+  await testProjectionSkip()
+  console.log('fields ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
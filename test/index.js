@@ -0,0 +1,71 @@
+'use strict'
+
+/**
+ * 模拟前置机测试入口, 需要先执行npm run build:mock链接模拟前置机
+ *
+ * 用法: node test/index.js [filter]
+ *   filter 只运行文件名包含该字符串的测试
+ *
+ * 每个测试在独立的子进程中运行, 模拟前置机通过环境变量配置.
+ * md.test.js及td.test.js连接SimNow前置机, 需要手动运行, 不在此列
+ */
+
+const path = require('path')
+const { fork } = require('child_process')
+
+const TESTS = [
+  'bars.test.js',
+  'deltas.test.js',
+  'fields.test.js',
+  'listeners.test.js',
+  'replay.test.js',
+  'snapshot.test.js',
+  'subscription.test.js',
+  'tick_ring.test.js',
+  'worker.test.js'
+]
+
+/**
+ * Node 10.5至11.6中worker_threads需要--experimental-worker参数才能加载
+ */
+function workerArgs () {
+  try {
+    require('worker_threads')
+    return []
+  } catch (err) {
+    const [major, minor] = process.versions.node.split('.').map(Number)
+    return (major === 10 && minor >= 5) || major === 11
+      ? ['--experimental-worker'] : []
+  }
+}
+
+function run (file) {
+  return new Promise((resolve) => {
+    const child = fork(path.join(__dirname, file), [], {
+      env: Object.assign({}, process.env, { CTP_MOCK_SEED: '1' }),
+      execArgv: process.execArgv.concat(workerArgs())
+    })
+    child.on('exit', (code, signal) => resolve(code === 0 && !signal))
+  })
+}
+
+async function main () {
+  const filter = process.argv[2] || ''
+  let failures = []
+
+  for (let file of TESTS.filter((item) => item.indexOf(filter) >= 0)) {
+    console.log(`running ${file} ...`)
+    if (!await run(file)) {
+      failures.push(file)
+    }
+  }
+
+  for (let file of failures) {
+    console.error(`failed: ${file}`)
+  }
+  process.exitCode = failures.length ? 1 : 0
+}
+
+if (require.main === module) {
+  main()
+}
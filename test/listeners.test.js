@@ -0,0 +1,142 @@
+'use strict'
+
+/**
+ * 附加监听函数: 合约过滤, 分发过程中添加/移除监听函数及按合约路由
+ */
+
+const assert = require('assert')
+const { MockMd, writeTicks, waitFor, run } = require('./common')
+
+const INSTRUMENTS = ['rb1805', 'cu1803', 'SR805']
+
+/* 最后一条为rb1805, 收到该条时之前的行情都已分发 */
+const TICKS = [
+  ['rb1805', 3500],
+  ['cu1803', 52000],
+  ['SR805', 5800],
+  ['cu1803', 52010],
+  ['rb1805', 3501],
+  ['rb1805', 3499]
+].map(([id, price], i) => ({
+  TradingDay: '20180102',
+  InstrumentID: id,
+  LastPrice: price,
+  Volume: i + 1,
+  UpdateTime: `09:00:0${i}`
+}))
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_listeners.csv', TICKS)
+
+const EVENT = 'RtnDepthMarketData'
+
+function ids (ticks) {
+  return ticks.map((tick) => tick.InstrumentID)
+}
+
+function expected (instruments) {
+  return ids(TICKS).filter((id) => instruments.indexOf(id) >= 0)
+}
+
+/**
+ * 多个监听函数共享主回调函数的数据对象, 按合约过滤
+ */
+async function testFilter () {
+  const md = new MockMd(INSTRUMENTS)
+  const all = []
+  const rb = []
+  const cuSr = []
+  const none = []
+  md.addListener(EVENT, (data) => all.push(data))
+  md.addListener(EVENT, (data) => rb.push(data), ['rb1805'])
+  md.addListener(EVENT, (data) => cuSr.push(data), ['cu1803', 'SR805'])
+  md.addListener(EVENT, (data) => none.push(data), ['IF1801'])
+
+  await md.start('/tmp/node_ctp_test_listeners@')
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+
+  assert.deepStrictEqual(ids(md.ticks), ids(TICKS))
+  assert.deepStrictEqual(ids(all), ids(TICKS))
+  assert.deepStrictEqual(ids(rb), expected(['rb1805']))
+  assert.deepStrictEqual(ids(cuSr), expected(['cu1803', 'SR805']))
+  assert.strictEqual(none.length, 0)
+
+  /* 每条行情只转换一次 */
+  all.forEach((data, i) => assert.strictEqual(data, md.ticks[i]))
+  assert.strictEqual(rb[0], md.ticks[0])
+
+  assert.strictEqual(md.removeListener(9999), false)
+  await md.exit()
+}
+
+/**
+ * 分发过程中移除的监听函数不再调用, 添加的监听函数从下一条行情开始调用
+ */
+async function testModifyInDispatch () {
+  const md = new MockMd(INSTRUMENTS)
+  const first = []
+  const removed = []
+  const added = []
+  let removedId = 0
+  let addedId = 0
+
+  const firstId = md.addListener(EVENT, (data) => {
+    first.push(data)
+    if (first.length === 1) {
+      assert.strictEqual(md.removeListener(removedId), true)
+      addedId = md.addListener(EVENT, (data) => added.push(data))
+    } else if (first.length === 3) {
+      /* 移除自身 */
+      assert.strictEqual(md.removeListener(firstId), true)
+    }
+  })
+  removedId = md.addListener(EVENT, (data) => removed.push(data))
+
+  await md.start('/tmp/node_ctp_test_listeners_modify@')
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+
+  assert.deepStrictEqual(ids(first), ids(TICKS.slice(0, 3)))
+  assert.strictEqual(removed.length, 0)
+  assert.deepStrictEqual(ids(added), ids(TICKS.slice(1)))
+  assert.strictEqual(md.removeListener(removedId), false)
+  assert.strictEqual(md.removeListener(firstId), false)
+  assert.strictEqual(md.removeListener(addedId), true)
+  await md.exit()
+}
+
+/**
+ * 开启路由后行情只传递给指定了该合约的监听函数
+ */
+async function testRouting () {
+  const md = new MockMd(INSTRUMENTS)
+  const all = []
+  const rb = []
+  const cu = []
+  md.addListener(EVENT, (data) => all.push(data))
+  md.addListener(EVENT, (data) => rb.push(data), ['rb1805'])
+  md.addListener(EVENT, (data) => cu.push(data), ['cu1803'])
+  md.enableRouting()
+
+  await md.start('/tmp/node_ctp_test_listeners_routing@')
+  await waitFor(() => rb.length === expected(['rb1805']).length, 5000,
+    'routed ticks not received')
+
+  assert.deepStrictEqual(ids(rb), expected(['rb1805']))
+  assert.deepStrictEqual(ids(cu), expected(['cu1803']))
+  assert.strictEqual(md.ticks.length, 0, 'routed ticks sent to primary')
+  assert.strictEqual(all.length, 0, 'routed ticks sent to unfiltered')
+  await md.exit()
+}
+
+async function main () {
+  await testFilter()
+  await testModifyInDispatch()
+  await testRouting()
+  console.log('listeners ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
@@ -2,9 +2,9 @@
 
 const ctp = require('../lib/index')
 
-/* SimNow测试用前置机地址 */
+/* SimNow测试用前置机地址, 可通过环境变量CTP_MD_FRONT覆盖(如使用模拟前置机) */
 // eslint-disable-next-line no-unused-vars
-const MD_FRONT_API = 'tcp://180.168.146.187:10031'
+const MD_FRONT_API = process.env.CTP_MD_FRONT || 'tcp://180.168.146.187:10031'
 
 /* SimNow模拟用前置机地址 */
 // eslint-disable-next-line no-unused-vars
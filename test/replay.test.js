@@ -0,0 +1,74 @@
+'use strict'
+
+/**
+ * 事件日志回放: 回放顺序与记录顺序一致, 回放与实盘API互斥
+ */
+
+const assert = require('assert')
+const fs = require('fs')
+const os = require('os')
+const path = require('path')
+const { MockMd, writeTicks, waitFor, run } = require('./common')
+
+const INSTRUMENTS = ['rb1805', 'cu1803', 'SR805']
+const COUNT = 30
+
+const TICKS = Array.from({ length: COUNT }, (_, i) => ({
+  TradingDay: '20180102',
+  InstrumentID: INSTRUMENTS[(i * 7) % INSTRUMENTS.length],
+  LastPrice: 1000 + i,
+  Volume: i + 1,
+  UpdateTime: `09:00:${String(i).padStart(2, '0')}`
+}))
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_replay.csv', TICKS)
+
+function summary (ticks) {
+  return ticks.map((tick) => `${tick.InstrumentID}@${tick.UpdateTime}#${tick.Volume}`)
+}
+
+/**
+ * 记录实盘行情
+ * @return 按到达顺序的行情
+ */
+async function record (prefix) {
+  const md = new MockMd(INSTRUMENTS)
+  md.startJournal(prefix)
+  await md.start('/tmp/node_ctp_test_record@')
+  await waitFor(() => md.ticks.length === COUNT, 5000, 'ticks not received')
+  md.stopJournal()
+  await md.exit()
+  return md.ticks
+}
+
+async function main () {
+  const dir = fs.mkdtempSync(path.join(os.tmpdir(), 'node_ctp_replay_'))
+  const prefix = path.join(dir, 'md')
+  const recorded = await record(prefix)
+  assert.deepStrictEqual(summary(recorded), summary(TICKS))
+
+  /* 回放期间不能创建API, 也不能再次回放 */
+  const player = new MockMd()
+  const replay = player.replay(prefix, 0)
+  await assert.rejects(player.createFtdcMdApi('/tmp/node_ctp_test_replay@'),
+    /while replaying/)
+  await assert.rejects(player.replay(prefix, 0), /already running/)
+
+  assert.strictEqual(await replay, COUNT)
+  assert.deepStrictEqual(summary(player.ticks), summary(recorded))
+  assert.deepStrictEqual(player.ticks, recorded)
+  await player.exit()
+
+  /* 创建API后不能回放 */
+  const live = new MockMd()
+  await live.createFtdcMdApi('/tmp/node_ctp_test_live@')
+  await assert.rejects(live.replay(prefix, 0), /after API created/)
+  await live.exit()
+
+  console.log('replay ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
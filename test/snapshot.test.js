@@ -0,0 +1,130 @@
+'use strict'
+
+/**
+ * 最新行情快照表: 按合约查询, 批量查询, 表满及合并推送模式
+ */
+
+const assert = require('assert')
+const { MockMd, writeTicks, waitFor, run } = require('./common')
+
+const INSTRUMENTS = ['rb1805', 'cu1803', 'SR805']
+
+/* 各合约交替推送, 合约按首次出现的顺序为rb1805, cu1803, SR805 */
+const TICKS = [
+  ['rb1805', 3500, 10],
+  ['cu1803', 52000, 5],
+  ['rb1805', 3501, 12],
+  ['SR805', 5800, 1],
+  ['cu1803', 52010, 8],
+  ['rb1805', 3499, 20]
+].map(([id, price, volume], i) => ({
+  TradingDay: '20180102',
+  InstrumentID: id,
+  LastPrice: price,
+  Volume: volume,
+  UpdateTime: `09:00:0${i}`
+}))
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_snapshot.csv', TICKS)
+
+class SnapshotMd extends MockMd {
+  constructor (capacity, conflate) {
+    super(INSTRUMENTS)
+    this.changed = new Set()
+    this.enableSnapshot(capacity, conflate)
+  }
+
+  onRtnDepthMarketDataChanged (instrumentIds) {
+    for (let id of instrumentIds) {
+      this.changed.add(id)
+    }
+  }
+}
+
+/**
+ * 合约的最后一条行情
+ */
+function lastTick (id) {
+  return TICKS.filter((tick) => tick.InstrumentID === id).pop()
+}
+
+function checkSnapshot (snapshot, id) {
+  const tick = lastTick(id)
+  assert.ok(snapshot, `${id} missing`)
+  assert.strictEqual(snapshot.InstrumentID, id)
+  assert.strictEqual(snapshot.LastPrice, tick.LastPrice)
+  assert.strictEqual(snapshot.Volume, tick.Volume)
+  assert.strictEqual(snapshot.UpdateTime, tick.UpdateTime)
+}
+
+async function testLookup () {
+  const md = new SnapshotMd(8, false)
+  await md.start('/tmp/node_ctp_test_snapshot@')
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+
+  for (let id of INSTRUMENTS) {
+    checkSnapshot(md.getSnapshot(id), id)
+  }
+  assert.strictEqual(md.getSnapshot('IF1801'), undefined)
+
+  const all = md.getSnapshots()
+  assert.deepStrictEqual(all.map((item) => item.InstrumentID).sort(),
+    INSTRUMENTS.slice().sort())
+
+  /* 按数组查询时结果与参数一一对应, 不存在的合约为空位 */
+  const some = md.getSnapshots(['cu1803', 'IF1801', 'rb1805'])
+  assert.strictEqual(some.length, 3)
+  checkSnapshot(some[0], 'cu1803')
+  assert.strictEqual(some[1], undefined)
+  checkSnapshot(some[2], 'rb1805')
+  await md.exit()
+}
+
+/**
+ * 表满后新出现的合约不再保存, 已有合约继续更新
+ */
+async function testCapacity () {
+  const md = new SnapshotMd(2, false)
+  await md.start('/tmp/node_ctp_test_snapshot_full@')
+  await waitFor(() => md.ticks.length === TICKS.length, 5000,
+    'ticks not received')
+
+  checkSnapshot(md.getSnapshot('rb1805'), 'rb1805')
+  checkSnapshot(md.getSnapshot('cu1803'), 'cu1803')
+  assert.strictEqual(md.getSnapshot('SR805'), undefined)
+  assert.strictEqual(md.getSnapshots().length, 2)
+  await md.exit()
+}
+
+/**
+ * 合并推送模式只通知变更的合约, 快照为最新行情
+ */
+async function testConflate () {
+  const md = new SnapshotMd(8, true)
+  await md.start('/tmp/node_ctp_test_snapshot_conflate@')
+  await waitFor(() => INSTRUMENTS.every((id) => {
+    const snapshot = md.getSnapshot(id)
+    return snapshot && snapshot.Volume === lastTick(id).Volume
+  }), 5000, 'snapshots not updated')
+  await waitFor(() => md.changed.size === INSTRUMENTS.length, 5000,
+    'changes not notified')
+
+  assert.strictEqual(md.ticks.length, 0, 'ticks forwarded in conflate mode')
+  for (let id of INSTRUMENTS) {
+    checkSnapshot(md.getSnapshot(id), id)
+  }
+  await md.exit()
+}
+
+async function main () {
+  await testLookup()
+  await testCapacity()
+  await testConflate()
+  console.log('snapshot ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
@@ -0,0 +1,100 @@
+'use strict'
+
+/**
+ * 行情订阅集合: 分块发送订阅请求, 断线重连并登录后自动重新订阅
+ */
+
+const assert = require('assert')
+const { MockMd, waitFor, run } = require('./common')
+
+const INSTRUMENTS = ['rb1805', 'cu1803', 'SR805', 'IF1801', 'au1806', 'm1805',
+  'ag1806']
+const CHUNK = 2
+const CHUNKS = Math.ceil(INSTRUMENTS.length / CHUNK)
+
+/* 约1秒后(推送2000条行情)模拟断线重连, 首次订阅的检查在此之前完成 */
+process.env.CTP_MOCK_TICK_RATE = '2000'
+process.env.CTP_MOCK_DISCONNECT = '2000'
+
+class SubscriptionMd extends MockMd {
+  constructor () {
+    /* 由订阅集合发送订阅请求, 登录后不直接订阅 */
+    super([], { subscribeChunk: CHUNK, subscribeInterval: 5 })
+    this.responses = []
+    this.chunks = 0
+    this.disconnected = 0
+  }
+
+  onFrontDisconnected (reason) {
+    this.disconnected++
+    this.disconnectedAt = this.ticks.length
+  }
+
+  onRspSubMarketData (data, info, requestId, isLast) {
+    this.responses.push(data.InstrumentID)
+    if (isLast) {
+      this.chunks++
+    }
+  }
+}
+
+function allActive (md) {
+  const { instruments } = md.getSubscriptions()
+  return INSTRUMENTS.every((id) => instruments[id] &&
+    instruments[id].state === 'active')
+}
+
+/**
+ * 每个合约在from之后都收到了行情
+ */
+function allTicking (md, from) {
+  const ids = new Set(md.ticks.slice(from).map((tick) => tick.InstrumentID))
+  return INSTRUMENTS.every((id) => ids.has(id))
+}
+
+async function main () {
+  const md = new SubscriptionMd()
+  const { added, removed } = md.setSubscriptions(INSTRUMENTS)
+  assert.strictEqual(added, INSTRUMENTS.length)
+  assert.strictEqual(removed, 0)
+
+  let status = md.getSubscriptions()
+  /* 登录前不发送订阅请求 */
+  assert.strictEqual(status.loggedIn, false)
+  assert.strictEqual(status.pending, false)
+  for (let id of INSTRUMENTS) {
+    assert.strictEqual(status.instruments[id].state, 'pending')
+  }
+
+  await md.start('/tmp/node_ctp_test_subscription@')
+  await waitFor(() => allActive(md), 5000, 'not subscribed')
+  await waitFor(() => allTicking(md, 0), 5000, 'ticks not received')
+  assert.strictEqual(md.responses.length, INSTRUMENTS.length)
+  assert.strictEqual(md.chunks, CHUNKS, 'requests not chunked')
+
+  status = md.getSubscriptions()
+  assert.strictEqual(status.loggedIn, true)
+  assert.strictEqual(status.pending, false)
+  for (let id of INSTRUMENTS) {
+    assert.ok(status.instruments[id].latency > 0, `${id} latency`)
+  }
+
+  /* 模拟前置机断线后不保留订阅, 重新登录后由订阅集合再次分块订阅 */
+  await waitFor(() => md.disconnected === 1, 5000, 'not disconnected')
+  await waitFor(() => md.loggedIn === 2, 5000, 'not logged in again')
+  await waitFor(() => allActive(md), 5000, 'not resubscribed')
+  await waitFor(() => allTicking(md, md.disconnectedAt), 5000,
+    'ticks not received after reconnect')
+  assert.strictEqual(md.responses.length, INSTRUMENTS.length * 2)
+  assert.strictEqual(md.chunks, CHUNKS * 2, 'resubscribe not chunked')
+  assert.deepStrictEqual(md.responses.slice(INSTRUMENTS.length).sort(),
+    INSTRUMENTS.slice().sort())
+  assert.strictEqual(md.getSubscriptions().pending, false)
+
+  await md.exit()
+  console.log('subscription ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
@@ -0,0 +1,126 @@
+'use strict'
+
+/**
+ * 零拷贝行情: 记录布局与字段取值, 以及被覆盖的记录
+ */
+
+const assert = require('assert')
+const { TICK_LAYOUT } = require('../lib/tick')
+const { MockMd, writeTicks, chinaTime, waitFor, run } = require('./common')
+
+const TRADING_DAY = '20180102'
+const COUNT = 10
+
+/* ClosePrice交替为DBL_MAX, 检查有效位 */
+const TICKS = Array.from({ length: COUNT }, (_, i) => ({
+  TradingDay: TRADING_DAY,
+  ActionDay: TRADING_DAY,
+  InstrumentID: i % 2 ? 'cu1803' : 'rb1805',
+  ExchangeID: i % 2 ? 'SHFE' : 'SHF',
+  LastPrice: 3500 + i,
+  ClosePrice: i % 2 ? Number.MAX_VALUE : 3400 + i,
+  BidPrice1: 3499 + i,
+  AskPrice1: 3501 + i,
+  BidVolume1: 10 + i,
+  AskVolume1: 20 + i,
+  Volume: 100 * (i + 1),
+  Turnover: 350000.5 * (i + 1),
+  OpenInterest: 5000 + i,
+  UpdateTime: `09:00:0${i}`,
+  UpdateMillisec: i % 2 ? 500 : 0
+}))
+
+process.env.CTP_MOCK_TICK_RATE = '0'
+process.env.CTP_MOCK_MD_REPLAY = writeTicks('node_ctp_tick_ring.csv', TICKS)
+
+class RingMd extends MockMd {
+  constructor (capacity) {
+    super(['rb1805', 'cu1803'])
+    this.records = []
+    this.ring = this.enableTickRing(capacity)
+  }
+
+  onRtnDepthMarketDataRing (ring, begin, end) {
+    for (let i = begin; i !== end; i = (i + 1) >>> 0) {
+      const view = ring.at(i)
+      this.records.push(view ? view.toObject() : null)
+    }
+  }
+}
+
+function checkRecord (record, tick) {
+  assert.strictEqual(record.InstrumentID, tick.InstrumentID)
+  assert.strictEqual(record.ExchangeID, tick.ExchangeID)
+  assert.strictEqual(record.TradingDay, tick.TradingDay)
+  assert.strictEqual(record.UpdateTime, tick.UpdateTime)
+  assert.strictEqual(record.UpdateMillisec, tick.UpdateMillisec)
+  assert.strictEqual(record.LastPrice, tick.LastPrice)
+  assert.strictEqual(record.BidPrice1, tick.BidPrice1)
+  assert.strictEqual(record.AskPrice1, tick.AskPrice1)
+  assert.strictEqual(record.BidVolume1, tick.BidVolume1)
+  assert.strictEqual(record.AskVolume1, tick.AskVolume1)
+  assert.strictEqual(record.Volume, tick.Volume)
+  assert.strictEqual(record.Turnover, tick.Turnover)
+  assert.strictEqual(record.OpenInterest, tick.OpenInterest)
+  assert.strictEqual(record.Timestamp,
+    chinaTime(tick.TradingDay, tick.UpdateTime, tick.UpdateMillisec))
+  /* 未开启deltas时增量字段为0 */
+  assert.strictEqual(record.LastVolume, 0)
+}
+
+/**
+ * 记录长度与Node层布局一致, 各字段取值与推送的行情一致
+ */
+async function testLayout () {
+  const md = new RingMd(16)
+  assert.strictEqual(md.ring.capacity, 16)
+  for (let name of Object.keys(TICK_LAYOUT)) {
+    const [type, offset, length] = TICK_LAYOUT[name]
+    const size = type === 'str' ? length : type === 'f64' ? 8 : 4
+    assert.ok(offset + size <= md.ring.recordSize, `${name} out of record`)
+  }
+
+  await md.start('/tmp/node_ctp_test_ring@')
+  await waitFor(() => md.records.length === COUNT, 5000, 'ticks not received')
+  assert.strictEqual(md.ticks.length, 0, 'ticks forwarded in ring mode')
+  assert.strictEqual(md.ring.cursor, COUNT)
+
+  const view = md.ring.at(0)
+  for (let i = 0; i < COUNT; ++i) {
+    checkRecord(md.records[i], TICKS[i])
+    assert.strictEqual(md.ring.at(i, view).has('ClosePrice'), i % 2 === 0)
+    assert.ok(view.has('LastPrice'))
+  }
+  await md.exit()
+}
+
+/**
+ * 超出容量后较早的记录被覆盖, at()返回null
+ */
+async function testOverwrite () {
+  const md = new RingMd(3)
+  /* 容量向上取整为2的幂 */
+  assert.strictEqual(md.ring.capacity, 4)
+
+  await md.start('/tmp/node_ctp_test_ring_small@')
+  await waitFor(() => md.records.length === COUNT, 5000, 'ticks not received')
+  for (let i = 0; i < COUNT; ++i) {
+    const view = md.ring.at(i)
+    if (i < COUNT - 4) {
+      assert.strictEqual(view, null, `record ${i} not overwritten`)
+    } else {
+      checkRecord(view, TICKS[i])
+    }
+  }
+  await md.exit()
+}
+
+async function main () {
+  await testLayout()
+  await testOverwrite()
+  console.log('tick ring ok')
+}
+
+if (require.main === module) {
+  run(main)
+}
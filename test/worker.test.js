@@ -0,0 +1,92 @@
+'use strict'
+
+/**
+ * worker线程中创建并退出实例, 环境退出时事件循环中不能残留句柄
+ *  1. 调用exit后句柄关闭, worker线程自然退出
+ *  2. 未调用exit时终止worker线程, 由环境清理函数释放API并关闭句柄
+ */
+
+const assert = require('assert')
+const { MOCK_FRONT, waitFor, assertMock, run } = require('./common')
+
+let threads = null
+try {
+  threads = require('worker_threads')
+} catch (err) {
+  /* Node 10.5之前没有worker_threads, 10.5至11.6需要--experimental-worker参数 */
+}
+
+/**
+ * 在worker线程中运行: 创建实例并连接模拟前置机
+ */
+async function child ({ kind, exit }) {
+  const ctp = require('../lib/index')
+  let connected = false
+  let api
+  if (kind === 'md') {
+    api = new ctp.CtpMd()
+    api.onFrontConnected = () => { connected = true }
+    await api.createFtdcMdApi(`/tmp/node_ctp_worker_md_${exit}@`)
+  } else {
+    api = new ctp.CtpTd()
+    api.onFrontConnected = () => { connected = true }
+    await api.createFtdcTraderApi(`/tmp/node_ctp_worker_td_${exit}@`)
+  }
+  await assertMock(api)
+  await api.registerFront(MOCK_FRONT)
+  await api.init()
+  await waitFor(() => connected, 5000, `${kind}: front not connected`)
+
+  if (exit) {
+    await api.exit()
+    await assert.rejects(api.replay('/tmp/none', 0), /exited/)
+  }
+  threads.parentPort.postMessage('ready')
+}
+
+/**
+ * 在主线程中运行: 等待worker线程退出
+ * @return worker线程的退出码
+ */
+function spawn (options, timeout = 5000) {
+  return new Promise((resolve, reject) => {
+    const worker = new threads.Worker(__filename, { workerData: options })
+    const timer = setTimeout(() => {
+      reject(new Error(`${JSON.stringify(options)}: worker did not exit`))
+    }, timeout)
+    worker.on('message', () => {
+      /* 未调用exit时事件句柄仍然持有引用, 需要主动终止 */
+      if (!options.exit) {
+        worker.terminate()
+      }
+    })
+    worker.on('error', reject)
+    worker.on('exit', (code) => {
+      clearTimeout(timer)
+      resolve(code)
+    })
+  })
+}
+
+async function main () {
+  for (let kind of ['md', 'td']) {
+    for (let exit of [true, false]) {
+      const code = await spawn({ kind, exit })
+      /* terminate返回的退出码为1 */
+      assert.strictEqual(code, exit ? 0 : 1, `${kind} exit=${exit}`)
+    }
+  }
+  console.log('worker ok')
+}
+
+if (!threads) {
+  console.log(`worker skipped: worker_threads is not available in Node ${process.version}, ` +
+    'run with --experimental-worker on Node 10.5 to 11.6')
+} else if (threads.isMainThread) {
+  run(main)
+} else {
+  child(threads.workerData).catch((err) => {
+    console.error(err.stack || err.message)
+    process.exit(2)
+  })
+}